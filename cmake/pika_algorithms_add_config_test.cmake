@@ -261,6 +261,15 @@ function(pika_algorithms_check_for_std_experimental_simd)
   )
 endfunction()
 
+# ##############################################################################
+function(pika_algorithms_check_for_builtin_vector_extensions)
+  pika_algorithms_add_config_test(
+    PIKA_ALGORITHMS_WITH_BUILTIN_VECTOR_EXTENSIONS
+    SOURCE cmake/tests/builtin_vector_extensions.cpp
+    FILE ${ARGN}
+  )
+endfunction()
+
 # ##############################################################################
 function(pika_algorithms_check_for_cxx20_std_ranges_iter_swap)
   pika_algorithms_add_config_test(
@@ -278,3 +287,12 @@ function(pika_algorithms_check_for_mm_prefetch)
     FILE ${ARGN}
   )
 endfunction()
+
+# ##############################################################################
+function(pika_algorithms_check_for_mm_stream)
+  pika_algorithms_add_config_test(
+    PIKA_ALGORITHMS_WITH_MM_STREAM
+    SOURCE cmake/tests/mm_stream.cpp
+    FILE ${ARGN}
+  )
+endfunction()
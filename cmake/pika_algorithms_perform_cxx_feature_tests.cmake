@@ -20,10 +20,16 @@ function(pika_algorithms_perform_cxx_feature_tests)
     DEFINITIONS PIKA_ALGORITHMS_HAVE_CXX17_STD_SCAN_ALGORITHMS
   )
 
-  pika_algorithms_check_for_std_experimental_simd(
-    DEFINITIONS PIKA_ALGORITHMS_HAVE_STD_EXPERIMENTAL_SIMD
-    PIKA_ALGORITHMS_HAVE_DATAPAR
-  )
+  if(PIKA_ALGORITHMS_WITH_BUILTIN_SIMD)
+    pika_algorithms_check_for_builtin_vector_extensions(
+      DEFINITIONS PIKA_ALGORITHMS_HAVE_BUILTIN_SIMD PIKA_ALGORITHMS_HAVE_DATAPAR
+    )
+  else()
+    pika_algorithms_check_for_std_experimental_simd(
+      DEFINITIONS PIKA_ALGORITHMS_HAVE_STD_EXPERIMENTAL_SIMD
+      PIKA_ALGORITHMS_HAVE_DATAPAR
+    )
+  endif()
 
   pika_algorithms_check_for_cxx20_std_ranges_iter_swap(
     DEFINITIONS PIKA_ALGORITHMS_HAVE_CXX20_STD_RANGES_ITER_SWAP
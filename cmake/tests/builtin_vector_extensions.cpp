@@ -0,0 +1,30 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// test for availability of the GCC/clang vector extensions used by the
+// built-in vector-pack backend
+
+#include <cstddef>
+
+template <typename T, std::size_t N>
+struct vector
+{
+    typedef T type __attribute__((vector_size(N * sizeof(T))));
+};
+
+int main()
+{
+    using int_vector = vector<int, 4>::type;
+    using float_vector = vector<float, 4>::type;
+
+    int_vector i = int_vector{} + 1;
+    float_vector f = float_vector{} + 1.0f;
+
+    int_vector msk = (int_vector) (f < f + 1.0f);
+    i = (msk & i) | (~msk & (int_vector) f);
+
+    return i[0] == 1 ? 0 : 1;
+}
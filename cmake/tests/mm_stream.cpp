@@ -0,0 +1,20 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(__GNUC__)
+#include <emmintrin.h>
+#endif
+
+int main()
+{
+    alignas(16) char buffer[16] = {};
+    __m128i* p = reinterpret_cast<__m128i*>(buffer);
+    _mm_stream_si128(p, _mm_loadu_si128(p));
+    _mm_sfence();
+}
@@ -8,6 +8,8 @@
 #include <pika/init.hpp>
 #include <pika/modules/iterator_support.hpp>
 #include <pika/numeric.hpp>
+#include <pika/parallel/algorithms/transpose.hpp>
+#include <pika/parallel/datapar.hpp>
 
 #include <algorithm>
 #include <cstdint>
@@ -33,6 +35,10 @@ int pika_main(pika::program_options::variables_map& vm)
         tile_size = vm["tile_size"].as<std::uint64_t>();
 
     verbose = vm.count("verbose") ? true : false;
+    bool const use_transpose = vm.count("use_transpose") != 0;
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR)
+    bool const use_simd = vm.count("use_simd") != 0;
+#endif
 
     std::uint64_t bytes =
         static_cast<std::uint64_t>(2 * sizeof(double) * order * order);
@@ -42,7 +48,9 @@ int pika_main(pika::program_options::variables_map& vm)
 
     std::cout << "Serial Matrix transpose: B = A^T\n"
               << "Matrix order          = " << order << "\n";
-    if (tile_size < order)
+    if (use_transpose)
+        std::cout << "Using pika::transpose\n";
+    else if (tile_size < order)
         std::cout << "Tile size             = " << tile_size << "\n";
     else
         std::cout << "Untiled\n";
@@ -74,7 +82,21 @@ int pika_main(pika::program_options::variables_map& vm)
     for (std::uint64_t iter = 0; iter < iterations; ++iter)
     {
         pika::chrono::detail::high_resolution_timer t;
-        if (tile_size < order)
+        if (use_transpose)
+        {
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR)
+            if (use_simd)
+            {
+                pika::transpose(pika::execution::par_simd, A.begin(), order,
+                    order, B.begin());
+            }
+            else
+#endif
+            {
+                pika::transpose(par, A.begin(), order, order, B.begin());
+            }
+        }
+        else if (tile_size < order)
         {
             auto range = pika::detail::strided_irange(
                 start, order + tile_size, tile_size);
@@ -161,6 +183,13 @@ int main(int argc, char* argv[])
         ("tile_size", value<std::uint64_t>(),
          "Number of tiles to divide the individual matrix blocks for improved "
          "cache and TLB performance")
+        ("use_transpose",
+         "Use the cache-oblivious pika::transpose algorithm instead of the "
+         "(tiled) loops")
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR)
+        ("use_simd",
+         "Vectorize pika::transpose using the par_simd execution policy")
+#endif
         ( "verbose", "Verbose output")
     ;
     // clang-format on
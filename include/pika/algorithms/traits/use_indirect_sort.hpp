@@ -0,0 +1,38 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+#if !defined(PIKA_ALGORITHMS_INDIRECT_SORT_THRESHOLD)
+#define PIKA_ALGORITHMS_INDIRECT_SORT_THRESHOLD 128
+#endif
+
+namespace pika::traits {
+    ///////////////////////////////////////////////////////////////////////////
+    /// The sorting algorithms sort sequences of elements of type \a T
+    /// indirectly if this trait is true: they sort an array of indices into
+    /// the sequence and move every element only once when applying the
+    /// resulting permutation. By default this is done for types larger than
+    /// PIKA_ALGORITHMS_INDIRECT_SORT_THRESHOLD bytes and for types which can
+    /// not be moved without throwing. The trait may be specialized to select
+    /// the mode for a type explicitly.
+    template <typename T, typename Enable = void>
+    struct use_indirect_sort
+      : std::integral_constant<bool,
+            (sizeof(T) > PIKA_ALGORITHMS_INDIRECT_SORT_THRESHOLD) ||
+                !std::is_nothrow_move_constructible_v<T> ||
+                !std::is_nothrow_move_assignable_v<T>>
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool use_indirect_sort_v = use_indirect_sort<T>::value;
+}    // namespace pika::traits
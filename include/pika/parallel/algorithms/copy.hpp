@@ -217,9 +217,12 @@ namespace pika {
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/loop.hpp>
+#include <pika/parallel/util/prefetching.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/result_types.hpp>
 #include <pika/parallel/util/scan_partitioner.hpp>
+#include <pika/parallel/util/scratch_memory.hpp>
+#include <pika/parallel/util/streaming_stores.hpp>
 #include <pika/parallel/util/transfer.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 #include <pika/type_support/unused.hpp>
@@ -229,6 +232,7 @@ namespace pika {
 #include <cstring>
 #include <iterator>
 #include <memory>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -244,12 +248,29 @@ namespace pika { namespace parallel {
         {
             using execution_policy_type = std::decay_t<ExPolicy>;
 
+            // write the output using streaming stores, if possible
+            bool streaming_ = false;
+
             template <typename Iter>
             PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr void operator()(
                 Iter part_begin, std::size_t part_size, std::size_t) const
             {
                 using std::get;
                 auto iters = part_begin.get_iterator_tuple();
+
+                using iterator_tuple_type = typename Iter::iterator_tuple_type;
+                if constexpr (supports_streaming_copy_v<
+                                  std::tuple_element_t<0, iterator_tuple_type>,
+                                  std::tuple_element_t<1, iterator_tuple_type>>)
+                {
+                    if (streaming_)
+                    {
+                        streaming_copy_n(
+                            get<0>(iters), part_size, get<1>(iters));
+                        return;
+                    }
+                }
+
                 copy_n<execution_policy_type>(
                     get<0>(iters), part_size, get<1>(iters));
             }
@@ -283,10 +304,18 @@ namespace pika { namespace parallel {
                 in_out_result<InIter, OutIter>>
             sequential(ExPolicy, InIter first, Sent last, OutIter dest)
             {
-                in_out_result<InIter, OutIter> result = copy_n<ExPolicy>(
-                    first, detail::distance(first, last), dest);
-                copy_synchronize(first, dest);
-                return result;
+                if constexpr (is_prefetching_iterator_v<InIter>)
+                {
+                    return prefetching_transform_loop(
+                        first, last, dest, [](auto curr) { return *curr; });
+                }
+                else
+                {
+                    in_out_result<InIter, OutIter> result = copy_n<ExPolicy>(
+                        first, detail::distance(first, last), dest);
+                    copy_synchronize(first, dest);
+                    return result;
+                }
             }
 
             template <typename ExPolicy, typename FwdIter1, typename Sent1,
@@ -306,19 +335,32 @@ namespace pika { namespace parallel {
                     in_out_result<FwdIter1, FwdIter2>>::type* dummy = nullptr;
                 return PIKA_MOVE(*dummy);
 #else
-                using zip_iterator =
-                    pika::util::zip_iterator<FwdIter1, FwdIter2>;
-
-                return get_in_out_result(foreach_partitioner<ExPolicy>::call(
-                    PIKA_FORWARD(ExPolicy, policy),
-                    pika::util::make_zip_iterator(first, dest),
-                    detail::distance(first, last), copy_iteration<ExPolicy>(),
-                    [](zip_iterator&& last) -> zip_iterator {
-                        using std::get;
-                        auto iters = last.get_iterator_tuple();
-                        copy_synchronize(get<0>(iters), get<1>(iters));
-                        return PIKA_MOVE(last);
-                    }));
+                if constexpr (is_prefetching_iterator_v<FwdIter1>)
+                {
+                    return prefetching_transform(PIKA_FORWARD(ExPolicy, policy),
+                        first, last, dest, [](auto curr) { return *curr; });
+                }
+                else
+                {
+                    using zip_iterator =
+                        pika::util::zip_iterator<FwdIter1, FwdIter2>;
+
+                    std::size_t const count = detail::distance(first, last);
+                    bool const streaming =
+                        use_streaming_stores<FwdIter2>(policy, count);
+
+                    return get_in_out_result(
+                        foreach_partitioner<ExPolicy>::call(
+                            PIKA_FORWARD(ExPolicy, policy),
+                            pika::util::make_zip_iterator(first, dest), count,
+                            copy_iteration<ExPolicy>{streaming},
+                            [](zip_iterator&& last) -> zip_iterator {
+                                using std::get;
+                                auto iters = last.get_iterator_tuple();
+                                copy_synchronize(get<0>(iters), get<1>(iters));
+                                return PIKA_MOVE(last);
+                            }));
+                }
 #endif
             }
         };
@@ -369,14 +411,28 @@ namespace pika { namespace parallel {
                 using zip_iterator =
                     pika::util::zip_iterator<FwdIter1, FwdIter2>;
 
+                bool const streaming =
+                    use_streaming_stores<FwdIter2>(policy, count);
+
                 return get_in_out_result(foreach_partitioner<ExPolicy>::call(
                     PIKA_FORWARD(ExPolicy, policy),
                     pika::util::make_zip_iterator(first, dest), count,
-                    [](zip_iterator part_begin, std::size_t part_size,
+                    [streaming](zip_iterator part_begin, std::size_t part_size,
                         std::size_t) {
                         using std::get;
 
                         auto iters = part_begin.get_iterator_tuple();
+                        if constexpr (supports_streaming_copy_v<FwdIter1,
+                                          FwdIter2>)
+                        {
+                            if (streaming)
+                            {
+                                streaming_copy_n(
+                                    get<0>(iters), part_size, get<1>(iters));
+                                return;
+                            }
+                        }
+
                         copy_n<ExPolicy>(
                             get<0>(iters), part_size, get<1>(iters));
                     },
@@ -451,7 +507,8 @@ namespace pika { namespace parallel {
 
                 difference_type count = detail::distance(first, last);
 
-                std::shared_ptr<bool[]> flags(new bool[count]);
+                std::shared_ptr<bool[]> flags =
+                    make_scratch_array<bool>(policy, count);
                 std::size_t init = 0;
 
                 using pika::util::make_zip_iterator;
@@ -0,0 +1,283 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/type_support/unused.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(PIKA_ALGORITHMS_HAVE_MM_PREFETCH)
+#if defined(PIKA_MSVC)
+#include <intrin.h>
+#endif
+#if defined(PIKA_GCC_VERSION)
+#include <emmintrin.h>
+#endif
+#endif
+
+// The number of elements ahead of the current one whose indirectly
+// addressed element is prefetched by gather and scatter.
+#if !defined(PIKA_ALGORITHMS_INDIRECT_PREFETCH_DISTANCE)
+#define PIKA_ALGORITHMS_INDIRECT_PREFETCH_DISTANCE 16
+#endif
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    inline constexpr std::size_t indirect_prefetch_distance =
+        PIKA_ALGORITHMS_INDIRECT_PREFETCH_DISTANCE;
+
+    // Prefetches the element at position idx of the sequence starting at
+    // base, for writing if Write is set. Elements without an address (of
+    // proxy iterators) are not prefetched.
+    template <bool Write = false, typename RandIter, typename Index>
+    PIKA_FORCEINLINE void prefetch_indirect(RandIter base, Index idx) noexcept
+    {
+        using reference = typename std::iterator_traits<RandIter>::reference;
+        if constexpr (std::is_lvalue_reference_v<reference>)
+        {
+            auto const* p = std::addressof(base[idx]);
+#if defined(PIKA_GCC_VERSION) || defined(PIKA_CLANG_VERSION)
+            __builtin_prefetch(p, Write ? 1 : 0);
+#elif defined(PIKA_ALGORITHMS_HAVE_MM_PREFETCH)
+            _mm_prefetch(reinterpret_cast<char const*>(p), _MM_HINT_T0);
+#else
+            (void) p;
+#endif
+        }
+    }
+
+    // Invokes f(active) for count consecutive elements, ahead() is invoked
+    // indirect_prefetch_distance elements earlier for the same element: it
+    // prefetches whatever the element addresses indirectly and returns
+    // whether the element is active, which is then passed on to f.
+    template <typename Ahead, typename F>
+    PIKA_FORCEINLINE void indirect_loop_n(
+        std::size_t count, Ahead&& ahead, F&& f)
+    {
+        constexpr std::size_t distance = indirect_prefetch_distance;
+
+        std::array<bool, distance> active{};
+        std::size_t const lead = (std::min)(count, distance);
+        for (std::size_t i = 0; i != lead; ++i)
+        {
+            active[i] = ahead();
+        }
+
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            bool const current = active[i % distance];
+            if (i + distance < count)
+            {
+                active[i % distance] = ahead();
+            }
+            f(current);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // dest[i] = src[map[i]] for all i in [0, count), returns the end of the
+    // output.
+    template <typename MapIter, typename RandIter, typename OutIter>
+    OutIter gather_loop_n(
+        MapIter map, std::size_t count, RandIter src, OutIter dest)
+    {
+        MapIter map_ahead = map;
+        indirect_loop_n(
+            count,
+            [&]() {
+                prefetch_indirect(src, *map_ahead);
+                ++map_ahead;
+                return true;
+            },
+            [&](bool) {
+                *dest = src[*map];
+                ++map;
+                ++dest;
+            });
+        return dest;
+    }
+
+    // dest[i] = src[map[i]] for all i in [0, count) with pred(stencil[i]),
+    // the other elements of the output are left alone. The map of the other
+    // elements is neither read nor prefetched.
+    template <typename MapIter, typename StencilIter, typename RandIter,
+        typename OutIter, typename Pred>
+    OutIter gather_if_loop_n(MapIter map, std::size_t count,
+        StencilIter stencil, RandIter src, OutIter dest, Pred&& pred)
+    {
+        MapIter map_ahead = map;
+        indirect_loop_n(
+            count,
+            [&]() {
+                bool const active = PIKA_INVOKE(pred, *stencil);
+                if (active)
+                {
+                    prefetch_indirect(src, *map_ahead);
+                }
+                ++stencil;
+                ++map_ahead;
+                return active;
+            },
+            [&](bool active) {
+                if (active)
+                {
+                    *dest = src[*map];
+                }
+                ++map;
+                ++dest;
+            });
+        return dest;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // dest[map[j]] = first[j] for all j in [0, count) for which active()
+    // returns true (active() is invoked once per position, in order), with
+    // the writes grouped by the page of the output they go to. Pages are
+    // counted from the beginning of the output. The positions are sorted by
+    // page using a counting sort, which is stable: writes to the same
+    // element happen in the order of their positions. If the writes span
+    // more pages than there are writes, adjacent pages are binned together.
+    template <typename RandIter1, typename RandIter2, typename RandIter3,
+        typename Active>
+    void blocked_scatter_n(RandIter1 first, std::size_t count, RandIter2 map,
+        RandIter3 dest, std::size_t page_size, Active&& active)
+    {
+        using value_type = typename std::iterator_traits<RandIter3>::value_type;
+
+        std::size_t const per_page =
+            (std::max)(page_size / sizeof(value_type), std::size_t(1));
+
+        std::vector<std::size_t> positions;
+        positions.reserve(count);
+
+        std::size_t max_page = 0;
+        for (std::size_t j = 0; j != count; ++j)
+        {
+            if (active())
+            {
+                positions.push_back(j);
+                max_page = (std::max)(
+                    max_page, static_cast<std::size_t>(map[j]) / per_page);
+            }
+        }
+
+        std::size_t shift = 0;
+        while ((max_page >> shift) > positions.size())
+        {
+            ++shift;
+        }
+
+        auto bin = [&](std::size_t j) {
+            return (static_cast<std::size_t>(map[j]) / per_page) >> shift;
+        };
+
+        std::vector<std::size_t> offsets((max_page >> shift) + 2, 0);
+        for (std::size_t j : positions)
+        {
+            ++offsets[bin(j) + 1];
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        std::vector<std::size_t> sorted(positions.size());
+        for (std::size_t j : positions)
+        {
+            sorted[offsets[bin(j)]++] = j;
+        }
+
+        for (std::size_t j : sorted)
+        {
+            dest[map[j]] = first[j];
+        }
+    }
+
+    // dest[map[i]] = first[i] for all i in [0, count) for which active()
+    // returns true (active() is invoked once per element, in order). The
+    // writes are grouped by pages of page_size bytes if it is not zero and
+    // the elements and the map are accessed through random access
+    // iterators. Returns the end of the input.
+    template <typename InIter, typename MapIter, typename RandIter,
+        typename Active>
+    InIter scatter_n(InIter first, std::size_t count, MapIter map,
+        RandIter dest, std::size_t page_size, Active&& active)
+    {
+        if constexpr (pika::traits::is_random_access_iterator_v<InIter> &&
+            pika::traits::is_random_access_iterator_v<MapIter>)
+        {
+            if (page_size != 0)
+            {
+                blocked_scatter_n(first, count, map, dest, page_size, active);
+                return std::next(first, count);
+            }
+        }
+        else
+        {
+            PIKA_UNUSED(page_size);
+        }
+
+        MapIter map_ahead = map;
+        indirect_loop_n(
+            count,
+            [&]() {
+                bool const is_active = active();
+                if (is_active)
+                {
+                    prefetch_indirect<true>(dest, *map_ahead);
+                }
+                ++map_ahead;
+                return is_active;
+            },
+            [&](bool is_active) {
+                if (is_active)
+                {
+                    dest[*map] = *first;
+                }
+                ++first;
+                ++map;
+            });
+        return first;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct sequential_gather_t
+      : pika::functional::detail::tag_fallback<sequential_gather_t<ExPolicy>>
+    {
+    private:
+        template <typename MapIter, typename RandIter, typename OutIter>
+        friend inline OutIter tag_fallback_invoke(sequential_gather_t<ExPolicy>,
+            MapIter map, std::size_t count, RandIter src, OutIter dest)
+        {
+            return gather_loop_n(map, count, src, dest);
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_gather_t<ExPolicy> sequential_gather =
+        sequential_gather_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename MapIter, typename RandIter,
+        typename OutIter>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE OutIter sequential_gather(
+        MapIter map, std::size_t count, RandIter src, OutIter dest)
+    {
+        return sequential_gather_t<ExPolicy>{}(map, count, src, dest);
+    }
+#endif
+}    // namespace pika::parallel::detail
@@ -0,0 +1,209 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/concurrency/cache_line_data.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Privately owned bin counters of one partition of a histogram. The
+    // counters start on a cache line and occupy whole cache lines, which
+    // keeps partitions counting concurrently from sharing any of them.
+    class histogram_bins
+    {
+    public:
+        histogram_bins() = default;
+
+        explicit histogram_bins(std::size_t nbins)
+          : size_(nbins)
+        {
+            std::size_t const cache_line_size =
+                pika::concurrency::detail::get_cache_line_size();
+            std::size_t const bytes =
+                ((nbins * sizeof(std::size_t) + cache_line_size - 1) /
+                    cache_line_size) *
+                cache_line_size;
+
+            data_ = static_cast<std::size_t*>(::operator new(
+                bytes, std::align_val_t(cache_line_size)));
+            std::memset(data_, 0, bytes);
+        }
+
+        histogram_bins(histogram_bins&& rhs) noexcept
+          : data_(std::exchange(rhs.data_, nullptr))
+          , size_(std::exchange(rhs.size_, 0))
+        {
+        }
+
+        histogram_bins& operator=(histogram_bins&& rhs) noexcept
+        {
+            std::swap(data_, rhs.data_);
+            std::swap(size_, rhs.size_);
+            return *this;
+        }
+
+        ~histogram_bins()
+        {
+            if (data_ != nullptr)
+            {
+                ::operator delete(data_,
+                    std::align_val_t(
+                        pika::concurrency::detail::get_cache_line_size()));
+            }
+        }
+
+        std::size_t* data() const noexcept
+        {
+            return data_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+    private:
+        std::size_t* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Adds the number of elements mapped to each of the bins [0, nbins) to
+    // the given counters, elements mapped to any other bin are ignored.
+    template <typename Iter, typename Proj>
+    Iter histogram_loop_n(Iter first, std::size_t count, std::size_t* counts,
+        std::size_t nbins, Proj&& proj)
+    {
+        for (/* */; count != 0; (void) --count, ++first)
+        {
+            // negative bins wrap around and are ignored as well
+            auto const bin =
+                static_cast<std::size_t>(PIKA_INVOKE(proj, *first));
+            if (bin < nbins)
+            {
+                ++counts[bin];
+            }
+        }
+        return first;
+    }
+
+    // Small unsigned keys are their own bins, which allows counting them
+    // into a table covering the whole key range without any range checks.
+    template <typename Iter, typename Proj>
+    inline constexpr bool is_small_key_histogram_v =
+        (std::is_same_v<typename std::iterator_traits<Iter>::value_type,
+             std::uint8_t> ||
+            std::is_same_v<typename std::iterator_traits<Iter>::value_type,
+                std::uint16_t>) &&
+        std::is_same_v<std::decay_t<Proj>, projection_identity>;
+
+    // Consecutive elements are counted into different sub-histograms, runs
+    // of equal keys would otherwise serialize on the same counter.
+    template <typename Iter>
+    Iter small_key_histogram_loop_n(Iter first, std::size_t count,
+        std::size_t* counts, std::size_t nbins)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        constexpr std::size_t range =
+            std::size_t((std::numeric_limits<value_type>::max)()) + 1;
+        constexpr std::size_t ways = sizeof(value_type) == 1 ? 4 : 2;
+
+        // number of elements after which the 32 bit counters of the
+        // sub-histograms are added to the result
+        constexpr std::size_t max_block = std::size_t(1) << 31;
+
+        // clearing and flushing the sub-histograms does not pay off for
+        // short sequences
+        if (count < ways * range)
+        {
+            return histogram_loop_n(
+                first, count, counts, nbins, projection_identity());
+        }
+
+        std::vector<std::uint32_t> sub(ways * range, 0);
+        std::size_t const bins = (std::min)(nbins, range);
+
+        while (count >= ways)
+        {
+            std::size_t block = (std::min)(count - count % ways, max_block);
+            count -= block;
+
+            for (/* */; block != 0; block -= ways)
+            {
+                for (std::size_t w = 0; w != ways; (void) ++w, ++first)
+                {
+                    ++sub[w * range + std::size_t(*first)];
+                }
+            }
+
+            for (std::size_t bin = 0; bin != bins; ++bin)
+            {
+                for (std::size_t w = 0; w != ways; ++w)
+                {
+                    counts[bin] += sub[w * range + bin];
+                }
+            }
+            std::fill(sub.begin(), sub.end(), 0);
+        }
+
+        return histogram_loop_n(
+            first, count, counts, nbins, projection_identity());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct sequential_histogram_t
+      : pika::functional::detail::tag_fallback<sequential_histogram_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename Proj>
+        friend Iter tag_fallback_invoke(
+            sequential_histogram_t<ExPolicy>, Iter first, std::size_t count,
+            std::size_t* counts, std::size_t nbins, Proj&& proj)
+        {
+            if constexpr (is_small_key_histogram_v<Iter, Proj>)
+            {
+                return small_key_histogram_loop_n(first, count, counts, nbins);
+            }
+            else
+            {
+                return histogram_loop_n(
+                    first, count, counts, nbins, PIKA_FORWARD(Proj, proj));
+            }
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_histogram_t<ExPolicy> sequential_histogram =
+        sequential_histogram_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename Proj>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE Iter sequential_histogram(Iter first,
+        std::size_t count, std::size_t* counts, std::size_t nbins, Proj&& proj)
+    {
+        return sequential_histogram_t<ExPolicy>{}(
+            first, count, counts, nbins, PIKA_FORWARD(Proj, proj));
+    }
+#endif
+}    // namespace pika::parallel::detail
@@ -7,40 +7,25 @@
 
 #pragma once
 
+#include <pika/config.hpp>
 #include <pika/assert.hpp>
+#include <pika/algorithms/traits/use_indirect_sort.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/util/detail/bulk_execute.hpp>
+#include <pika/parallel/util/sort_workspace.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace pika::parallel::detail {
-    /// \class less_ptr_no_null
-    ///
-    /// \remarks this is the comparison object for pointers. Receive a object
-    ///          for to compare the objects pointed. The pointers can't be
-    ///          nullptr
-    template <typename Iter, typename Sent,
-        typename Comp =
-            std::less<typename std::iterator_traits<Iter>::value_type>>
-    struct less_ptr_no_null
-    {
-        Comp comp;
-
-        inline less_ptr_no_null(Comp C1 = Comp())
-          : comp(PIKA_MOVE(C1))
-        {
-        }
-
-        inline bool operator()(Iter T1, Sent T2) const
-        {
-            return comp(*T1, *T2);
-        }
-    };
-
     /// \brief Create a index of iterators to the elements
     /// \tparam Iter : iterator to store in the index vector
     /// \param [in] first : iterator to the first element of the range
@@ -105,4 +90,288 @@ namespace pika::parallel::detail {
             ++pos_in_vector;
         }
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sequences are sorted indirectly only if their iterators refer to actual
+    // objects, the elements of proxy iterators can't be moved individually.
+    template <typename Iter>
+    inline constexpr bool sort_indirectly_v =
+        std::is_reference_v<typename std::iterator_traits<Iter>::reference> &&
+        pika::traits::use_indirect_sort_v<
+            typename std::iterator_traits<Iter>::value_type>;
+
+    /// \brief Compare two indices by comparing the elements they refer to
+    template <typename Iter, typename Comp>
+    struct indirect_compare
+    {
+        Iter first;
+        Comp comp;
+
+        indirect_compare(Iter it, Comp cmp)
+          : first(it)
+          , comp(PIKA_MOVE(cmp))
+        {
+        }
+
+        bool operator()(std::size_t lhs, std::size_t rhs) const
+        {
+            return comp(*(first + lhs), *(first + rhs));
+        }
+    };
+
+    /// \brief Memory used by an indirect sort, it is kept in a sort_workspace
+    ///        of the element type across sorts if one is given
+    template <typename T>
+    struct indirect_sort_scratch
+    {
+        struct arc
+        {
+            std::size_t start;
+            std::size_t length;
+            std::size_t next;
+        };
+
+        // positions of the elements of the sorted sequence
+        std::vector<std::size_t> index;
+
+        // used when sorting the index array
+        sort_workspace<std::size_t> index_workspace;
+
+        // marks the positions whose element has been claimed by a thread
+        // while applying the permutation
+        std::unique_ptr<std::atomic<bool>[]> claimed;
+        std::size_t nclaimed = 0;
+
+        // the parts of cycles moved by each thread, together with the
+        // original value of the position following each of them
+        std::vector<std::vector<arc>> arcs;
+        std::vector<std::vector<T>> next_values;
+
+        void resize(std::size_t count, std::uint32_t nthreads)
+        {
+            index.resize(count);
+            if (nthreads > 1 && count > nclaimed)
+            {
+                claimed.reset(new std::atomic<bool>[count]);
+                nclaimed = count;
+            }
+            if (arcs.size() < nthreads)
+            {
+                arcs.resize(nthreads);
+                next_values.resize(nthreads);
+            }
+        }
+    };
+
+    /// \brief Moves the elements such that the element at position index[k]
+    ///        ends up at position k, leaves index[k] == k for all k
+    ///
+    /// If moving an element throws, the element held in the temporary of
+    /// the current cycle is moved into the position left open, the sequence
+    /// then still holds all of its elements in unspecified order (unless
+    /// this move throws as well).
+    /// \param [in] first : iterator to the first element of the data
+    /// \param [in] index : the positions of the sorted sequence
+    template <typename Iter>
+    void apply_permutation(Iter first, std::vector<std::size_t>& index)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        std::size_t const nelem = index.size();
+        for (std::size_t i = 0; i != nelem; ++i)
+        {
+            if (index[i] == i)
+            {
+                continue;
+            }
+
+            value_type tmp = PIKA_MOVE(*(first + i));
+
+            std::size_t pos = i;
+            try
+            {
+                for (std::size_t src = index[pos]; src != i; src = index[pos])
+                {
+                    *(first + pos) = PIKA_MOVE(*(first + src));
+                    index[pos] = pos;
+                    pos = src;
+                }
+                *(first + pos) = PIKA_MOVE(tmp);
+            }
+            catch (...)
+            {
+                *(first + pos) = PIKA_MOVE(tmp);
+                throw;
+            }
+            index[pos] = pos;
+        }
+    }
+
+    /// \brief Fill the index array with the identity permutation and reset
+    ///        the claims of the positions
+    template <typename Exec, typename T>
+    void prepare_indirect_sort(Exec&& exec, std::uint32_t nthreads,
+        indirect_sort_scratch<T>& scratch, std::size_t nelem)
+    {
+        scratch.resize(nelem, nthreads);
+        bulk_execute_n(exec, nthreads, [&](std::uint32_t t) {
+            std::size_t const begin = nelem * t / nthreads;
+            std::size_t const end = nelem * (t + 1) / nthreads;
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                scratch.index[i] = i;
+            }
+            if (nthreads > 1)
+            {
+                for (std::size_t i = begin; i != end; ++i)
+                {
+                    scratch.claimed[i].store(false, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    /// \brief Moves the elements such that the element at position index[k]
+    ///        ends up at position k, following the cycles of the permutation
+    ///        concurrently
+    ///
+    /// Each thread walks the cycles starting in its part of the sequence and
+    /// claims their positions. A cycle claimed by a single thread is moved
+    /// right away. Cycles claimed by several threads are split into arcs,
+    /// the arc preceding a position claimed by another thread saves the
+    /// original element at that position, and all arcs are moved once all
+    /// threads are done claiming.
+    ///
+    /// If moving an element throws, the held elements are moved into the
+    /// positions left open such that the sequence still holds all of its
+    /// elements in unspecified order (unless these moves throw as well):
+    /// while claiming, every saved element is moved back to where it came
+    /// from, while moving an arc, its saved element fills the position left
+    /// open and the remaining arcs are moved regardless.
+    template <typename Exec, typename Iter, typename T>
+    void parallel_apply_permutation(Exec&& exec, std::uint32_t nthreads,
+        Iter first, indirect_sort_scratch<T>& scratch)
+    {
+        if (nthreads == 1)
+        {
+            apply_permutation(first, scratch.index);
+            return;
+        }
+
+        using arc = typename indirect_sort_scratch<T>::arc;
+
+        std::size_t const nelem = scratch.index.size();
+        std::size_t const* index = scratch.index.data();
+        std::atomic<bool>* claimed = scratch.claimed.get();
+
+        auto claim = [&](std::uint32_t t) {
+            std::vector<arc>& arcs = scratch.arcs[t];
+            std::vector<T>& next_values = scratch.next_values[t];
+            arcs.clear();
+            next_values.clear();
+
+            std::size_t const begin = nelem * t / nthreads;
+            std::size_t const end = nelem * (t + 1) / nthreads;
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                if (index[i] == i ||
+                    claimed[i].exchange(true, std::memory_order_relaxed))
+                {
+                    continue;
+                }
+
+                std::size_t length = 1;
+                std::size_t pos = index[i];
+                while (pos != i &&
+                    !claimed[pos].exchange(true, std::memory_order_relaxed))
+                {
+                    ++length;
+                    pos = index[pos];
+                }
+
+                if (pos != i)
+                {
+                    // pos starts an arc of another thread, which does not
+                    // move its elements before all arcs are known
+                    arcs.push_back(arc{i, length, pos});
+                    next_values.push_back(PIKA_MOVE(*(first + pos)));
+                    continue;
+                }
+
+                T tmp = PIKA_MOVE(*(first + i));
+                pos = i;
+                try
+                {
+                    for (std::size_t src = index[pos]; src != i;
+                         src = index[pos])
+                    {
+                        *(first + pos) = PIKA_MOVE(*(first + src));
+                        pos = src;
+                    }
+                    *(first + pos) = PIKA_MOVE(tmp);
+                }
+                catch (...)
+                {
+                    *(first + pos) = PIKA_MOVE(tmp);
+                    throw;
+                }
+            }
+        };
+
+        try
+        {
+            bulk_execute_n(exec, nthreads, claim);
+        }
+        catch (...)
+        {
+            // no arc has been moved yet, an arc whose element could not be
+            // saved has no entry in next_values
+            for (std::uint32_t t = 0; t != nthreads; ++t)
+            {
+                std::vector<arc> const& arcs = scratch.arcs[t];
+                std::vector<T>& next_values = scratch.next_values[t];
+                for (std::size_t a = 0; a != next_values.size(); ++a)
+                {
+                    *(first + arcs[a].next) = PIKA_MOVE(next_values[a]);
+                }
+                next_values.clear();
+            }
+            throw;
+        }
+
+        bulk_execute_n(exec, nthreads, [&](std::uint32_t t) {
+            std::vector<arc>& arcs = scratch.arcs[t];
+            std::vector<T>& next_values = scratch.next_values[t];
+
+            std::exception_ptr error;
+            for (std::size_t a = 0; a != arcs.size(); ++a)
+            {
+                std::size_t pos = arcs[a].start;
+                try
+                {
+                    for (std::size_t k = 1; k != arcs[a].length; ++k)
+                    {
+                        std::size_t const src = index[pos];
+                        *(first + pos) = PIKA_MOVE(*(first + src));
+                        pos = src;
+                    }
+                    *(first + pos) = PIKA_MOVE(next_values[a]);
+                }
+                catch (...)
+                {
+                    if (!error)
+                    {
+                        error = std::current_exception();
+                    }
+                    *(first + pos) = PIKA_MOVE(next_values[a]);
+                }
+            }
+            next_values.clear();
+
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        });
+    }
 }    // namespace pika::parallel::detail
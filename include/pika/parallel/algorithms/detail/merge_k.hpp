@@ -0,0 +1,311 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+#include <pika/functional/invoke.hpp>
+
+#include <pika/parallel/algorithms/detail/upper_lower_bound.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The sorted runs merged by merge_k. Elements are ordered by their
+    // projected values, equal elements by the index of their run and then by
+    // their position in it, which makes the merge stable.
+    template <typename Iter, typename Comp, typename Proj>
+    class merge_k_runs
+    {
+    public:
+        merge_k_runs(Comp& comp, Proj& proj)
+          : comp_(comp)
+          , proj_(proj)
+        {
+        }
+
+        void reserve(std::size_t nruns)
+        {
+            firsts_.reserve(nruns);
+            sizes_.reserve(nruns);
+        }
+
+        void push_back(Iter first, std::size_t size)
+        {
+            firsts_.push_back(first);
+            sizes_.push_back(size);
+            count_ += size;
+        }
+
+        // number of runs
+        std::size_t size() const noexcept
+        {
+            return firsts_.size();
+        }
+
+        // number of elements in all runs
+        std::size_t count() const noexcept
+        {
+            return count_;
+        }
+
+        std::vector<std::size_t> const& sizes() const noexcept
+        {
+            return sizes_;
+        }
+
+        // Determines for every run the number of its elements which are
+        // among the first rank elements of the merged sequence.
+        //
+        // The candidates of every run are narrowed down to [lo, hi). Each
+        // step picks the weighted median of the medians of the candidates
+        // as pivot, which either is among the selected elements together
+        // with everything preceding it or is not selected together with
+        // everything following it. Either way at least a quarter of the
+        // candidates is decided.
+        void select(std::size_t rank, std::size_t* splits) const
+        {
+            std::size_t const nruns = size();
+            PIKA_ASSERT(rank <= count_);
+
+            std::size_t* lo = splits;
+            std::fill(lo, lo + nruns, std::size_t(0));
+            std::vector<std::size_t> hi(sizes_);
+
+            std::size_t sum_lo = 0;
+            std::size_t sum_hi = count_;
+
+            // (run, position) of the median of the candidates of each run
+            std::vector<std::pair<std::size_t, std::size_t>> medians;
+            medians.reserve(nruns);
+
+            std::vector<std::size_t> ranks(nruns);
+
+            while (sum_lo != rank)
+            {
+                if (sum_hi == rank)
+                {
+                    std::copy(hi.begin(), hi.end(), lo);
+                    return;
+                }
+
+                medians.clear();
+                std::size_t candidates = 0;
+                for (std::size_t i = 0; i != nruns; ++i)
+                {
+                    if (lo[i] != hi[i])
+                    {
+                        medians.emplace_back(i, lo[i] + (hi[i] - lo[i]) / 2);
+                        candidates += hi[i] - lo[i];
+                    }
+                }
+                PIKA_ASSERT(!medians.empty());
+
+                std::sort(medians.begin(), medians.end(),
+                    [&](auto const& lhs, auto const& rhs) {
+                        return less(lhs.first, lhs.second, rhs.first,
+                            rhs.second);
+                    });
+
+                std::size_t weight = 0;
+                auto pivot = medians.begin();
+                for (/* */; pivot != medians.end(); ++pivot)
+                {
+                    weight += hi[pivot->first] - lo[pivot->first];
+                    if (2 * weight >= candidates)
+                    {
+                        break;
+                    }
+                }
+                PIKA_ASSERT(pivot != medians.end());
+
+                std::size_t const prun = pivot->first;
+                std::size_t const ppos = pivot->second;
+                auto&& value =
+                    PIKA_INVOKE(proj_, *std::next(firsts_[prun], ppos));
+
+                // the number of elements preceding the pivot, counting only
+                // the candidates of each run
+                std::size_t pivot_rank = 0;
+                for (std::size_t i = 0; i != nruns; ++i)
+                {
+                    if (i == prun || lo[i] == hi[i])
+                    {
+                        ranks[i] = i == prun ? ppos : lo[i];
+                    }
+                    else
+                    {
+                        Iter first = std::next(firsts_[i], lo[i]);
+                        Iter last = std::next(firsts_[i], hi[i]);
+
+                        // equal elements of preceding runs precede the pivot
+                        Iter it = i < prun ?
+                            detail::upper_bound(
+                                first, last, value, comp_, proj_) :
+                            detail::lower_bound(
+                                first, last, value, comp_, proj_);
+                        ranks[i] = lo[i] + std::distance(first, it);
+                    }
+                    pivot_rank += ranks[i];
+                }
+
+                if (pivot_rank < rank)
+                {
+                    // the pivot and all elements preceding it are selected
+                    ranks[prun] = ppos + 1;
+                    for (std::size_t i = 0; i != nruns; ++i)
+                    {
+                        sum_lo += ranks[i] - lo[i];
+                        lo[i] = ranks[i];
+                    }
+                }
+                else
+                {
+                    // neither the pivot nor any element following it is
+                    for (std::size_t i = 0; i != nruns; ++i)
+                    {
+                        sum_hi -= hi[i] - ranks[i];
+                        hi[i] = ranks[i];
+                    }
+                }
+            }
+        }
+
+        // Copies the elements [first[i], last[i]) of all runs i to dest in
+        // merged order, using a tournament tree which keeps the loser of
+        // each match in its inner nodes.
+        template <typename OutIter>
+        OutIter merge(std::size_t const* first, std::size_t const* last,
+            OutIter dest) const
+        {
+            std::vector<std::size_t> runs;
+            std::size_t count = 0;
+            for (std::size_t i = 0; i != size(); ++i)
+            {
+                if (first[i] != last[i])
+                {
+                    runs.push_back(i);
+                    count += last[i] - first[i];
+                }
+            }
+
+            if (runs.empty())
+            {
+                return dest;
+            }
+
+            std::size_t const nruns = runs.size();
+            if (nruns == 1)
+            {
+                return std::copy_n(std::next(firsts_[runs[0]], first[runs[0]]),
+                    count, dest);
+            }
+
+            std::vector<Iter> current(nruns);
+            std::vector<Iter> ends(nruns);
+            for (std::size_t i = 0; i != nruns; ++i)
+            {
+                current[i] = std::next(firsts_[runs[i]], first[runs[i]]);
+                ends[i] = std::next(firsts_[runs[i]], last[runs[i]]);
+            }
+
+            // a run wins against another one if its next element precedes
+            // the other's, exhausted runs lose against all others
+            auto wins = [&](std::size_t lhs, std::size_t rhs) {
+                if (current[lhs] == ends[lhs])
+                {
+                    return false;
+                }
+                if (current[rhs] == ends[rhs])
+                {
+                    return true;
+                }
+                if (PIKA_INVOKE(comp_, PIKA_INVOKE(proj_, *current[rhs]),
+                        PIKA_INVOKE(proj_, *current[lhs])))
+                {
+                    return false;
+                }
+                return lhs < rhs ||
+                    PIKA_INVOKE(comp_, PIKA_INVOKE(proj_, *current[lhs]),
+                        PIKA_INVOKE(proj_, *current[rhs]));
+            };
+
+            // inner nodes are [1, nruns), the leaves [nruns, 2 * nruns) are
+            // the runs, losers[0] holds the overall winner
+            std::vector<std::size_t> losers(nruns);
+            {
+                std::vector<std::size_t> winners(nruns);
+                auto winner_of = [&](std::size_t node) {
+                    return node >= nruns ? node - nruns : winners[node];
+                };
+
+                for (std::size_t node = nruns - 1; node != 0; --node)
+                {
+                    std::size_t lhs = winner_of(2 * node);
+                    std::size_t rhs = winner_of(2 * node + 1);
+                    if (!wins(lhs, rhs))
+                    {
+                        std::swap(lhs, rhs);
+                    }
+                    winners[node] = lhs;
+                    losers[node] = rhs;
+                }
+                losers[0] = winners[1];
+            }
+
+            for (/* */; count != 0; --count)
+            {
+                std::size_t winner = losers[0];
+                *dest = *current[winner];
+                ++dest;
+                ++current[winner];
+
+                for (std::size_t node = (winner + nruns) / 2; node != 0;
+                     node /= 2)
+                {
+                    if (wins(losers[node], winner))
+                    {
+                        std::swap(losers[node], winner);
+                    }
+                }
+                losers[0] = winner;
+            }
+            return dest;
+        }
+
+    private:
+        bool less(std::size_t run1, std::size_t pos1, std::size_t run2,
+            std::size_t pos2) const
+        {
+            if (run1 == run2)
+            {
+                return pos1 < pos2;
+            }
+
+            auto&& value1 =
+                PIKA_INVOKE(proj_, *std::next(firsts_[run1], pos1));
+            auto&& value2 =
+                PIKA_INVOKE(proj_, *std::next(firsts_[run2], pos2));
+            if (PIKA_INVOKE(comp_, value2, value1))
+            {
+                return false;
+            }
+            return run1 < run2 || PIKA_INVOKE(comp_, value1, value2);
+        }
+
+        Comp& comp_;
+        Proj& proj_;
+        std::vector<Iter> firsts_;
+        std::vector<std::size_t> sizes_;
+        std::size_t count_ = 0;
+    };
+}    // namespace pika::parallel::detail
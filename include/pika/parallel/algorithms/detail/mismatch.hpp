@@ -0,0 +1,172 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/functional/invoke.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Compares count elements of two ranges, cancelling the (index-less)
+    // token as soon as f(proj1(*first1), proj2(*first2)) returns false. This
+    // is the per-chunk kernel of the parallel equal algorithms.
+    template <typename ExPolicy>
+    struct sequential_equal_n_t
+      : pika::functional::detail::tag_fallback<sequential_equal_n_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter1, typename Iter2, typename Token, typename F,
+            typename Proj1, typename Proj2>
+        friend constexpr void tag_fallback_invoke(
+            sequential_equal_n_t<ExPolicy>, Iter1 first1, Iter2 first2,
+            std::size_t count, Token& tok, F&& f, Proj1&& proj1, Proj2&& proj2)
+        {
+            for (/* */; count != 0; (void) --count, ++first1, ++first2)
+            {
+                if (tok.was_cancelled())
+                {
+                    break;
+                }
+                if (!PIKA_INVOKE(f, PIKA_INVOKE(proj1, *first1),
+                        PIKA_INVOKE(proj2, *first2)))
+                {
+                    tok.cancel();
+                    break;
+                }
+            }
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_equal_n_t<ExPolicy> sequential_equal_n =
+        sequential_equal_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter1, typename Iter2,
+        typename Token, typename F, typename Proj1, typename Proj2>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE void sequential_equal_n(Iter1 first1,
+        Iter2 first2, std::size_t count, Token& tok, F&& f, Proj1&& proj1,
+        Proj2&& proj2)
+    {
+        return sequential_equal_n_t<ExPolicy>{}(first1, first2, count, tok,
+            PIKA_FORWARD(F, f), PIKA_FORWARD(Proj1, proj1),
+            PIKA_FORWARD(Proj2, proj2));
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Compares count elements of two ranges starting at the global position
+    // base_idx, cancelling the token with the index of the first element for
+    // which f(proj1(*first1), proj2(*first2)) returns false. This is the
+    // per-chunk kernel of the parallel mismatch algorithms.
+    template <typename ExPolicy>
+    struct sequential_mismatch_n_t
+      : pika::functional::detail::tag_fallback<
+            sequential_mismatch_n_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter1, typename Iter2, typename Token, typename F,
+            typename Proj1, typename Proj2>
+        friend constexpr void tag_fallback_invoke(
+            sequential_mismatch_n_t<ExPolicy>, std::size_t base_idx,
+            Iter1 first1, Iter2 first2, std::size_t count, Token& tok, F&& f,
+            Proj1&& proj1, Proj2&& proj2)
+        {
+            for (/* */; count != 0;
+                 (void) --count, ++first1, ++first2, ++base_idx)
+            {
+                if (tok.was_cancelled(base_idx))
+                {
+                    break;
+                }
+                if (!PIKA_INVOKE(f, PIKA_INVOKE(proj1, *first1),
+                        PIKA_INVOKE(proj2, *first2)))
+                {
+                    tok.cancel(base_idx);
+                    break;
+                }
+            }
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_mismatch_n_t<ExPolicy> sequential_mismatch_n =
+        sequential_mismatch_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter1, typename Iter2,
+        typename Token, typename F, typename Proj1, typename Proj2>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE void sequential_mismatch_n(
+        std::size_t base_idx, Iter1 first1, Iter2 first2, std::size_t count,
+        Token& tok, F&& f, Proj1&& proj1, Proj2&& proj2)
+    {
+        return sequential_mismatch_n_t<ExPolicy>{}(base_idx, first1, first2,
+            count, tok, PIKA_FORWARD(F, f), PIKA_FORWARD(Proj1, proj1),
+            PIKA_FORWARD(Proj2, proj2));
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Same as sequential_mismatch_n, except that two elements are considered
+    // to be different if either pred(a, b) or pred(b, a) holds. This is the
+    // per-chunk kernel of the parallel lexicographical_compare algorithm.
+    template <typename ExPolicy>
+    struct sequential_lexicographical_mismatch_n_t
+      : pika::functional::detail::tag_fallback<
+            sequential_lexicographical_mismatch_n_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter1, typename Iter2, typename Token,
+            typename Pred, typename Proj1, typename Proj2>
+        friend constexpr void tag_fallback_invoke(
+            sequential_lexicographical_mismatch_n_t<ExPolicy>,
+            std::size_t base_idx, Iter1 first1, Iter2 first2,
+            std::size_t count, Token& tok, Pred&& pred, Proj1&& proj1,
+            Proj2&& proj2)
+        {
+            for (/* */; count != 0;
+                 (void) --count, ++first1, ++first2, ++base_idx)
+            {
+                if (tok.was_cancelled(base_idx))
+                {
+                    break;
+                }
+                if (PIKA_INVOKE(pred, PIKA_INVOKE(proj1, *first1),
+                        PIKA_INVOKE(proj2, *first2)) ||
+                    PIKA_INVOKE(pred, PIKA_INVOKE(proj2, *first2),
+                        PIKA_INVOKE(proj1, *first1)))
+                {
+                    tok.cancel(base_idx);
+                    break;
+                }
+            }
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_lexicographical_mismatch_n_t<ExPolicy>
+        sequential_lexicographical_mismatch_n =
+            sequential_lexicographical_mismatch_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter1, typename Iter2,
+        typename Token, typename Pred, typename Proj1, typename Proj2>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE void
+    sequential_lexicographical_mismatch_n(std::size_t base_idx, Iter1 first1,
+        Iter2 first2, std::size_t count, Token& tok, Pred&& pred,
+        Proj1&& proj1, Proj2&& proj2)
+    {
+        return sequential_lexicographical_mismatch_n_t<ExPolicy>{}(base_idx,
+            first1, first2, count, tok, PIKA_FORWARD(Pred, pred),
+            PIKA_FORWARD(Proj1, proj1), PIKA_FORWARD(Proj2, proj2));
+    }
+#endif
+}    // namespace pika::parallel::detail
@@ -13,10 +13,13 @@
 #include <pika/executors/exception_list.hpp>
 #include <pika/parallel/algorithms/detail/sample_sort.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/bulk_execute.hpp>
+#include <pika/parallel/util/scratch_memory.hpp>
+#include <pika/parallel/util/sort_workspace.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <cstdlib>
 #include <functional>
 #include <iterator>
 #include <list>
@@ -29,6 +32,83 @@
 namespace pika::parallel::detail {
     static constexpr std::size_t stable_sort_limit_per_task = 1 << 16;
 
+    // Maximal number of merge segments per thread, more segments than threads
+    // even out differences in the cost of the comparisons
+    static constexpr std::uint32_t stable_sort_merge_segments_per_thread = 4;
+
+    /// \brief Find the point where the diagonal diag crosses the merge path
+    ///        of two sorted sequences (co-rank)
+    /// \param [in] first1 : beginning of the first sequence
+    /// \param [in] n1 : number of elements of the first sequence
+    /// \param [in] first2 : beginning of the second sequence
+    /// \param [in] n2 : number of elements of the second sequence
+    /// \param [in] diag : number of elements of the merged sequence
+    /// \param [in] comp : object for to compare two elements
+    /// \return number of elements of the first sequence among the first diag
+    ///         elements of the stable merge of both sequences, the remaining
+    ///         ones come from the second sequence
+    template <typename Iter1, typename Iter2, typename Compare>
+    std::size_t merge_path_split(Iter1 first1, std::size_t n1, Iter2 first2,
+        std::size_t n2, std::size_t diag, Compare& comp)
+    {
+        std::size_t lo = diag > n2 ? diag - n2 : 0;
+        std::size_t hi = (std::min)(diag, n1);
+
+        while (lo < hi)
+        {
+            // equal elements of the first sequence go first
+            std::size_t mid = lo + (hi - lo) / 2;
+            if (comp(*(first2 + (diag - mid - 1)), *(first1 + mid)))
+            {
+                hi = mid;
+            }
+            else
+            {
+                lo = mid + 1;
+            }
+        }
+        return lo;
+    }
+
+    /// \brief Stable merge of two sorted sequences moving the elements to
+    ///        dest. The result is split into nsegments parts of the same
+    ///        size along the merge path, which are merged concurrently.
+    /// \remarks The destination must not overlap any of the sources
+    template <typename Exec, typename Iter1, typename Iter2, typename Iter3,
+        typename Compare>
+    void parallel_merge_path(Exec& exec, std::uint32_t nsegments,
+        Iter1 first1, std::size_t n1, Iter2 first2, std::size_t n2, Iter3 dest,
+        Compare& comp)
+    {
+        std::size_t const total = n1 + n2;
+        bulk_execute_n(exec, nsegments, [&](std::uint32_t i) {
+            std::size_t const diag_first = total * i / nsegments;
+            std::size_t const diag_last = total * (i + 1) / nsegments;
+
+            std::size_t const split_first =
+                merge_path_split(first1, n1, first2, n2, diag_first, comp);
+            std::size_t const split_last =
+                merge_path_split(first1, n1, first2, n2, diag_last, comp);
+
+            Iter1 it1 = first1 + split_first;
+            Iter1 last1 = first1 + split_last;
+            Iter2 it2 = first2 + (diag_first - split_first);
+            Iter2 last2 = first2 + (diag_last - split_last);
+            Iter3 out = dest + diag_first;
+
+            while (it1 != last1 && it2 != last2)
+            {
+                *(out++) = !comp(*it2, *it1) ?
+                    // NOLINTNEXTLINE(bugprone-macro-repeated-side-effects)
+                    PIKA_MOVE(*(it1++)) :
+                    // NOLINTNEXTLINE(bugprone-macro-repeated-side-effects)
+                    PIKA_MOVE(*(it2++));
+            }
+            out = init_move(out, it1, last1);
+            init_move(out, it2, last2);
+        });
+    }
+
     /// \struct parallel_stable_sort
     /// \brief This a structure for to implement a parallel stable sort
     ///        exception safe
@@ -41,8 +121,13 @@ namespace pika::parallel::detail {
         Compare comp;
         std::size_t nelem;
         value_type* ptr;
+        sort_workspace<value_type>* workspace;
+        pika::execution::scratch_resource* resource;
+        bool construct = false;
 
-        parallel_stable_sort_helper(Iter first, Sent last, Compare cmp);
+        parallel_stable_sort_helper(Iter first, Sent last, Compare cmp,
+            sort_workspace<value_type>* ws = nullptr,
+            pika::execution::scratch_resource* res = nullptr);
 
         // / brief Perform sorting operation
         template <typename Exec>
@@ -53,9 +138,16 @@ namespace pika::parallel::detail {
         ///        temporary buffer used in the sorting process
         ~parallel_stable_sort_helper()
         {
-            if (ptr != nullptr)
+            if (construct)
+            {
+                destroy_range(range<value_type*>(ptr, ptr + ((nelem + 1) >> 1)));
+            }
+
+            if (ptr != nullptr && workspace == nullptr)
             {
-                std::free(ptr);
+                resource->deallocate(ptr,
+                    sizeof(value_type) * ((nelem + 1) >> 1),
+                    alignof(value_type));
             }
         }
     };    // end struct parallel_stable_sort
@@ -66,14 +158,22 @@ namespace pika::parallel::detail {
     /// \param [in] comp : object for to compare two elements
     /// \param [in] nthread : define the number of threads to use
     ///                  in the process. By default is the number of thread HW
+    /// \param [in] ws : workspace providing the temporary buffer and the
+    ///                  bookkeeping of the sample sort, may be nullptr
+    /// \param [in] res : memory resource the temporary buffer is allocated
+    ///                  from if no workspace is given, the default scratch
+    ///                  arena if nullptr
     template <typename Iter, typename Sent, typename Compare>
     parallel_stable_sort_helper<Iter, Sent,
         Compare>::parallel_stable_sort_helper(Iter first, Sent last,
-        Compare comp)
+        Compare comp, sort_workspace<value_type>* ws,
+        pika::execution::scratch_resource* res)
       : range_initial(first, last)
       , comp(comp)
       , nelem(range_initial.size())
       , ptr(nullptr)
+      , workspace(ws)
+      , resource(res != nullptr ? res : &default_scratch_resource())
     {
         PIKA_ASSERT(range_initial.size() >= 0);
     }
@@ -90,7 +190,17 @@ namespace pika::parallel::detail {
 
             if (nelem < chunk_size || nthreads < 2)
             {
-                spin_sort(range_initial.begin(), range_initial.end(), comp);
+                if (workspace != nullptr)
+                {
+                    value_type* aux = workspace->buffer(nptr);
+                    spin_sort(range_initial.begin(), range_initial.end(), comp,
+                        range<value_type*>(aux, aux + nptr));
+                }
+                else
+                {
+                    spin_sort(range_initial.begin(), range_initial.end(), comp,
+                        *resource);
+                }
                 return last;
             }
 
@@ -102,30 +212,74 @@ namespace pika::parallel::detail {
 
             // leave memory uninitialized, sample_sort will manage construction
             // etc.
-            ptr = static_cast<value_type*>(
-                std::malloc(sizeof(value_type) * nptr));
-            if (ptr == nullptr)
+            std::uint32_t oversampling = sample_sort_oversampling;
+            sample_sort_scratch<Iter, Iter>* scratch = nullptr;
+            if (workspace != nullptr)
+            {
+                ptr = workspace->buffer(nptr);
+                if (workspace->oversampling() != 0)
+                {
+                    oversampling = workspace->oversampling();
+                }
+                scratch = &workspace->template scratch<
+                    sample_sort_scratch<Iter, Iter>>();
+            }
+            else
             {
-                throw std::bad_alloc();
+                ptr = static_cast<value_type*>(resource->allocate(
+                    sizeof(value_type) * nptr, alignof(value_type)));
             }
 
             // Parallel Process
-            range<Iter, Sent> range_first(
-                range_initial.begin(), range_initial.begin() + nptr);
-            range<Iter, Sent> range_second(
-                range_initial.begin() + nptr, range_initial.end());
-            range<value_type*> range_buffer(ptr, ptr + nptr);
+            Iter first = range_initial.begin();
+            Iter middle = first + nptr;
+            std::size_t const nsecond = nelem - nptr;
+
+            sample_sort(exec, first, middle, comp, nthreads, ptr, nptr,
+                chunk_size, oversampling, scratch, resource);
+
+            sample_sort(exec, middle, last, comp, nthreads, ptr, nptr,
+                chunk_size, oversampling, scratch, resource);
+
+            // Merge the sorted halves, split into segments along the merge
+            // path. The segments are independent only if no source overlaps
+            // the destination. After moving the first half to the buffer this
+            // holds for the first nptr elements of the result. The second
+            // half elements not merged by then fit into the part of the
+            // buffer already merged, after moving them there the rest of the
+            // result is merged from the buffer only.
+            std::uint32_t const nsegments =
+                static_cast<std::uint32_t>((std::min)(
+                    std::size_t(nthreads) *
+                        stable_sort_merge_segments_per_thread,
+                    (std::max)(
+                        nelem / (std::max)(chunk_size, std::size_t(1)),
+                        std::size_t(1))));
+
+            bulk_execute_n(exec, nsegments, [&](std::uint32_t i) {
+                std::size_t const begin = nptr * i / nsegments;
+                std::size_t const end = nptr * (i + 1) / nsegments;
+                uninit_move(ptr + begin, first + begin, first + end);
+            });
+            construct = true;
 
-            sample_sort(exec, range_initial.begin(),
-                range_initial.begin() + nptr, comp, nthreads, range_buffer,
-                chunk_size);
+            std::size_t const nmerged =
+                merge_path_split(ptr, nptr, middle, nsecond, nptr, comp);
+            parallel_merge_path(exec, nsegments, ptr, nmerged, middle,
+                nptr - nmerged, first, comp);
 
-            sample_sort(exec, range_initial.begin() + nptr, range_initial.end(),
-                comp, nthreads, range_buffer, chunk_size);
+            Iter rest = middle + (nptr - nmerged);
+            std::size_t const nrest = nsecond - (nptr - nmerged);
+            bulk_execute_n(exec, nsegments, [&](std::uint32_t i) {
+                std::size_t const begin = nrest * i / nsegments;
+                std::size_t const end = nrest * (i + 1) / nsegments;
+                init_move(ptr + begin, rest + begin, rest + end);
+            });
+            parallel_merge_path(exec, nsegments, ptr + nmerged, nptr - nmerged,
+                ptr, nrest, middle, comp);
 
-            range_buffer = init_move(range_buffer, range_first);
-            range_initial =
-                half_merge(range_initial, range_buffer, range_second, comp);
+            construct = false;
+            destroy_range(range<value_type*>(ptr, ptr + nptr));
 
             return last;
         }
@@ -145,13 +299,16 @@ namespace pika::parallel::detail {
 
     template <typename Exec, typename Iter, typename Sent, typename Compare>
     Iter parallel_stable_sort(Exec&& exec, Iter first, Sent last,
-        std::size_t cores, std::size_t chunk_size, Compare&& comp)
+        std::size_t cores, std::size_t chunk_size, Compare&& comp,
+        sort_workspace<typename std::iterator_traits<Iter>::value_type>*
+            workspace = nullptr,
+        pika::execution::scratch_resource* resource = nullptr)
     {
         using parallel_stable_sort_helper_t =
             parallel_stable_sort_helper<Iter, Sent, std::decay_t<Compare>>;
 
         parallel_stable_sort_helper_t sorter(
-            first, last, PIKA_FORWARD(Compare, comp));
+            first, last, PIKA_FORWARD(Compare, comp), workspace, resource);
 
         return sorter(PIKA_FORWARD(Exec, exec), cores, chunk_size);
     }
@@ -0,0 +1,181 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/parallel/util/result_types.hpp>
+
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct sequential_replace_t
+      : pika::functional::detail::tag_fallback<sequential_replace_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename Sent, typename T1, typename T2,
+            typename Proj>
+        friend constexpr InIter tag_fallback_invoke(
+            sequential_replace_t<ExPolicy>, InIter first, Sent last,
+            T1 const& old_value, T2 const& new_value, Proj&& proj)
+        {
+            for (/* */; first != last; ++first)
+            {
+                if (PIKA_INVOKE(proj, *first) == old_value)
+                {
+                    *first = new_value;
+                }
+            }
+            return first;
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_replace_t<ExPolicy> sequential_replace =
+        sequential_replace_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIter, typename Sent, typename T1,
+        typename T2, typename Proj>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE InIter sequential_replace(InIter first,
+        Sent last, T1 const& old_value, T2 const& new_value, Proj&& proj)
+    {
+        return sequential_replace_t<ExPolicy>{}(
+            first, last, old_value, new_value, PIKA_FORWARD(Proj, proj));
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct sequential_replace_if_t
+      : pika::functional::detail::tag_fallback<
+            sequential_replace_if_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename Sent, typename F, typename T,
+            typename Proj>
+        friend constexpr InIter tag_fallback_invoke(
+            sequential_replace_if_t<ExPolicy>, InIter first, Sent last, F&& f,
+            T const& new_value, Proj&& proj)
+        {
+            for (/* */; first != last; ++first)
+            {
+                if (PIKA_INVOKE(f, PIKA_INVOKE(proj, *first)))
+                {
+                    *first = new_value;
+                }
+            }
+            return first;
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_replace_if_t<ExPolicy> sequential_replace_if =
+        sequential_replace_if_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIter, typename Sent, typename F,
+        typename T, typename Proj>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE InIter sequential_replace_if(
+        InIter first, Sent last, F&& f, T const& new_value, Proj&& proj)
+    {
+        return sequential_replace_if_t<ExPolicy>{}(first, last,
+            PIKA_FORWARD(F, f), new_value, PIKA_FORWARD(Proj, proj));
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct sequential_replace_copy_t
+      : pika::functional::detail::tag_fallback<
+            sequential_replace_copy_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename Sent, typename OutIter, typename T,
+            typename Proj>
+        friend constexpr in_out_result<InIter, OutIter> tag_fallback_invoke(
+            sequential_replace_copy_t<ExPolicy>, InIter first, Sent last,
+            OutIter dest, T const& old_value, T const& new_value, Proj&& proj)
+        {
+            for (/* */; first != last; (void) ++first, ++dest)
+            {
+                if (PIKA_INVOKE(proj, *first) == old_value)
+                {
+                    *dest = new_value;
+                }
+                else
+                {
+                    *dest = *first;
+                }
+            }
+            return in_out_result<InIter, OutIter>{first, dest};
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_replace_copy_t<ExPolicy>
+        sequential_replace_copy = sequential_replace_copy_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIter, typename Sent,
+        typename OutIter, typename T, typename Proj>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE in_out_result<InIter, OutIter>
+    sequential_replace_copy(InIter first, Sent last, OutIter dest,
+        T const& old_value, T const& new_value, Proj&& proj)
+    {
+        return sequential_replace_copy_t<ExPolicy>{}(first, last, dest,
+            old_value, new_value, PIKA_FORWARD(Proj, proj));
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct sequential_replace_copy_if_t
+      : pika::functional::detail::tag_fallback<
+            sequential_replace_copy_if_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename Sent, typename OutIter, typename F,
+            typename T, typename Proj>
+        friend constexpr in_out_result<InIter, OutIter> tag_fallback_invoke(
+            sequential_replace_copy_if_t<ExPolicy>, InIter first, Sent last,
+            OutIter dest, F&& f, T const& new_value, Proj&& proj)
+        {
+            for (/* */; first != last; (void) ++first, ++dest)
+            {
+                if (PIKA_INVOKE(f, PIKA_INVOKE(proj, *first)))
+                {
+                    *dest = new_value;
+                }
+                else
+                {
+                    *dest = *first;
+                }
+            }
+            return in_out_result<InIter, OutIter>{first, dest};
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_replace_copy_if_t<ExPolicy>
+        sequential_replace_copy_if = sequential_replace_copy_if_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIter, typename Sent,
+        typename OutIter, typename F, typename T, typename Proj>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE in_out_result<InIter, OutIter>
+    sequential_replace_copy_if(InIter first, Sent last, OutIter dest, F&& f,
+        T const& new_value, Proj&& proj)
+    {
+        return sequential_replace_copy_if_t<ExPolicy>{}(first, last, dest,
+            PIKA_FORWARD(F, f), new_value, PIKA_FORWARD(Proj, proj));
+    }
+#endif
+}    // namespace pika::parallel::detail
@@ -17,12 +17,12 @@
 #include <pika/parallel/util/merge_four.hpp>
 #include <pika/parallel/util/merge_vector.hpp>
 #include <pika/parallel/util/range.hpp>
+#include <pika/parallel/util/scratch_memory.hpp>
 
 #include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
-#include <cstdlib>
 #include <functional>
 #include <iterator>
 #include <memory>
@@ -36,6 +36,34 @@
 namespace pika::parallel::detail {
     static constexpr std::uint32_t sample_sort_limit_per_task = (1 << 16);
 
+    // Number of intervals each thread's part of the sequence is split into,
+    // more intervals balance the final merge better but make the sampling and
+    // the bookkeeping more expensive.
+    static constexpr std::uint32_t sample_sort_oversampling = 8;
+
+    /// \struct sample_sort_scratch
+    /// \brief The bookkeeping of a sample sort. It may be kept across sorts
+    ///        of the same iterator type, in which case the vectors keep
+    ///        their capacity and steady state sorting does not allocate.
+    template <typename Iter, typename Sent>
+    struct sample_sort_scratch
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using range_it = range<Iter, Sent>;
+        using range_buf = range<value_type*>;
+
+        std::vector<std::vector<range_it>> vv_range_it;
+        std::vector<std::vector<range_buf>> vv_range_buf;
+        std::vector<range_it> vrange_it_ini;
+        std::vector<range_buf> vrange_buf_ini;
+
+        std::vector<range_it> vmem_thread;
+        std::vector<range_buf> vbuf_thread;
+        std::vector<Iter> vsample;
+        std::vector<Iter> vmilestone;
+        std::vector<std::vector<range<Iter>>> vv_range_first;
+    };
+
     /// \struct sample_sort
     /// \brief This a structure for to implement a sample sort, exception
     ///        safe
@@ -50,16 +78,20 @@ namespace pika::parallel::detail {
 
         std::uint32_t nthreads;
         std::uint32_t nintervals;
+        std::uint32_t oversampling;
         bool construct = false;
         bool owner = false;
         Compare comp;
         range_it global_range;
         range_buf global_buf;
-
-        std::vector<std::vector<range_it>> vv_range_it;
-        std::vector<std::vector<range_buf>> vv_range_buf;
-        std::vector<range_it> vrange_it_ini;
-        std::vector<range_buf> vrange_buf_ini;
+        pika::execution::scratch_resource* resource;
+
+        sample_sort_scratch<Iter, Sent> own_scratch;
+        sample_sort_scratch<Iter, Sent>& scratch;
+        std::vector<std::vector<range_it>>& vv_range_it;
+        std::vector<std::vector<range_buf>>& vv_range_buf;
+        std::vector<range_it>& vrange_it_ini;
+        std::vector<range_buf>& vrange_buf_ini;
         std::atomic<std::uint32_t> njob;
 
         template <typename Exec>
@@ -75,7 +107,15 @@ namespace pika::parallel::detail {
         /// \param [in] comp : object for to Compare two elements
         /// \param [in] nthreads : define the number of threads to use
         ///              in the process. By default is the number of thread HW
-        sample_sort_helper(Compare cmp, std::uint32_t num_threads);
+        /// \param [in] num_intervals : number of intervals per thread
+        /// \param [in] reused_scratch : bookkeeping to reuse, nullptr if the
+        ///              sort should use its own
+        /// \param [in] res : memory resource the temporary buffers are
+        ///              allocated from, the default scratch arena if nullptr
+        sample_sort_helper(Compare cmp, std::uint32_t num_threads,
+            std::uint32_t num_intervals = sample_sort_oversampling,
+            sample_sort_scratch<Iter, Sent>* reused_scratch = nullptr,
+            pika::execution::scratch_resource* res = nullptr);
 
         /// \brief destructor of the typename. The utility is to destroy the
         ///        temporary buffer used in the sorting process
@@ -148,14 +188,28 @@ namespace pika::parallel::detail {
     /// \param [in] comp : object for to Compare two elements
     /// \param [in] nthreads : nthreads object for to define the number of threads
     ///            to use in the process. By default is the number of thread HW
+    /// \param [in] num_intervals : number of intervals per thread
+    /// \param [in] reused_scratch : bookkeeping to reuse, nullptr if the sort
+    ///            should use its own
+    /// \param [in] res : memory resource the temporary buffers are allocated
+    ///            from, the default scratch arena if nullptr
     template <typename Iter, typename Sent, typename Compare>
-    sample_sort_helper<Iter, Sent, Compare>::sample_sort_helper(
-        Compare cmp, std::uint32_t num_threads)
+    sample_sort_helper<Iter, Sent, Compare>::sample_sort_helper(Compare cmp,
+        std::uint32_t num_threads, std::uint32_t num_intervals,
+        sample_sort_scratch<Iter, Sent>* reused_scratch,
+        pika::execution::scratch_resource* res)
       : nthreads(num_threads)
+      , oversampling(num_intervals != 0 ? num_intervals : 1)
       , construct(false)
       , owner(false)
       , comp(cmp)
       , global_buf(nullptr, nullptr)
+      , resource(res != nullptr ? res : &default_scratch_resource())
+      , scratch(reused_scratch != nullptr ? *reused_scratch : own_scratch)
+      , vv_range_it(scratch.vv_range_it)
+      , vv_range_buf(scratch.vv_range_buf)
+      , vrange_it_ini(scratch.vrange_it_ini)
+      , vrange_buf_ini(scratch.vrange_buf_ini)
       , njob(0)
     {
     }
@@ -174,16 +228,16 @@ namespace pika::parallel::detail {
         // Adjust when there are many threads and only a few elements
         while (nelem > chunk_size &&
             (static_cast<std::uint64_t>(nthreads) *
-                static_cast<std::uint64_t>(nthreads)) > (nelem >> 3))
+                static_cast<std::uint64_t>(nthreads)) > (nelem / oversampling))
         {
             nthreads /= 2;
         }
 
-        nintervals = (nthreads << 3);
+        nintervals = nthreads * oversampling;
 
         if (nthreads < 2 || nelem <= chunk_size)
         {
-            spin_sort(first, last, comp);
+            spin_sort(first, last, comp, *resource);
             return;
         }
 
@@ -201,12 +255,8 @@ namespace pika::parallel::detail {
         else
         {
             // acquire uninitialized memory
-            value_type* ptr = static_cast<value_type*>(
-                std::malloc(sizeof(value_type) * nelem));
-            if (ptr == nullptr)
-            {
-                throw std::bad_alloc();
-            }
+            value_type* ptr = static_cast<value_type*>(resource->allocate(
+                sizeof(value_type) * nelem, alignof(value_type)));
             global_buf = range_buf(ptr, ptr + nelem);
             owner = true;
         }
@@ -230,7 +280,8 @@ namespace pika::parallel::detail {
 
         if (owner)
         {
-            std::free(global_buf.begin());
+            resource->deallocate(global_buf.begin(),
+                sizeof(value_type) * global_buf.size(), alignof(value_type));
         }
     }
 
@@ -265,8 +316,11 @@ namespace pika::parallel::detail {
     void
     sample_sort_helper<Iter, Sent, Compare>::initial_configuration(Exec& exec)
     {
-        std::vector<range_it> vmem_thread;
-        std::vector<range_buf> vbuf_thread;
+        std::vector<range_it>& vmem_thread = scratch.vmem_thread;
+        std::vector<range_buf>& vbuf_thread = scratch.vbuf_thread;
+        vmem_thread.clear();
+        vbuf_thread.clear();
+
         std::size_t nelem = global_range.size();
 
         std::size_t chunk_size = nelem / nthreads;
@@ -298,7 +352,8 @@ namespace pika::parallel::detail {
             .get();
 
         // Obtain the vector of milestones
-        std::vector<Iter> vsample;
+        std::vector<Iter>& vsample = scratch.vsample;
+        vsample.clear();
         vsample.reserve(nthreads * (nintervals - 1));
 
         for (std::uint32_t i = 0; i < nthreads; ++i)
@@ -312,10 +367,11 @@ namespace pika::parallel::detail {
         }
 
         using compare_ptr = less_ptr_no_null<Iter, Compare>;
-        spin_sort(vsample.begin(), vsample.end(), compare_ptr(comp));
+        spin_sort(vsample.begin(), vsample.end(), compare_ptr(comp), *resource);
 
         // Create the final milestone vector
-        std::vector<Iter> vmilestone;
+        std::vector<Iter>& vmilestone = scratch.vmilestone;
+        vmilestone.clear();
         vmilestone.reserve(nintervals);
 
         for (std::uint32_t pos = nthreads >> 1; pos < vsample.size();
@@ -325,10 +381,17 @@ namespace pika::parallel::detail {
         }
 
         // Creation of the first vector of ranges
-        std::vector<std::vector<range<Iter>>> vv_range_first(nthreads);
+        std::vector<std::vector<range<Iter>>>& vv_range_first =
+            scratch.vv_range_first;
+        if (vv_range_first.size() < nthreads)
+        {
+            vv_range_first.resize(nthreads);
+        }
 
         for (std::uint32_t i = 0; i < nthreads; ++i)
         {
+            vv_range_first[i].clear();
+
             Iter itaux = vmem_thread[i].begin();
             for (std::uint32_t k = 0; k < (nintervals - 1); ++k)
             {
@@ -342,13 +405,22 @@ namespace pika::parallel::detail {
         }
 
         // Copy in buffer and creation of the final matrix of ranges
-        vv_range_it.resize(nintervals);
-        vv_range_buf.resize(nintervals);
+        // the vectors are only ever grown, which keeps the capacity of the
+        // inner vectors when the scratch is reused
+        if (vv_range_it.size() < nintervals)
+        {
+            vv_range_it.resize(nintervals);
+            vv_range_buf.resize(nintervals);
+        }
+        vrange_it_ini.clear();
+        vrange_buf_ini.clear();
         vrange_it_ini.reserve(nintervals);
         vrange_buf_ini.reserve(nintervals);
 
         for (std::uint32_t i = 0; i < nintervals; ++i)
         {
+            vv_range_it[i].clear();
+            vv_range_buf[i].clear();
             vv_range_it[i].reserve(nthreads);
             vv_range_buf[i].reserve(nthreads);
         }
@@ -383,12 +455,16 @@ namespace pika::parallel::detail {
         typename Value>
     void sample_sort(Exec&& exec, Iter first, Sent last, Compare&& comp,
         std::uint32_t num_threads, Value* paux, std::size_t naux,
-        std::size_t chunk_size)
+        std::size_t chunk_size,
+        std::uint32_t oversampling = sample_sort_oversampling,
+        sample_sort_scratch<Iter, Sent>* scratch = nullptr,
+        pika::execution::scratch_resource* resource = nullptr)
     {
         using sample_sort_helper_t =
             sample_sort_helper<Iter, Sent, std::decay_t<Compare>>;
 
-        sample_sort_helper_t sorter(PIKA_FORWARD(Compare, comp), num_threads);
+        sample_sort_helper_t sorter(PIKA_FORWARD(Compare, comp), num_threads,
+            oversampling, scratch, resource);
         sorter(PIKA_FORWARD(Exec, exec), first, last, paux, naux, chunk_size);
     }
 
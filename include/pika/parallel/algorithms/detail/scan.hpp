@@ -0,0 +1,134 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+#include <pika/functional/invoke.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Sequential inclusive scan over count elements, used as the per-chunk
+    // kernel (step 1) of the parallel scan algorithms. Returns the value
+    // accumulated over the whole chunk.
+    template <typename ExPolicy>
+    struct sequential_inclusive_scan_n_t
+      : pika::functional::detail::tag_fallback<
+            sequential_inclusive_scan_n_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename OutIter, typename T, typename Op>
+        friend constexpr T tag_fallback_invoke(
+            sequential_inclusive_scan_n_t<ExPolicy>, InIter first,
+            std::size_t count, OutIter dest, T init, Op&& op)
+        {
+            for (/* */; count-- != 0; (void) ++first, ++dest)
+            {
+                init = PIKA_INVOKE(op, init, *first);
+                *dest = init;
+            }
+            return init;
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_inclusive_scan_n_t<ExPolicy>
+        sequential_inclusive_scan_n =
+            sequential_inclusive_scan_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIter, typename OutIter, typename T,
+        typename Op>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE T sequential_inclusive_scan_n(
+        InIter first, std::size_t count, OutIter dest, T init, Op&& op)
+    {
+        return sequential_inclusive_scan_n_t<ExPolicy>{}(
+            first, count, dest, PIKA_MOVE(init), PIKA_FORWARD(Op, op));
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sequential exclusive scan over count elements, used as the per-chunk
+    // kernel (step 1) of the parallel scan algorithms. Returns the value
+    // accumulated over the whole chunk (including the last element).
+    template <typename ExPolicy>
+    struct sequential_exclusive_scan_n_t
+      : pika::functional::detail::tag_fallback<
+            sequential_exclusive_scan_n_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename OutIter, typename T, typename Op>
+        friend constexpr T tag_fallback_invoke(
+            sequential_exclusive_scan_n_t<ExPolicy>, InIter first,
+            std::size_t count, OutIter dest, T init, Op&& op)
+        {
+            T temp = init;
+            for (/* */; count-- != 0; (void) ++first, ++dest)
+            {
+                init = PIKA_INVOKE(op, init, *first);
+                *dest = temp;
+                temp = init;
+            }
+            return init;
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_exclusive_scan_n_t<ExPolicy>
+        sequential_exclusive_scan_n =
+            sequential_exclusive_scan_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIter, typename OutIter, typename T,
+        typename Op>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE T sequential_exclusive_scan_n(
+        InIter first, std::size_t count, OutIter dest, T init, Op&& op)
+    {
+        return sequential_exclusive_scan_n_t<ExPolicy>{}(
+            first, count, dest, PIKA_MOVE(init), PIKA_FORWARD(Op, op));
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Combines the partition offset computed by step 2 of the parallel scan
+    // algorithms with each of the count already scanned elements (step 3).
+    template <typename ExPolicy>
+    struct sequential_scan_offset_n_t
+      : pika::functional::detail::tag_fallback<
+            sequential_scan_offset_n_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename T, typename Op>
+        friend constexpr Iter tag_fallback_invoke(
+            sequential_scan_offset_n_t<ExPolicy>, Iter first,
+            std::size_t count, T const& val, Op&& op)
+        {
+            for (/* */; count-- != 0; ++first)
+            {
+                *first = PIKA_INVOKE(op, val, *first);
+            }
+            return first;
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_scan_offset_n_t<ExPolicy>
+        sequential_scan_offset_n = sequential_scan_offset_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename T, typename Op>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE Iter sequential_scan_offset_n(
+        Iter first, std::size_t count, T const& val, Op&& op)
+    {
+        return sequential_scan_offset_n_t<ExPolicy>{}(
+            first, count, val, PIKA_FORWARD(Op, op));
+    }
+#endif
+}    // namespace pika::parallel::detail
@@ -17,6 +17,7 @@
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/partitioner.hpp>
+#include <pika/parallel/util/scratch_memory.hpp>
 #include <pika/type_support/unused.hpp>
 
 #include <algorithm>
@@ -36,7 +37,7 @@ namespace pika::parallel::detail {
         class rewritable_ref
         {
         public:
-            constexpr rewritable_ref()
+            constexpr rewritable_ref() noexcept
               : item_(0)
             {
             }
@@ -107,8 +108,8 @@ namespace pika::parallel::detail {
 
         std::size_t step = (len1 + cores - 1) / cores;
 
-        std::shared_ptr<buffer_type[]> buffer(
-            new buffer_type[combiner(len1, len2)]);
+        std::shared_ptr<buffer_type[]> buffer =
+            make_scratch_array<buffer_type>(policy, combiner(len1, len2));
         std::shared_ptr<set_chunk_data[]> chunks(new set_chunk_data[cores]);
 
         // first step, is applied to all partitions
@@ -12,10 +12,10 @@
 #include <pika/parallel/algorithms/detail/is_sorted.hpp>
 #include <pika/parallel/util/nbits.hpp>
 #include <pika/parallel/util/range.hpp>
+#include <pika/parallel/util/scratch_memory.hpp>
 
 #include <cstddef>
 #include <cstdint>
-#include <cstdlib>
 #include <functional>
 #include <iterator>
 #include <memory>
@@ -79,21 +79,28 @@ namespace pika::parallel::detail {
 
         value_type* ptr;
         std::size_t nptr;
+        pika::execution::scratch_resource* resource;
         bool construct = false;
         bool owner = false;
 
         /// \brief constructor of the struct
         /// \param [in] R : range of elements to sort
         /// \param [in] comp : object for to compare two elements
+        /// \param [in] res : memory resource the buffer is allocated from if
+        ///                   paux is nullptr, the default scratch arena if
+        ///                   nullptr
         spin_sort_helper(Iter first, Sent last, Compare comp, value_type* paux,
-            std::size_t naux);
+            std::size_t naux, pika::execution::scratch_resource* res = nullptr);
 
     public:
         /// \brief constructor of the struct
         /// \param [in] r_input : range of elements to sort
         /// \param [in] comp : object for to Compare two elements
-        spin_sort_helper(Iter first, Sent last, Compare comp = Compare())
-          : spin_sort_helper(first, last, comp, nullptr, 0)
+        /// \param [in] res : memory resource the buffer is allocated from,
+        ///                   the default scratch arena if nullptr
+        spin_sort_helper(Iter first, Sent last, Compare comp = Compare(),
+            pika::execution::scratch_resource* res = nullptr)
+          : spin_sort_helper(first, last, comp, nullptr, 0, res)
         {
         }
 
@@ -123,7 +130,8 @@ namespace pika::parallel::detail {
 
             if (owner)
             {
-                std::free(ptr);
+                resource->deallocate(
+                    ptr, nptr * sizeof(value_type), alignof(value_type));
             }
         }
     };    // End of class spin_sort_helper
@@ -133,9 +141,11 @@ namespace pika::parallel::detail {
     /// \param [in] comp : object for to Compare two elements
     template <typename Iter, typename Sent, typename Compare>
     spin_sort_helper<Iter, Sent, Compare>::spin_sort_helper(
-        Iter first, Sent last, Compare comp, value_type* paux, std::size_t naux)
+        Iter first, Sent last, Compare comp, value_type* paux, std::size_t naux,
+        pika::execution::scratch_resource* res)
       : ptr(paux)
       , nptr(naux)
+      , resource(res != nullptr ? res : &default_scratch_resource())
       , construct(false)
       , owner(false)
     {
@@ -161,12 +171,8 @@ namespace pika::parallel::detail {
         if (ptr == nullptr)
         {
             // acquire uninitialized memory
-            ptr = static_cast<value_type*>(
-                std::malloc(nptr * sizeof(value_type)));
-            if (ptr == nullptr)
-            {
-                throw std::bad_alloc();
-            }
+            ptr = static_cast<value_type*>(resource->allocate(
+                nptr * sizeof(value_type), alignof(value_type)));
             owner = true;
         }
 
@@ -226,6 +232,14 @@ namespace pika::parallel::detail {
             first, last, PIKA_FORWARD(Compare, comp));
     }
 
+    template <typename Iter, typename Sent, typename Compare>
+    void spin_sort(Iter first, Sent last, Compare&& comp,
+        pika::execution::scratch_resource& resource)
+    {
+        spin_sort_helper<Iter, Sent, std::decay_t<Compare>> sorter(
+            first, last, PIKA_FORWARD(Compare, comp), &resource);
+    }
+
     template <typename Iter, typename Sent, typename Compare>
     void spin_sort(Iter first, Sent last, Compare&& comp,
         range<typename std::iterator_traits<Iter>::value_type*> range_aux)
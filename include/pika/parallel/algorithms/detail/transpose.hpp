@@ -0,0 +1,112 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/functional/detail/tag_fallback_invoke.hpp>
+
+#include <cstddef>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Blocks of at most transpose_leaf_size x transpose_leaf_size elements
+    // are transposed directly, both the rows read and the columns written
+    // by such a block fit into the L1 cache for all arithmetic types.
+    inline constexpr std::size_t transpose_leaf_size = 32;
+
+    // Larger blocks are split close to their middle, at a multiple of the
+    // widest vector pack, to keep the tiles of the vectorized leaves whole.
+    inline constexpr std::size_t transpose_split_multiple = 16;
+
+    constexpr std::size_t transpose_split(std::size_t n) noexcept
+    {
+        return (n / 2 + transpose_split_multiple - 1) /
+            transpose_split_multiple * transpose_split_multiple;
+    }
+
+    // dest[j * dest_stride + i] = src[i * src_stride + j] for all i in
+    // [0, rows) and j in [0, cols).
+    template <typename RandIter1, typename RandIter2>
+    void transpose_block_loop(RandIter1 src, std::size_t src_stride,
+        std::size_t rows, std::size_t cols, RandIter2 dest,
+        std::size_t dest_stride)
+    {
+        for (std::size_t i = 0; i != rows; ++i)
+        {
+            for (std::size_t j = 0; j != cols; ++j)
+            {
+                dest[j * dest_stride + i] = src[i * src_stride + j];
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct sequential_transpose_block_t
+      : pika::functional::detail::tag_fallback<
+            sequential_transpose_block_t<ExPolicy>>
+    {
+    private:
+        template <typename RandIter1, typename RandIter2>
+        friend inline void tag_fallback_invoke(
+            sequential_transpose_block_t<ExPolicy>, RandIter1 src,
+            std::size_t src_stride, std::size_t rows, std::size_t cols,
+            RandIter2 dest, std::size_t dest_stride)
+        {
+            transpose_block_loop(
+                src, src_stride, rows, cols, dest, dest_stride);
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_transpose_block_t<ExPolicy>
+        sequential_transpose_block = sequential_transpose_block_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename RandIter1, typename RandIter2>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE void sequential_transpose_block(
+        RandIter1 src, std::size_t src_stride, std::size_t rows,
+        std::size_t cols, RandIter2 dest, std::size_t dest_stride)
+    {
+        sequential_transpose_block_t<ExPolicy>{}(
+            src, src_stride, rows, cols, dest, dest_stride);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Cache-oblivious transpose of the rows x cols block starting at src:
+    // the longer side is halved until the block is a leaf, so that all
+    // levels of the memory hierarchy see blocks that fit without knowing
+    // their sizes.
+    template <typename ExPolicy, typename RandIter1, typename RandIter2>
+    void transpose_recursive(RandIter1 src, std::size_t src_stride,
+        std::size_t rows, std::size_t cols, RandIter2 dest,
+        std::size_t dest_stride)
+    {
+        if (rows <= transpose_leaf_size && cols <= transpose_leaf_size)
+        {
+            sequential_transpose_block<ExPolicy>(
+                src, src_stride, rows, cols, dest, dest_stride);
+        }
+        else if (rows >= cols)
+        {
+            std::size_t const half = transpose_split(rows);
+            transpose_recursive<ExPolicy>(
+                src, src_stride, half, cols, dest, dest_stride);
+            transpose_recursive<ExPolicy>(src + half * src_stride,
+                src_stride, rows - half, cols, dest + half, dest_stride);
+        }
+        else
+        {
+            std::size_t const half = transpose_split(cols);
+            transpose_recursive<ExPolicy>(
+                src, src_stride, rows, half, dest, dest_stride);
+            transpose_recursive<ExPolicy>(src + half, src_stride, rows,
+                cols - half, dest + half * dest_stride, dest_stride);
+        }
+    }
+}    // namespace pika::parallel::detail
@@ -180,10 +180,11 @@ namespace pika {
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/mismatch.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/util/cancellation_token.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
-#include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
@@ -274,28 +275,16 @@ namespace pika::parallel ::detail {
             }
 
             using zip_iterator = pika::util::zip_iterator<Iter1, Iter2>;
-            using reference = typename zip_iterator::reference;
 
             util::cancellation_token<> tok;
 
-            // Note: replacing the invoke() with PIKA_INVOKE()
-            // below makes gcc generate errors
             auto f1 = [tok, f = PIKA_FORWARD(F, f),
                           proj1 = PIKA_FORWARD(Proj1, proj1),
                           proj2 = PIKA_FORWARD(Proj2, proj2)](zip_iterator it,
                           std::size_t part_count) mutable -> bool {
-                loop_n<std::decay_t<ExPolicy>>(it, part_count, tok,
-                    [&f, &proj1, &proj2, &tok](zip_iterator const& curr) {
-                        reference t = *curr;
-                        if (!pika::util::detail::invoke(f,
-                                pika::util::detail::invoke(
-                                    proj1, std::get<0>(t)),
-                                pika::util::detail::invoke(
-                                    proj2, std::get<1>(t))))
-                        {
-                            tok.cancel();
-                        }
-                    });
+                auto const& iters = it.get_iterator_tuple();
+                sequential_equal_n<std::decay_t<ExPolicy>>(std::get<0>(iters),
+                    std::get<1>(iters), part_count, tok, f, proj1, proj2);
                 return !tok.was_cancelled();
             };
 
@@ -346,19 +335,14 @@ namespace pika::parallel ::detail {
             difference_type count = std::distance(first1, last1);
 
             using zip_iterator = pika::util::zip_iterator<FwdIter1, FwdIter2>;
-            using reference = typename zip_iterator::reference;
 
             util::cancellation_token<> tok;
             auto f1 = [f, tok](zip_iterator it,
                           std::size_t part_count) mutable -> bool {
-                loop_n<std::decay_t<ExPolicy>>(it, part_count, tok,
-                    [&f, &tok](zip_iterator const& curr) mutable -> void {
-                        reference t = *curr;
-                        if (!PIKA_INVOKE(f, std::get<0>(t), std::get<1>(t)))
-                        {
-                            tok.cancel();
-                        }
-                    });
+                auto const& iters = it.get_iterator_tuple();
+                sequential_equal_n<std::decay_t<ExPolicy>>(std::get<0>(iters),
+                    std::get<1>(iters), part_count, tok, f,
+                    projection_identity{}, projection_identity{});
                 return !tok.was_cancelled();
             };
 
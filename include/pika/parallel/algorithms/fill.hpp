@@ -120,6 +120,7 @@ namespace pika {
 #include <pika/parallel/algorithms/for_each.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/streaming_stores.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -170,9 +171,18 @@ namespace pika::parallel::detail {
                     PIKA_MOVE(first));
             }
 
+            std::size_t const count = detail::distance(first, last);
+            if constexpr (supports_streaming_stores_v<FwdIter, T const&>)
+            {
+                if (use_streaming_stores<FwdIter>(policy, count))
+                {
+                    return streaming_generate_n(PIKA_FORWARD(ExPolicy, policy),
+                        first, count, [val]() { return val; });
+                }
+            }
+
             return for_each_n<FwdIter>().call(PIKA_FORWARD(ExPolicy, policy),
-                first, detail::distance(first, last), fill_iteration<T>{val},
-                projection_identity());
+                first, count, fill_iteration<T>{val}, projection_identity());
         }
     };
     /// \endcond
@@ -200,6 +210,15 @@ namespace pika::parallel::detail {
         static typename algorithm_result<ExPolicy, FwdIter>::type parallel(
             ExPolicy&& policy, FwdIter first, std::size_t count, T const& val)
         {
+            if constexpr (supports_streaming_stores_v<FwdIter, T const&>)
+            {
+                if (use_streaming_stores<FwdIter>(policy, count))
+                {
+                    return streaming_generate_n(PIKA_FORWARD(ExPolicy, policy),
+                        first, count, [val]() { return val; });
+                }
+            }
+
             return for_each_n<FwdIter>().call(
                 PIKA_FORWARD(ExPolicy, policy), first, count,
                 [val](auto& v) -> void { v = val; }, projection_identity());
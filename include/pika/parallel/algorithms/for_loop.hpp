@@ -749,6 +749,7 @@ namespace pika {
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner.hpp>
+#include <pika/parallel/util/prefetching.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -792,13 +793,42 @@ namespace pika {
             (void) _sequencer;
         }
 
-        template <typename... Ts, std::size_t... Is>
+        // Arguments which do work of their own when the loop is done may
+        // take the policy of the loop to run it with.
+        template <typename T, typename ExPolicy, typename Enable = void>
+        struct has_policy_exit_iteration : std::false_type
+        {
+        };
+
+        template <typename T, typename ExPolicy>
+        struct has_policy_exit_iteration<T, ExPolicy,
+            std::void_t<decltype(std::declval<T&>().exit_iteration(
+                std::declval<ExPolicy&>(), std::size_t()))>> : std::true_type
+        {
+        };
+
+        template <typename ExPolicy, typename T>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr void exit_iteration_arg(
+            ExPolicy& policy, T& arg, std::size_t size)
+        {
+            if constexpr (has_policy_exit_iteration<T, ExPolicy>::value)
+            {
+                arg.exit_iteration(policy, size);
+            }
+            else
+            {
+                PIKA_UNUSED(policy);
+                arg.exit_iteration(size);
+            }
+        }
+
+        template <typename ExPolicy, typename... Ts, std::size_t... Is>
         PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr void
-        exit_iteration(std::tuple<Ts...>& args,
+        exit_iteration(ExPolicy& policy, std::tuple<Ts...>& args,
             pika::util::detail::index_pack<Is...>, std::size_t size) noexcept
         {
-            int const _sequencer[] = {
-                0, (std::get<Is>(args).exit_iteration(size), 0)...};
+            int const _sequencer[] = {0,
+                (exit_iteration_arg(policy, std::get<Is>(args), size), 0)...};
             (void) _sequencer;
         }
 
@@ -1016,8 +1046,8 @@ namespace pika {
             template <typename ExPolicy, typename InIter, typename Size,
                 typename S, typename F, typename Arg, typename... Args>
             PIKA_HOST_DEVICE static constexpr pika::util::detail::unused_type
-            sequential(ExPolicy&&, InIter first, Size size, S stride, F&& f,
-                Arg&& arg, Args&&... args)
+            sequential(ExPolicy&& policy, InIter first, Size size, S stride,
+                F&& f, Arg&& arg, Args&&... args)
             {
                 int const init_sequencer[] = {
                     (arg.init_iteration(0), 0), (args.init_iteration(0), 0)...};
@@ -1062,8 +1092,9 @@ namespace pika {
                 }
 
                 // make sure live-out variables are properly set on return
-                int const exit_sequencer[] = {(arg.exit_iteration(size), 0),
-                    (args.exit_iteration(size), 0)...};
+                int const exit_sequencer[] = {
+                    (exit_iteration_arg(policy, arg, size), 0),
+                    (exit_iteration_arg(policy, args, size), 0)...};
                 (void) exit_sequencer;
 
                 return pika::util::detail::unused_type();
@@ -1115,7 +1146,7 @@ namespace pika {
                                     sizeof...(Ts)>::type();
                             // make sure live-out variables are properly set on
                             // return
-                            exit_iteration(args, pack, size);
+                            exit_iteration(policy, args, pack, size);
                         });
                 }
             }
@@ -1144,6 +1175,15 @@ namespace pika {
                 "Requires at least forward iterator or integral loop "
                 "boundaries.");
 
+            // prefetching iterators are iterated chunk by chunk
+            if constexpr (is_prefetching_iterator_v<B>)
+            {
+                static_assert(sizeof...(Args) == 1,
+                    "for_loop does not support induction or reduction objects "
+                    "with prefetching iterators");
+                PIKA_ASSERT(stride == 1);
+            }
+
             std::size_t size = (distance) (first, last);
             auto&& t = std::forward_as_tuple(PIKA_FORWARD(Args, args)...);
 
@@ -12,15 +12,23 @@
 #include <pika/assert.hpp>
 #include <pika/concurrency/cache_line_data.hpp>
 #include <pika/execution/detail/execution_parameter_callbacks.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/threading_base/thread_num_tss.hpp>
+#include <pika/type_support/unused.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
 #include <functional>
+#include <iterator>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace pika {
     namespace parallel::detail {
@@ -70,6 +78,169 @@ namespace pika {
                 data_;
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Rng>
+        using reduction_span_value_t = std::remove_pointer_t<decltype(
+            std::data(std::declval<Rng&>()))>;
+
+        // Below this number of element-wise combinations the views of an
+        // array reduction are combined by the calling thread
+        inline constexpr std::size_t reduction_span_combine_threshold = 65536;
+
+        template <typename T, typename Op>
+        struct reduction_span_helper
+        {
+            template <typename Op_>
+            reduction_span_helper(
+                T* var, std::size_t size, T const& identity, Op_&& op)
+              : data_(std::make_shared<shared_state>(
+                    var, size, identity, PIKA_FORWARD(Op_, op)))
+            {
+            }
+
+            // views are created only on the worker threads which run
+            // iterations of the loop
+            void init_iteration(std::size_t)
+            {
+                std::size_t const thread = pika::get_worker_thread_num();
+                PIKA_ASSERT(thread < data_->views_.size());
+
+                T*& view = data_->views_[thread].data_;
+                if (view == nullptr)
+                {
+                    view = data_->create_view();
+                }
+            }
+
+            T* iteration_value() const
+            {
+                return data_->views_[pika::get_worker_thread_num()].data_;
+            }
+
+            constexpr void next_iteration() noexcept {}
+
+            // the views are combined with the policy of the loop
+            template <typename ExPolicy>
+            void exit_iteration(ExPolicy& policy, std::size_t /*index*/)
+            {
+                std::vector<T*> views;
+                for (auto& view : data_->views_)
+                {
+                    if (view.data_ != nullptr)
+                    {
+                        views.push_back(view.data_);
+                    }
+                }
+
+                shared_state& data = *data_;
+                auto combine = [&](std::size_t first, std::size_t last) {
+                    for (/* */; first != last; ++first)
+                    {
+                        for (T* view : views)
+                        {
+                            data.var_[first] =
+                                data.op_(data.var_[first], view[first]);
+                        }
+                    }
+                };
+
+                // the views are combined element-wise, disjoint parts of the
+                // array can be combined concurrently
+                if constexpr (pika::is_sequenced_execution_policy_v<
+                                  std::decay_t<ExPolicy>>)
+                {
+                    PIKA_UNUSED(policy);
+                    combine(0, data.size_);
+                }
+                else if (data.size_ * views.size() <
+                    reduction_span_combine_threshold)
+                {
+                    combine(0, data.size_);
+                }
+                else
+                {
+                    using iterator =
+                        pika::util::counting_iterator<std::size_t>;
+
+                    auto combine_policy = policy(pika::execution::non_task);
+                    foreach_partitioner<decltype(combine_policy)>::call(
+                        combine_policy, iterator(0), data.size_,
+                        [&](iterator it, std::size_t size, std::size_t) {
+                            combine(*it, *it + size);
+                        },
+                        [](iterator last) { return last; });
+                }
+
+                data.destroy_views();
+            }
+
+        private:
+            struct shared_state
+            {
+                template <typename Op_>
+                shared_state(
+                    T* var, std::size_t size, T const& identity, Op_&& op)
+                  : var_(var)
+                  , size_(size)
+                  , identity_(identity)
+                  , op_(PIKA_FORWARD(Op_, op))
+                  , views_(pika::parallel::execution::detail::
+                            get_os_thread_count())
+                {
+                }
+
+                ~shared_state()
+                {
+                    destroy_views();
+                }
+
+                // every view starts on a cache line of its own
+                static std::align_val_t alignment() noexcept
+                {
+                    return std::align_val_t((std::max)(alignof(T),
+                        pika::concurrency::detail::get_cache_line_size()));
+                }
+
+                T* create_view()
+                {
+                    T* view = static_cast<T*>(
+                        ::operator new(size_ * sizeof(T), alignment()));
+                    try
+                    {
+                        std::uninitialized_fill_n(view, size_, identity_);
+                    }
+                    catch (...)
+                    {
+                        ::operator delete(view, alignment());
+                        throw;
+                    }
+                    return view;
+                }
+
+                void destroy_views() noexcept
+                {
+                    for (auto& view : views_)
+                    {
+                        if (view.data_ != nullptr)
+                        {
+                            std::destroy_n(view.data_, size_);
+                            ::operator delete(view.data_, alignment());
+                            view.data_ = nullptr;
+                        }
+                    }
+                }
+
+                T* var_;
+                std::size_t size_;
+                T identity_;
+                Op op_;
+                std::vector<pika::concurrency::detail::cache_line_data<T*>>
+                    views_;
+            };
+
+            std::shared_ptr<shared_state> data_;
+        };
+
         /// \endcond
     }    // namespace parallel::detail
 
@@ -131,7 +302,55 @@ namespace pika {
             var, identity, PIKA_FORWARD(Op, combiner));
     }
 
+    /// The function template returns a reduction object for the element-wise
+    /// reduction of the array [var, var + size). It behaves like the object
+    /// returned by \a reduction, except that every view is an array of
+    /// \a size elements, initialized to copies of identity. Views are
+    /// allocated only on the worker threads which execute iterations of the
+    /// algorithm, and are combined element by element on the executor of the
+    /// algorithm, in parallel for large arrays unless the execution policy of
+    /// the algorithm is sequenced.
+    ///
+    /// \tparam T       The element type of the array to be reduced.
+    /// \tparam Op      The type of the binary function (object) used to
+    ///                 perform the reduction operation.
+    ///
+    /// \param var      [in,out] The life-out array to use for the reduction
+    ///                 object. This will hold the reduced values after the
+    ///                 algorithm is finished executing.
+    /// \param size     [in] The number of elements of the array.
+    /// \param identity [in] The identity value to use for the reduction
+    ///                 operation.
+    /// \param combiner [in] The binary function (object) used to perform a
+    ///                 pairwise reduction on the elements.
+    ///
+    /// T shall meet the requirements of CopyConstructible and MoveAssignable.
+    /// The expression var[i] = combiner(var[i], var[i]) shall be well formed.
+    ///
+    /// \returns This returns a reduction object of unspecified type having a
+    ///          value type of \a T*, pointing to the view of the array used
+    ///          by the current iteration.
+    ///
+    template <typename T, typename Op>
+    parallel::detail::reduction_span_helper<T, std::decay_t<Op>>
+    reduction_span(T* var, std::size_t size, T const& identity, Op&& combiner)
+    {
+        return parallel::detail::reduction_span_helper<T, std::decay_t<Op>>(
+            var, size, identity, PIKA_FORWARD(Op, combiner));
+    }
+
     /// \cond NOINTERNAL
+    template <typename Rng, typename Op>
+    parallel::detail::reduction_span_helper<
+        parallel::detail::reduction_span_value_t<Rng>, std::decay_t<Op>>
+    reduction_span(Rng& rng,
+        parallel::detail::reduction_span_value_t<Rng> const& identity,
+        Op&& combiner)
+    {
+        return reduction_span(std::data(rng), std::size(rng), identity,
+            PIKA_FORWARD(Op, combiner));
+    }
+
     template <typename T>
     PIKA_FORCEINLINE constexpr parallel::detail::reduction_helper<T,
         std::plus<T>>
@@ -0,0 +1,816 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/gather.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace pika {
+    // clang-format off
+
+    /// Copies the elements of the sequence starting at \a src selected by
+    /// the indices in the range [map_first, map_last) to the sequence
+    /// starting at \a dest, i.e. assigns src[map_first[i]] to dest[i] for
+    /// every i in [0, map_last - map_first).
+    ///
+    /// \note   Complexity: Performs exactly \a map_last - \a map_first
+    ///         assignments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter1    The type of the iterators of the indices (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam RandIter    The type of the source iterator used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param map_first    Refers to the beginning of the sequence of indices
+    ///                     of the elements to copy.
+    /// \param map_last     Refers to the end of the sequence of indices of the
+    ///                     elements to copy.
+    /// \param src          Refers to the beginning of the sequence the
+    ///                     elements are copied from.
+    /// \param dest         Refers to the beginning of the destination range.
+    ///
+    /// The source element of each assignment is prefetched a few
+    /// assignments ahead. Invoked with \a par_simd or \a simd, contiguous
+    /// sequences of arithmetic elements indexed by integers are gathered a
+    /// vector pack at a time.
+    ///
+    /// The assignments in the parallel \a gather algorithm invoked with an
+    /// execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a gather algorithm invoked with an
+    /// execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a gather algorithm returns a
+    ///           \a pika::future<FwdIter2> if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and
+    ///           returns \a FwdIter2 otherwise.
+    ///           The \a gather algorithm returns the output iterator to the
+    ///           element in the destination range, one past the last element
+    ///           copied.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename RandIter,
+        typename FwdIter2>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter2>::type
+    gather(ExPolicy&& policy, FwdIter1 map_first, FwdIter1 map_last,
+        RandIter src, FwdIter2 dest);
+
+    /// Assigns src[map_first[i]] to dest[i] for every i in
+    /// [0, map_last - map_first) for which \a pred(stencil[i]) returns
+    /// true, the other elements of the destination range are left
+    /// unchanged and their indices are not read.
+    ///
+    /// \note   Complexity: Performs at most \a map_last - \a map_first
+    ///         assignments and exactly \a map_last - \a map_first
+    ///         applications of the predicate \a pred.
+    ///
+    /// \tparam FwdIter2    The type of the iterators of the stencil
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of an forward iterator.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param stencil      Refers to the beginning of the sequence of values
+    ///                     \a pred is applied to.
+    /// \param pred         Specifies the function (or function object) which
+    ///                     selects the elements to copy. The signature of
+    ///                     this predicate should be equivalent to:
+    ///                     \code
+    ///                     bool pred(const Type &a);
+    ///                     \endcode \n
+    ///                     The type \a Type must be such that an object of
+    ///                     type \a FwdIter2 can be dereferenced and then
+    ///                     implicitly converted to Type.
+    ///
+    /// The other parameters and the execution of the assignments are the
+    /// same as for \a gather.
+    ///
+    /// \returns  The \a gather_if algorithm returns a
+    ///           \a pika::future<FwdIter3> if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and
+    ///           returns \a FwdIter3 otherwise.
+    ///           The \a gather_if algorithm returns the output iterator to
+    ///           the element in the destination range, one past the last
+    ///           element considered.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+        typename RandIter, typename FwdIter3, typename Pred>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter3>::type
+    gather_if(ExPolicy&& policy, FwdIter1 map_first, FwdIter1 map_last,
+        FwdIter2 stencil, RandIter src, FwdIter3 dest, Pred&& pred);
+
+    /// Copies the elements in the range [first, last) to the positions of
+    /// the sequence starting at \a dest given by the sequence of indices
+    /// starting at \a map, i.e. assigns first[i] to dest[map[i]] for every
+    /// i in [0, last - first). If an index occurs more than once, it is
+    /// unspecified which of the corresponding elements is copied in the
+    /// parallel versions.
+    ///
+    /// \note   Complexity: Performs exactly \a last - \a first
+    ///         assignments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter1    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the iterator of the indices (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam RandIter    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param map          Refers to the beginning of the sequence of indices
+    ///                     of the destination elements.
+    /// \param dest         Refers to the beginning of the destination range.
+    ///
+    /// The destination element of each assignment is prefetched a few
+    /// assignments ahead. Invoked with an execution policy carrying the
+    /// \a pika::execution::blocked_scatter executor parameter (and random
+    /// access iterators for the elements and the indices), each partition
+    /// sorts its assignments by the page of the destination range they go
+    /// to before executing them, which reduces the TLB misses of scattering
+    /// to a large destination range.
+    ///
+    /// The assignments in the parallel \a scatter algorithm invoked with an
+    /// execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a scatter algorithm invoked with an
+    /// execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a scatter algorithm returns a
+    ///           \a pika::future<FwdIter1> if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and
+    ///           returns \a FwdIter1 otherwise.
+    ///           The \a scatter algorithm returns \a last.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+        typename RandIter>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter1>::type
+    scatter(ExPolicy&& policy, FwdIter1 first, FwdIter1 last, FwdIter2 map,
+        RandIter dest);
+
+    /// Assigns first[i] to dest[map[i]] for every i in [0, last - first)
+    /// for which \a pred(stencil[i]) returns true, the indices of the other
+    /// elements are not read.
+    ///
+    /// \note   Complexity: Performs at most \a last - \a first
+    ///         assignments and exactly \a last - \a first applications of
+    ///         the predicate \a pred.
+    ///
+    /// \tparam FwdIter3    The type of the iterators of the stencil
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of an forward iterator.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param stencil      Refers to the beginning of the sequence of values
+    ///                     \a pred is applied to.
+    /// \param pred         Specifies the function (or function object) which
+    ///                     selects the elements to copy. The signature of
+    ///                     this predicate should be equivalent to:
+    ///                     \code
+    ///                     bool pred(const Type &a);
+    ///                     \endcode \n
+    ///                     The type \a Type must be such that an object of
+    ///                     type \a FwdIter3 can be dereferenced and then
+    ///                     implicitly converted to Type.
+    ///
+    /// The other parameters and the execution of the assignments are the
+    /// same as for \a scatter.
+    ///
+    /// \returns  The \a scatter_if algorithm returns a
+    ///           \a pika::future<FwdIter1> if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and
+    ///           returns \a FwdIter1 otherwise.
+    ///           The \a scatter_if algorithm returns \a last.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+        typename FwdIter3, typename RandIter, typename Pred>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter1>::type
+    scatter_if(ExPolicy&& policy, FwdIter1 first, FwdIter1 last,
+        FwdIter2 map, FwdIter3 stencil, RandIter dest, Pred&& pred);
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_executor_parameters.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/type_support/unused.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/gather.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/zip_iterator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type which makes \a scatter and \a scatter_if
+    /// group the assignments of each partition by the page of the
+    /// destination range they go to. Each page is then written to in one
+    /// go, instead of the assignments jumping between pages, which reduces
+    /// the TLB misses (and page walks) of scattering to destination ranges
+    /// much larger than the TLB covers. Grouping the assignments requires
+    /// two additional passes over the indices and temporary memory of two
+    /// indices per element.
+    ///
+    /// The pages are counted from the beginning of the destination range.
+    /// Assignments to the same element are executed in the order of their
+    /// positions within each partition. The parameter has no effect if the
+    /// elements or the indices are not accessed through random access
+    /// iterators.
+    ///
+    struct blocked_scatter
+    {
+        /// Group the assignments by 4 KiB pages.
+        constexpr blocked_scatter() noexcept
+          : page_size_(4096)
+        {
+        }
+
+        /// Group the assignments by pages of \a page_size bytes.
+        explicit constexpr blocked_scatter(std::size_t page_size) noexcept
+          : page_size_((std::max)(page_size, std::size_t(1)))
+        {
+        }
+
+        /// The size of the pages in bytes.
+        constexpr std::size_t page_size() const noexcept
+        {
+            return page_size_;
+        }
+
+    private:
+        std::size_t page_size_;
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::blocked_scatter>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // gather
+    /// \cond NOINTERNAL
+    template <typename FwdIter2>
+    struct gather : public algorithm<gather<FwdIter2>, FwdIter2>
+    {
+        gather()
+          : gather::algorithm("gather")
+        {
+        }
+
+        template <typename ExPolicy, typename InIter, typename Sent,
+            typename RandIter>
+        static FwdIter2 sequential(ExPolicy&&, InIter map_first, Sent map_last,
+            RandIter src, FwdIter2 dest)
+        {
+            return sequential_gather<std::decay_t<ExPolicy>>(map_first,
+                detail::distance(map_first, map_last), src, dest);
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename Sent,
+            typename RandIter>
+        static typename algorithm_result<ExPolicy, FwdIter2>::type parallel(
+            ExPolicy&& policy, FwdIter1 map_first, Sent map_last, RandIter src,
+            FwdIter2 dest)
+        {
+            if (map_first == map_last)
+            {
+                return algorithm_result<ExPolicy, FwdIter2>::get(
+                    PIKA_MOVE(dest));
+            }
+
+            using policy_type = std::decay_t<ExPolicy>;
+            using zip_iterator = pika::util::zip_iterator<FwdIter1, FwdIter2>;
+
+            return convert_to_result(
+                foreach_partitioner<ExPolicy>::call(
+                    PIKA_FORWARD(ExPolicy, policy),
+                    pika::util::make_zip_iterator(map_first, dest),
+                    detail::distance(map_first, map_last),
+                    [src](zip_iterator part_begin, std::size_t part_size,
+                        std::size_t) {
+                        auto iters = part_begin.get_iterator_tuple();
+                        sequential_gather<policy_type>(std::get<0>(iters),
+                            part_size, src, std::get<1>(iters));
+                    },
+                    projection_identity()),
+                [](zip_iterator const& last) -> FwdIter2 {
+                    return std::get<1>(last.get_iterator_tuple());
+                });
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // gather_if
+    template <typename FwdIter3>
+    struct gather_if : public algorithm<gather_if<FwdIter3>, FwdIter3>
+    {
+        gather_if()
+          : gather_if::algorithm("gather_if")
+        {
+        }
+
+        template <typename ExPolicy, typename InIter1, typename Sent,
+            typename InIter2, typename RandIter, typename Pred>
+        static FwdIter3 sequential(ExPolicy&&, InIter1 map_first,
+            Sent map_last, InIter2 stencil, RandIter src, FwdIter3 dest,
+            Pred&& pred)
+        {
+            return gather_if_loop_n(map_first,
+                detail::distance(map_first, map_last), stencil, src, dest,
+                PIKA_FORWARD(Pred, pred));
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename Sent,
+            typename FwdIter2, typename RandIter, typename Pred>
+        static typename algorithm_result<ExPolicy, FwdIter3>::type parallel(
+            ExPolicy&& policy, FwdIter1 map_first, Sent map_last,
+            FwdIter2 stencil, RandIter src, FwdIter3 dest, Pred&& pred)
+        {
+            if (map_first == map_last)
+            {
+                return algorithm_result<ExPolicy, FwdIter3>::get(
+                    PIKA_MOVE(dest));
+            }
+
+            using zip_iterator =
+                pika::util::zip_iterator<FwdIter1, FwdIter2, FwdIter3>;
+
+            return convert_to_result(
+                foreach_partitioner<ExPolicy>::call(
+                    PIKA_FORWARD(ExPolicy, policy),
+                    pika::util::make_zip_iterator(map_first, stencil, dest),
+                    detail::distance(map_first, map_last),
+                    [src, pred = PIKA_FORWARD(Pred, pred)](
+                        zip_iterator part_begin, std::size_t part_size,
+                        std::size_t) mutable {
+                        auto iters = part_begin.get_iterator_tuple();
+                        gather_if_loop_n(std::get<0>(iters), part_size,
+                            std::get<1>(iters), src, std::get<2>(iters), pred);
+                    },
+                    projection_identity()),
+                [](zip_iterator const& last) -> FwdIter3 {
+                    return std::get<2>(last.get_iterator_tuple());
+                });
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // scatter
+
+    // The size of the pages the assignments of scatter are grouped by, zero
+    // if they are not grouped.
+    template <typename ExPolicy>
+    std::size_t blocked_scatter_page_size(
+        ExPolicy const& policy) noexcept
+    {
+        using parameters_type =
+            typename std::decay_t<ExPolicy>::executor_parameters_type;
+
+        if constexpr (std::is_base_of_v<pika::execution::blocked_scatter,
+                          parameters_type>)
+        {
+            return static_cast<pika::execution::blocked_scatter const&>(
+                policy.parameters())
+                .page_size();
+        }
+        else
+        {
+            PIKA_UNUSED(policy);
+            return 0;
+        }
+    }
+
+    template <typename FwdIter1>
+    struct scatter : public algorithm<scatter<FwdIter1>, FwdIter1>
+    {
+        scatter()
+          : scatter::algorithm("scatter")
+        {
+        }
+
+        template <typename ExPolicy, typename InIter, typename Sent,
+            typename MapIter, typename RandIter>
+        static InIter sequential(ExPolicy&& policy, InIter first, Sent last,
+            MapIter map, RandIter dest)
+        {
+            return scatter_n(first, detail::distance(first, last), map, dest,
+                blocked_scatter_page_size(policy), []() { return true; });
+        }
+
+        template <typename ExPolicy, typename Sent, typename FwdIter2,
+            typename RandIter>
+        static typename algorithm_result<ExPolicy, FwdIter1>::type parallel(
+            ExPolicy&& policy, FwdIter1 first, Sent last, FwdIter2 map,
+            RandIter dest)
+        {
+            if (first == last)
+            {
+                return algorithm_result<ExPolicy, FwdIter1>::get(
+                    PIKA_MOVE(first));
+            }
+
+            using zip_iterator = pika::util::zip_iterator<FwdIter1, FwdIter2>;
+
+            std::size_t const page_size = blocked_scatter_page_size(policy);
+
+            return convert_to_result(
+                foreach_partitioner<ExPolicy>::call(
+                    PIKA_FORWARD(ExPolicy, policy),
+                    pika::util::make_zip_iterator(first, map),
+                    detail::distance(first, last),
+                    [dest, page_size](zip_iterator part_begin,
+                        std::size_t part_size, std::size_t) {
+                        auto iters = part_begin.get_iterator_tuple();
+                        scatter_n(std::get<0>(iters), part_size,
+                            std::get<1>(iters), dest, page_size,
+                            []() { return true; });
+                    },
+                    projection_identity()),
+                [](zip_iterator const& last) -> FwdIter1 {
+                    return std::get<0>(last.get_iterator_tuple());
+                });
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // scatter_if
+    template <typename FwdIter1>
+    struct scatter_if : public algorithm<scatter_if<FwdIter1>, FwdIter1>
+    {
+        scatter_if()
+          : scatter_if::algorithm("scatter_if")
+        {
+        }
+
+        template <typename ExPolicy, typename InIter, typename Sent,
+            typename MapIter, typename StencilIter, typename RandIter,
+            typename Pred>
+        static InIter sequential(ExPolicy&& policy, InIter first, Sent last,
+            MapIter map, StencilIter stencil, RandIter dest, Pred&& pred)
+        {
+            return scatter_n(first, detail::distance(first, last), map, dest,
+                blocked_scatter_page_size(policy), [&]() {
+                    return PIKA_INVOKE(pred, *stencil++);
+                });
+        }
+
+        template <typename ExPolicy, typename Sent, typename FwdIter2,
+            typename FwdIter3, typename RandIter, typename Pred>
+        static typename algorithm_result<ExPolicy, FwdIter1>::type parallel(
+            ExPolicy&& policy, FwdIter1 first, Sent last, FwdIter2 map,
+            FwdIter3 stencil, RandIter dest, Pred&& pred)
+        {
+            if (first == last)
+            {
+                return algorithm_result<ExPolicy, FwdIter1>::get(
+                    PIKA_MOVE(first));
+            }
+
+            using zip_iterator =
+                pika::util::zip_iterator<FwdIter1, FwdIter2, FwdIter3>;
+
+            std::size_t const page_size = blocked_scatter_page_size(policy);
+
+            return convert_to_result(
+                foreach_partitioner<ExPolicy>::call(
+                    PIKA_FORWARD(ExPolicy, policy),
+                    pika::util::make_zip_iterator(first, map, stencil),
+                    detail::distance(first, last),
+                    [dest, page_size, pred = PIKA_FORWARD(Pred, pred)](
+                        zip_iterator part_begin, std::size_t part_size,
+                        std::size_t) mutable {
+                        auto iters = part_begin.get_iterator_tuple();
+                        FwdIter3 it = std::get<2>(iters);
+                        scatter_n(std::get<0>(iters), part_size,
+                            std::get<1>(iters), dest, page_size,
+                            [&]() { return PIKA_INVOKE(pred, *it++); });
+                    },
+                    projection_identity()),
+                [](zip_iterator const& last) -> FwdIter1 {
+                    return std::get<0>(last.get_iterator_tuple());
+                });
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::gather
+    inline constexpr struct gather_t final
+      : pika::detail::tag_parallel_algorithm<gather_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter1, typename RandIter,
+            typename FwdIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<FwdIter1> &&
+                pika::traits::is_iterator_v<RandIter> &&
+                pika::traits::is_iterator_v<FwdIter2>
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter2>::type
+        tag_fallback_invoke(gather_t, ExPolicy&& policy, FwdIter1 map_first,
+            FwdIter1 map_last, RandIter src, FwdIter2 dest)
+        {
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter1>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_random_access_iterator_v<RandIter>),
+                "Requires a random access iterator.");
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter2>),
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::gather<FwdIter2>().call(
+                PIKA_FORWARD(ExPolicy, policy), map_first, map_last, src, dest);
+        }
+
+        // clang-format off
+        template <typename FwdIter1, typename RandIter, typename FwdIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<FwdIter1> &&
+                pika::traits::is_iterator_v<RandIter> &&
+                pika::traits::is_iterator_v<FwdIter2>
+            )>
+        // clang-format on
+        friend FwdIter2 tag_fallback_invoke(gather_t, FwdIter1 map_first,
+            FwdIter1 map_last, RandIter src, FwdIter2 dest)
+        {
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter1>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_random_access_iterator_v<RandIter>),
+                "Requires a random access iterator.");
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter2>),
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::gather<FwdIter2>().call(
+                pika::execution::seq, map_first, map_last, src, dest);
+        }
+    } gather{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::gather_if
+    inline constexpr struct gather_if_t final
+      : pika::detail::tag_parallel_algorithm<gather_if_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename RandIter, typename FwdIter3, typename Pred,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<FwdIter1> &&
+                pika::traits::is_iterator_v<FwdIter2> &&
+                pika::traits::is_iterator_v<RandIter> &&
+                pika::traits::is_iterator_v<FwdIter3> &&
+                std::is_invocable_v<Pred,
+                    typename std::iterator_traits<FwdIter2>::value_type
+                >
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter3>::type
+        tag_fallback_invoke(gather_if_t, ExPolicy&& policy, FwdIter1 map_first,
+            FwdIter1 map_last, FwdIter2 stencil, RandIter src, FwdIter3 dest,
+            Pred&& pred)
+        {
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter1>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter2>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_random_access_iterator_v<RandIter>),
+                "Requires a random access iterator.");
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter3>),
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::gather_if<FwdIter3>().call(
+                PIKA_FORWARD(ExPolicy, policy), map_first, map_last, stencil,
+                src, dest, PIKA_FORWARD(Pred, pred));
+        }
+
+        // clang-format off
+        template <typename FwdIter1, typename FwdIter2, typename RandIter,
+            typename FwdIter3, typename Pred,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<FwdIter1> &&
+                pika::traits::is_iterator_v<FwdIter2> &&
+                pika::traits::is_iterator_v<RandIter> &&
+                pika::traits::is_iterator_v<FwdIter3> &&
+                std::is_invocable_v<Pred,
+                    typename std::iterator_traits<FwdIter2>::value_type
+                >
+            )>
+        // clang-format on
+        friend FwdIter3 tag_fallback_invoke(gather_if_t, FwdIter1 map_first,
+            FwdIter1 map_last, FwdIter2 stencil, RandIter src, FwdIter3 dest,
+            Pred&& pred)
+        {
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter1>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter2>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_random_access_iterator_v<RandIter>),
+                "Requires a random access iterator.");
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter3>),
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::gather_if<FwdIter3>().call(
+                pika::execution::seq, map_first, map_last, stencil, src, dest,
+                PIKA_FORWARD(Pred, pred));
+        }
+    } gather_if{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::scatter
+    inline constexpr struct scatter_t final
+      : pika::detail::tag_parallel_algorithm<scatter_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename RandIter,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<FwdIter1> &&
+                pika::traits::is_iterator_v<FwdIter2> &&
+                pika::traits::is_iterator_v<RandIter>
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter1>::type
+        tag_fallback_invoke(scatter_t, ExPolicy&& policy, FwdIter1 first,
+            FwdIter1 last, FwdIter2 map, RandIter dest)
+        {
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter1>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter2>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_random_access_iterator_v<RandIter>),
+                "Requires a random access iterator.");
+
+            return pika::parallel::detail::scatter<FwdIter1>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, map, dest);
+        }
+
+        // clang-format off
+        template <typename FwdIter1, typename FwdIter2, typename RandIter,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<FwdIter1> &&
+                pika::traits::is_iterator_v<FwdIter2> &&
+                pika::traits::is_iterator_v<RandIter>
+            )>
+        // clang-format on
+        friend FwdIter1 tag_fallback_invoke(scatter_t, FwdIter1 first,
+            FwdIter1 last, FwdIter2 map, RandIter dest)
+        {
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter1>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter2>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_random_access_iterator_v<RandIter>),
+                "Requires a random access iterator.");
+
+            return pika::parallel::detail::scatter<FwdIter1>().call(
+                pika::execution::seq, first, last, map, dest);
+        }
+    } scatter{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::scatter_if
+    inline constexpr struct scatter_if_t final
+      : pika::detail::tag_parallel_algorithm<scatter_if_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename FwdIter3, typename RandIter, typename Pred,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<FwdIter1> &&
+                pika::traits::is_iterator_v<FwdIter2> &&
+                pika::traits::is_iterator_v<FwdIter3> &&
+                pika::traits::is_iterator_v<RandIter> &&
+                std::is_invocable_v<Pred,
+                    typename std::iterator_traits<FwdIter3>::value_type
+                >
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter1>::type
+        tag_fallback_invoke(scatter_if_t, ExPolicy&& policy, FwdIter1 first,
+            FwdIter1 last, FwdIter2 map, FwdIter3 stencil, RandIter dest,
+            Pred&& pred)
+        {
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter1>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter2>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter3>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_random_access_iterator_v<RandIter>),
+                "Requires a random access iterator.");
+
+            return pika::parallel::detail::scatter_if<FwdIter1>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, map, stencil,
+                dest, PIKA_FORWARD(Pred, pred));
+        }
+
+        // clang-format off
+        template <typename FwdIter1, typename FwdIter2, typename FwdIter3,
+            typename RandIter, typename Pred,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<FwdIter1> &&
+                pika::traits::is_iterator_v<FwdIter2> &&
+                pika::traits::is_iterator_v<FwdIter3> &&
+                pika::traits::is_iterator_v<RandIter> &&
+                std::is_invocable_v<Pred,
+                    typename std::iterator_traits<FwdIter3>::value_type
+                >
+            )>
+        // clang-format on
+        friend FwdIter1 tag_fallback_invoke(scatter_if_t, FwdIter1 first,
+            FwdIter1 last, FwdIter2 map, FwdIter3 stencil, RandIter dest,
+            Pred&& pred)
+        {
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter1>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter2>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter3>),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_random_access_iterator_v<RandIter>),
+                "Requires a random access iterator.");
+
+            return pika::parallel::detail::scatter_if<FwdIter1>().call(
+                pika::execution::seq, first, last, map, stencil, dest,
+                PIKA_FORWARD(Pred, pred));
+        }
+    } scatter_if{};
+}    // namespace pika
+
+#endif    // DOXYGEN
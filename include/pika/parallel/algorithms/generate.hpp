@@ -142,6 +142,7 @@ namespace pika {
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/partitioner.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/streaming_stores.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -173,6 +174,17 @@ namespace pika::parallel::detail {
         static typename algorithm_result<ExPolicy, Iter>::type
         parallel(ExPolicy&& policy, Iter first, Sent last, F&& f)
         {
+            if constexpr (supports_streaming_stores_v<Iter,
+                              std::invoke_result_t<F&>>)
+            {
+                std::size_t const count = detail::distance(first, last);
+                if (use_streaming_stores<Iter>(policy, count))
+                {
+                    return streaming_generate_n(PIKA_FORWARD(ExPolicy, policy),
+                        first, count, PIKA_FORWARD(F, f));
+                }
+            }
+
             auto f1 = [policy, f = PIKA_FORWARD(F, f)](
                           Iter part_begin, std::size_t part_size) mutable {
                 auto part_end = part_begin;
@@ -211,6 +223,16 @@ namespace pika::parallel::detail {
         static typename algorithm_result<ExPolicy, FwdIter>::type
         parallel(ExPolicy&& policy, FwdIter first, std::size_t count, F&& f)
         {
+            if constexpr (supports_streaming_stores_v<FwdIter,
+                              std::invoke_result_t<F&>>)
+            {
+                if (use_streaming_stores<FwdIter>(policy, count))
+                {
+                    return streaming_generate_n(PIKA_FORWARD(ExPolicy, policy),
+                        first, count, PIKA_FORWARD(F, f));
+                }
+            }
+
             auto f1 = [policy, f = PIKA_FORWARD(F, f)](
                           FwdIter part_begin, std::size_t part_size) mutable {
                 return sequential_generate_n(
@@ -0,0 +1,360 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/histogram.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace pika {
+    // clang-format off
+
+    /// Counts the number of elements in the range [first, last) which are
+    /// mapped to each of the bins in the range [bins_first, bins_last). The
+    /// element \a e is mapped to the bin with the index given by
+    /// \a key_fn(e), elements mapped to indices outside of
+    /// [0, bins_last - bins_first) are not counted. Every bin is assigned
+    /// its count, regardless of its previous value.
+    ///
+    /// \note   Complexity: Performs exactly \a last - \a first applications
+    ///         of \a key_fn.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter1    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the iterators used for the bins
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of an forward iterator.
+    /// \tparam Proj        The type of the function object mapping the
+    ///                     elements to the indices of their bins (deduced).
+    ///                     Its result has to be of an integral type.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param bins_first   Refers to the beginning of the sequence of bins.
+    /// \param bins_last    Refers to the end of the sequence of bins.
+    /// \param key_fn       Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to
+    ///                     determine the index of its bin. This defaults to
+    ///                     the element itself.
+    ///
+    /// The parallel versions of \a histogram count into a separate,
+    /// cache-line-aligned set of bins per worker, which are added up bin by
+    /// bin afterwards. If there are more bins than elements per worker, the
+    /// indices of the elements are sorted and counted instead, which keeps
+    /// the memory required proportional to the number of elements.
+    ///
+    /// The invocations of \a key_fn in the parallel \a histogram algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The invocations of \a key_fn in the parallel \a histogram algorithm
+    /// invoked with an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a histogram algorithm returns a
+    ///           \a pika::future<FwdIter2> if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and
+    ///           returns \a FwdIter2 otherwise.
+    ///           The \a histogram algorithm returns \a bins_last.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+        typename Proj = pika::parallel::detail::projection_identity>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, FwdIter2>::type
+    histogram(ExPolicy&& policy, FwdIter1 first, FwdIter1 last,
+        FwdIter2 bins_first, FwdIter2 bins_last, Proj&& key_fn = Proj());
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/functional/deferred_call.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/algorithms/traits/projected.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/histogram.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/bulk_execute.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // histogram
+    /// \cond NOINTERNAL
+
+    // Below this number of counters the bins are added up by a single task
+    inline constexpr std::size_t histogram_merge_threshold = 65536;
+
+    // Assigns the counts of the bins [bin_first, bin_last), get_count(bin)
+    // returns the number of elements counted for a bin.
+    template <typename FwdIter, typename F>
+    void write_histogram_bins(FwdIter dest, std::size_t bin_first,
+        std::size_t bin_last, F&& get_count)
+    {
+        using value_type = typename std::iterator_traits<FwdIter>::value_type;
+
+        for (/* */; bin_first != bin_last; (void) ++bin_first, ++dest)
+        {
+            *dest = static_cast<value_type>(get_count(bin_first));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Every worker counts a contiguous part of the input into bins of its
+    // own, the bins of all workers are then added up in parallel over
+    // disjoint slices of the bins. If the bins of a worker would outnumber
+    // its elements, the worker sorts the indices of its bins and keeps
+    // (bin, count) pairs instead.
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+        typename Proj>
+    FwdIter2 histogram_impl(ExPolicy&& policy, FwdIter1 first,
+        std::size_t count, FwdIter2 bins_first, std::size_t nbins,
+        Proj&& key_fn)
+    {
+        using policy_type = std::decay_t<ExPolicy>;
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t const workers =
+            (std::max)(std::size_t(1), (std::min)(cores, count));
+        std::size_t const slices =
+            nbins * workers < histogram_merge_threshold ? 1 : workers;
+
+        auto worker_size = [&](std::size_t w) {
+            return count * (w + 1) / workers - count * w / workers;
+        };
+
+        std::vector<FwdIter1> starts(workers);
+        starts[0] = first;
+        for (std::size_t w = 1; w != workers; ++w)
+        {
+            starts[w] = std::next(starts[w - 1], worker_size(w - 1));
+        }
+
+        if (nbins * workers <= count)
+        {
+            // dense: every worker owns a full set of bins
+            std::vector<histogram_bins> parts(workers);
+            bulk_execute_n(policy, workers, [&](std::size_t w) {
+                histogram_bins part(nbins);
+                sequential_histogram<policy_type>(
+                    starts[w], worker_size(w), part.data(), nbins, key_fn);
+                parts[w] = PIKA_MOVE(part);
+            });
+
+            bulk_execute_n(policy, slices, [&](std::size_t s) {
+                std::size_t const bin_first = nbins * s / slices;
+                std::size_t const bin_last = nbins * (s + 1) / slices;
+                write_histogram_bins(std::next(bins_first, bin_first),
+                    bin_first, bin_last, [&](std::size_t bin) {
+                        std::size_t result = 0;
+                        for (histogram_bins const& part : parts)
+                        {
+                            result += part.data()[bin];
+                        }
+                        return result;
+                    });
+            });
+        }
+        else
+        {
+            // sparse: every worker owns the sorted bins of its elements
+            using bin_count = std::pair<std::size_t, std::size_t>;
+
+            std::vector<std::vector<bin_count>> parts(workers);
+            bulk_execute_n(policy, workers, [&](std::size_t w) {
+                std::vector<std::size_t> bins;
+                bins.reserve(worker_size(w));
+
+                FwdIter1 it = starts[w];
+                for (std::size_t i = worker_size(w); i != 0; (void) --i, ++it)
+                {
+                    auto const bin =
+                        static_cast<std::size_t>(PIKA_INVOKE(key_fn, *it));
+                    if (bin < nbins)
+                    {
+                        bins.push_back(bin);
+                    }
+                }
+                std::sort(bins.begin(), bins.end());
+
+                std::vector<bin_count>& part = parts[w];
+                for (std::size_t bin : bins)
+                {
+                    if (part.empty() || part.back().first != bin)
+                    {
+                        part.emplace_back(bin, 0);
+                    }
+                    ++part.back().second;
+                }
+            });
+
+            bulk_execute_n(policy, slices, [&](std::size_t s) {
+                std::size_t const bin_first = nbins * s / slices;
+                std::size_t const bin_last = nbins * (s + 1) / slices;
+
+                std::vector<std::size_t> counts(bin_last - bin_first, 0);
+                for (std::vector<bin_count> const& part : parts)
+                {
+                    auto it = std::lower_bound(part.begin(), part.end(),
+                        bin_first, [](bin_count const& lhs, std::size_t rhs) {
+                            return lhs.first < rhs;
+                        });
+                    for (/* */; it != part.end() && it->first < bin_last; ++it)
+                    {
+                        counts[it->first - bin_first] += it->second;
+                    }
+                }
+
+                write_histogram_bins(std::next(bins_first, bin_first),
+                    bin_first, bin_last, [&](std::size_t bin) {
+                        return counts[bin - bin_first];
+                    });
+            });
+        }
+
+        return std::next(bins_first, nbins);
+    }
+
+    template <typename FwdIter2>
+    struct histogram : public algorithm<histogram<FwdIter2>, FwdIter2>
+    {
+        histogram()
+          : histogram::algorithm("histogram")
+        {
+        }
+
+        template <typename ExPolicy, typename InIter, typename Sent,
+            typename Proj>
+        static FwdIter2 sequential(ExPolicy&&, InIter first, Sent last,
+            FwdIter2 bins_first, FwdIter2 bins_last, Proj&& key_fn)
+        {
+            std::vector<std::size_t> counts(
+                detail::distance(bins_first, bins_last), 0);
+
+            sequential_histogram<std::decay_t<ExPolicy>>(first,
+                detail::distance(first, last), counts.data(), counts.size(),
+                key_fn);
+
+            for (std::size_t c : counts)
+            {
+                *bins_first++ = static_cast<
+                    typename std::iterator_traits<FwdIter2>::value_type>(c);
+            }
+            return bins_first;
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename Sent,
+            typename Proj>
+        static typename algorithm_result<ExPolicy, FwdIter2>::type parallel(
+            ExPolicy&& policy, FwdIter1 first, Sent last, FwdIter2 bins_first,
+            FwdIter2 bins_last, Proj&& key_fn)
+        {
+            if (bins_first == bins_last)
+            {
+                return algorithm_result<ExPolicy, FwdIter2>::get(
+                    PIKA_MOVE(bins_last));
+            }
+
+            return algorithm_result<ExPolicy, FwdIter2>::get(
+                execution::async_execute(policy.executor(),
+                    pika::util::detail::deferred_call(
+                        &histogram_impl<ExPolicy&&, FwdIter1, FwdIter2,
+                            Proj&&>,
+                        policy, first, detail::distance(first, last),
+                        bins_first, detail::distance(bins_first, bins_last),
+                        PIKA_FORWARD(Proj, key_fn))));
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::histogram
+    inline constexpr struct histogram_t final
+      : pika::detail::tag_parallel_algorithm<histogram_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename Proj = pika::parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<FwdIter1>::value &&
+                pika::traits::is_iterator<FwdIter2>::value &&
+                pika::parallel::detail::is_projected<Proj, FwdIter1>::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter2>::type
+        tag_fallback_invoke(histogram_t, ExPolicy&& policy, FwdIter1 first,
+            FwdIter1 last, FwdIter2 bins_first, FwdIter2 bins_last,
+            Proj&& key_fn = Proj())
+        {
+            static_assert((pika::traits::is_forward_iterator<FwdIter1>::value),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_forward_iterator<FwdIter2>::value),
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::histogram<FwdIter2>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, bins_first,
+                bins_last, PIKA_FORWARD(Proj, key_fn));
+        }
+
+        // clang-format off
+        template <typename FwdIter1, typename FwdIter2,
+            typename Proj = pika::parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<FwdIter1>::value &&
+                pika::traits::is_iterator<FwdIter2>::value &&
+                pika::parallel::detail::is_projected<Proj, FwdIter1>::value
+            )>
+        // clang-format on
+        friend FwdIter2 tag_fallback_invoke(histogram_t, FwdIter1 first,
+            FwdIter1 last, FwdIter2 bins_first, FwdIter2 bins_last,
+            Proj&& key_fn = Proj())
+        {
+            static_assert((pika::traits::is_forward_iterator<FwdIter1>::value),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_forward_iterator<FwdIter2>::value),
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::histogram<FwdIter2>().call(
+                pika::execution::seq, first, last, bins_first, bins_last,
+                PIKA_FORWARD(Proj, key_fn));
+        }
+    } histogram{};
+}    // namespace pika
+
+#endif    // DOXYGEN
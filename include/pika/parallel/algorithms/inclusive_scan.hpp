@@ -432,6 +432,7 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/scan.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 #include <pika/parallel/util/loop.hpp>
@@ -485,18 +486,6 @@ namespace pika::parallel::detail {
         return in_out_result<InIter, OutIter>{first, dest};
     }
 
-    template <typename InIter, typename OutIter, typename T, typename Op>
-    static constexpr T sequential_inclusive_scan_n(
-        InIter first, std::size_t count, OutIter dest, T init, Op&& op)
-    {
-        for (/* */; count-- != 0; (void) ++first, ++dest)
-        {
-            init = PIKA_INVOKE(op, init, *first);
-            *dest = init;
-        }
-        return init;
-    }
-
     ///////////////////////////////////////////////////////////////////////
     template <typename IterPair>
     struct inclusive_scan : public algorithm<inclusive_scan<IterPair>, IterPair>
@@ -561,11 +550,8 @@ namespace pika::parallel::detail {
                           T val) mutable -> void {
                 FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
 
-                // MSVC 2015 fails if op is captured by reference
-                loop_n<std::decay_t<ExPolicy>>(
-                    dst, part_size, [=, &val](FwdIter2 it) mutable -> void {
-                        *it = PIKA_INVOKE(op, val, *it);
-                    });
+                sequential_scan_offset_n<std::decay_t<ExPolicy>>(
+                    dst, part_size, val, op);
             };
 
             return scan_partitioner<ExPolicy, in_out_result<FwdIter1, FwdIter2>,
@@ -582,7 +568,8 @@ namespace pika::parallel::detail {
                         auto iters = part_begin.get_iterator_tuple();
                         if (get<0>(iters) != last)
                         {
-                            return sequential_inclusive_scan_n(get<0>(iters),
+                            return sequential_inclusive_scan_n<
+                                std::decay_t<ExPolicy>>(get<0>(iters),
                                 part_size - 1, get<1>(iters), part_init, op);
                         }
                         return part_init;
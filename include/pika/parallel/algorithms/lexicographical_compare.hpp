@@ -164,6 +164,7 @@ namespace pika {
 
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/mismatch.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
 #include <pika/parallel/algorithms/for_each.hpp>
 #include <pika/parallel/algorithms/mismatch.hpp>
@@ -219,7 +220,6 @@ namespace pika::parallel::detail {
             Sent2 last2, Pred&& pred, Proj1&& proj1, Proj2&& proj2)
         {
             using zip_iterator = pika::util::zip_iterator<FwdIter1, FwdIter2>;
-            using reference = typename zip_iterator::reference;
 
             std::size_t count1 = detail::distance(first1, last1);
             std::size_t count2 = detail::distance(first2, last2);
@@ -242,19 +242,10 @@ namespace pika::parallel::detail {
             auto f1 = [tok, pred, proj1, proj2](zip_iterator it,
                           std::size_t part_count,
                           std::size_t base_idx) mutable -> void {
-                loop_idx_n<std::decay_t<ExPolicy>>(base_idx, it, part_count,
-                    tok,
-                    [&pred, &tok, &proj1, &proj2](
-                        reference t, std::size_t i) mutable -> void {
-                        using std::get;
-                        if (PIKA_INVOKE(pred, PIKA_INVOKE(proj1, get<0>(t)),
-                                PIKA_INVOKE(proj2, get<1>(t))) ||
-                            PIKA_INVOKE(pred, PIKA_INVOKE(proj2, get<1>(t)),
-                                PIKA_INVOKE(proj1, get<0>(t))))
-                        {
-                            tok.cancel(i);
-                        }
-                    });
+                auto const& iters = it.get_iterator_tuple();
+                sequential_lexicographical_mismatch_n<std::decay_t<ExPolicy>>(
+                    base_idx, std::get<0>(iters), std::get<1>(iters),
+                    part_count, tok, pred, proj1, proj2);
             };
 
             auto f2 =
@@ -0,0 +1,355 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/merge_k.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace pika {
+    // clang-format off
+
+    /// Merges any number of sorted ranges into one sorted range beginning at
+    /// \a dest. The ranges to merge are the elements of the sequence
+    /// [first, last), each of them has to be sorted with respect to \a comp
+    /// and \a proj. The order of equivalent elements in each of the
+    /// original ranges is preserved. For equivalent elements in different
+    /// ranges, the elements from the range appearing earlier in
+    /// [first, last) precede the elements from the other range. The
+    /// destination range cannot overlap with any of the input ranges.
+    ///
+    /// \note   Complexity: Performs O(N log(K)) applications of the
+    ///         comparison \a comp and O(N log(K)) applications of the
+    ///         projection \a proj, where N is the overall number of elements
+    ///         and K is the number of ranges.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RngIter     The type of the iterators used for the sequence of
+    ///                     ranges (deduced). This iterator type must meet the
+    ///                     requirements of an forward iterator. Its value type
+    ///                     must be a range whose iterators meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam RandIter    The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a merge_k requires \a Comp to meet the
+    ///                     requirements of \a CopyConstructible. This defaults
+    ///                     to std::less<>
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of sorted
+    ///                     ranges the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of sorted ranges
+    ///                     the algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise. The signature of this
+    ///                     comparison should be equivalent to:
+    ///                     \code
+    ///                     bool comp(const Type1 &a, const Type2 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. The types \a Type1 and \a Type2 must be such
+    ///                     that the projected elements of the ranges can be
+    ///                     implicitly converted to both \a Type1 and \a Type2
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements as a
+    ///                     projection operation before the actual comparison
+    ///                     \a comp is invoked.
+    ///
+    /// The parallel versions of \a merge_k split the destination range into
+    /// parts of equal size. For each part, the number of elements every
+    /// range contributes to it is determined by a multi-sequence selection,
+    /// and the parts are then merged concurrently using a tournament tree.
+    ///
+    /// The assignments in the parallel \a merge_k algorithm invoked with
+    /// an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a merge_k algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a merge_k algorithm returns a
+    ///           \a pika::future<RandIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and
+    ///           returns \a RandIter otherwise.
+    ///           The \a merge_k algorithm returns the destination iterator to
+    ///           the end of the \a dest range.
+    ///
+    template <typename ExPolicy, typename RngIter, typename RandIter,
+        typename Comp = pika::parallel::detail::less,
+        typename Proj = pika::parallel::detail::projection_identity>
+    typename pika::parallel::detail::algorithm_result<ExPolicy, RandIter>::type
+    merge_k(ExPolicy&& policy, RngIter first, RngIter last, RandIter dest,
+        Comp&& comp = Comp(), Proj&& proj = Proj());
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/functional/deferred_call.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/range.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/iterator_support/traits/is_range.hpp>
+
+#include <pika/algorithms/traits/projected.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/merge_k.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/bulk_execute.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // merge_k
+    /// \cond NOINTERNAL
+
+    template <typename RngIter>
+    using merge_k_iterator_t =
+        pika::traits::range_iterator_t<std::remove_reference_t<
+            typename std::iterator_traits<RngIter>::reference>>;
+
+    template <typename RngIter, typename Comp, typename Proj>
+    merge_k_runs<merge_k_iterator_t<RngIter>, Comp, Proj> make_merge_k_runs(
+        RngIter first, RngIter last, Comp& comp, Proj& proj)
+    {
+        merge_k_runs<merge_k_iterator_t<RngIter>, Comp, Proj> runs(
+            comp, proj);
+        runs.reserve(detail::distance(first, last));
+
+        for (/* */; first != last; ++first)
+        {
+            auto&& rng = *first;
+            runs.push_back(pika::util::begin(rng),
+                detail::distance(
+                    pika::util::begin(rng), pika::util::end(rng)));
+        }
+        return runs;
+    }
+
+    // Below this number of elements the ranges are merged by a single task
+    inline constexpr std::size_t merge_k_threshold = 65536;
+
+    // Number of parts of the destination range per core
+    inline constexpr std::size_t merge_k_parts_per_core = 4;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The destination range is split into parts of equal size, the elements
+    // contributed by every run to each of them are determined concurrently,
+    // and then the parts are merged concurrently.
+    template <typename ExPolicy, typename RngIter, typename RandIter,
+        typename Comp, typename Proj>
+    RandIter merge_k_impl(ExPolicy&& policy, RngIter first, RngIter last,
+        RandIter dest, Comp&& comp, Proj&& proj)
+    {
+        auto runs = make_merge_k_runs(first, last, comp, proj);
+
+        std::size_t const count = runs.count();
+        std::size_t const nruns = runs.size();
+
+        // finding the split of a part costs about nruns * log(nruns) *
+        // log(count) comparisons, the parts are made large enough for this
+        // to be small compared to merging them
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t const part_size =
+            (std::max)(merge_k_threshold / 4, nruns * nruns);
+        std::size_t const nparts = count < merge_k_threshold ?
+            1 :
+            (std::max)(std::size_t(1),
+                (std::min)(cores * merge_k_parts_per_core, count / part_size));
+
+        // the number of elements every run contributes to the parts
+        // preceding part p, p = 0, ..., nparts
+        std::vector<std::size_t> splits((nparts + 1) * nruns, 0);
+        std::copy(runs.sizes().begin(), runs.sizes().end(),
+            splits.begin() + nparts * nruns);
+
+        if (nparts > 1)
+        {
+            bulk_execute_n(policy, nparts - 1, [&](std::size_t p) {
+                runs.select(
+                    count * (p + 1) / nparts, splits.data() + (p + 1) * nruns);
+            });
+        }
+
+        bulk_execute_n(policy, nparts, [&](std::size_t p) {
+            runs.merge(splits.data() + p * nruns,
+                splits.data() + (p + 1) * nruns,
+                std::next(dest, count * p / nparts));
+        });
+
+        return std::next(dest, count);
+    }
+
+    template <typename RandIter>
+    struct merge_k : public algorithm<merge_k<RandIter>, RandIter>
+    {
+        merge_k()
+          : merge_k::algorithm("merge_k")
+        {
+        }
+
+        template <typename ExPolicy, typename RngIter, typename Comp,
+            typename Proj>
+        static RandIter sequential(ExPolicy&&, RngIter first, RngIter last,
+            RandIter dest, Comp&& comp, Proj&& proj)
+        {
+            auto runs = make_merge_k_runs(first, last, comp, proj);
+
+            std::vector<std::size_t> const firsts(runs.size(), 0);
+            return runs.merge(firsts.data(), runs.sizes().data(), dest);
+        }
+
+        template <typename ExPolicy, typename RngIter, typename Comp,
+            typename Proj>
+        static typename algorithm_result<ExPolicy, RandIter>::type parallel(
+            ExPolicy&& policy, RngIter first, RngIter last, RandIter dest,
+            Comp&& comp, Proj&& proj)
+        {
+            if (first == last)
+            {
+                return algorithm_result<ExPolicy, RandIter>::get(
+                    PIKA_MOVE(dest));
+            }
+
+            return algorithm_result<ExPolicy, RandIter>::get(
+                execution::async_execute(policy.executor(),
+                    pika::util::detail::deferred_call(
+                        &merge_k_impl<ExPolicy&&, RngIter, RandIter, Comp&&,
+                            Proj&&>,
+                        policy, first, last, dest, PIKA_FORWARD(Comp, comp),
+                        PIKA_FORWARD(Proj, proj))));
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::merge_k
+    inline constexpr struct merge_k_t final
+      : pika::detail::tag_parallel_algorithm<merge_k_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RngIter, typename RandIter,
+            typename Comp = pika::parallel::detail::less,
+            typename Proj = pika::parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator<RngIter>::value &&
+                pika::traits::is_range<
+                    typename std::iterator_traits<RngIter>::value_type
+                >::value &&
+                pika::traits::is_iterator<RandIter>::value &&
+                pika::parallel::detail::is_projected<Proj,
+                    pika::parallel::detail::merge_k_iterator_t<RngIter>
+                >::value &&
+                pika::parallel::detail::is_indirect_callable<ExPolicy, Comp,
+                    pika::parallel::detail::projected<Proj,
+                        pika::parallel::detail::merge_k_iterator_t<RngIter>>,
+                    pika::parallel::detail::projected<Proj,
+                        pika::parallel::detail::merge_k_iterator_t<RngIter>>
+                >::value
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            RandIter>::type
+        tag_fallback_invoke(merge_k_t, ExPolicy&& policy, RngIter first,
+            RngIter last, RandIter dest, Comp&& comp = Comp(),
+            Proj&& proj = Proj())
+        {
+            static_assert((pika::traits::is_forward_iterator<RngIter>::value),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_random_access_iterator<
+                              pika::parallel::detail::merge_k_iterator_t<
+                                  RngIter>>::value),
+                "Requires at least random access iterator.");
+            static_assert(
+                (pika::traits::is_random_access_iterator<RandIter>::value),
+                "Requires at least random access iterator.");
+
+            return pika::parallel::detail::merge_k<RandIter>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, dest,
+                PIKA_FORWARD(Comp, comp), PIKA_FORWARD(Proj, proj));
+        }
+
+        // clang-format off
+        template <typename RngIter, typename RandIter,
+            typename Comp = pika::parallel::detail::less,
+            typename Proj = pika::parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator<RngIter>::value &&
+                pika::traits::is_range<
+                    typename std::iterator_traits<RngIter>::value_type
+                >::value &&
+                pika::traits::is_iterator<RandIter>::value &&
+                pika::parallel::detail::is_projected<Proj,
+                    pika::parallel::detail::merge_k_iterator_t<RngIter>
+                >::value &&
+                pika::parallel::detail::is_indirect_callable<
+                    pika::execution::sequenced_policy, Comp,
+                    pika::parallel::detail::projected<Proj,
+                        pika::parallel::detail::merge_k_iterator_t<RngIter>>,
+                    pika::parallel::detail::projected<Proj,
+                        pika::parallel::detail::merge_k_iterator_t<RngIter>>
+                >::value
+            )>
+        // clang-format on
+        friend RandIter tag_fallback_invoke(merge_k_t, RngIter first,
+            RngIter last, RandIter dest, Comp&& comp = Comp(),
+            Proj&& proj = Proj())
+        {
+            static_assert((pika::traits::is_forward_iterator<RngIter>::value),
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_random_access_iterator<
+                              pika::parallel::detail::merge_k_iterator_t<
+                                  RngIter>>::value),
+                "Requires at least random access iterator.");
+            static_assert(
+                (pika::traits::is_random_access_iterator<RandIter>::value),
+                "Requires at least random access iterator.");
+
+            return pika::parallel::detail::merge_k<RandIter>().call(
+                pika::execution::seq, first, last, dest,
+                PIKA_FORWARD(Comp, comp), PIKA_FORWARD(Proj, proj));
+        }
+    } merge_k{};
+}    // namespace pika
+
+#endif    // DOXYGEN
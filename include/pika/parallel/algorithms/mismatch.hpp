@@ -180,10 +180,12 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/mismatch.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/util/cancellation_token.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
-#include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/result_types.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
@@ -270,30 +272,18 @@ namespace pika::parallel::detail {
             }
 
             using zip_iterator = pika::util::zip_iterator<Iter1, Iter2>;
-            using reference = typename zip_iterator::reference;
 
             util::cancellation_token<std::size_t> tok(count1);
 
-            // Note: replacing the invoke() with PIKA_INVOKE()
-            // below makes gcc generate errors
             auto f1 = [tok, f = PIKA_FORWARD(F, f),
                           proj1 = PIKA_FORWARD(Proj1, proj1),
                           proj2 = PIKA_FORWARD(Proj2, proj2)](zip_iterator it,
                           std::size_t part_count,
                           std::size_t base_idx) mutable -> void {
-                loop_idx_n<std::decay_t<ExPolicy>>(base_idx, it, part_count,
-                    tok,
-                    [&f, &proj1, &proj2, &tok](
-                        reference t, std::size_t i) mutable -> void {
-                        if (!pika::util::detail::invoke(f,
-                                pika::util::detail::invoke(
-                                    proj1, std::get<0>(t)),
-                                pika::util::detail::invoke(
-                                    proj2, std::get<1>(t))))
-                        {
-                            tok.cancel(i);
-                        }
-                    });
+                auto const& iters = it.get_iterator_tuple();
+                sequential_mismatch_n<std::decay_t<ExPolicy>>(base_idx,
+                    std::get<0>(iters), std::get<1>(iters), part_count, tok, f,
+                    proj1, proj2);
             };
 
             auto f2 = [=](std::vector<pika::future<void>>&& data) mutable
@@ -379,24 +369,16 @@ namespace pika::parallel::detail {
             difference_type count = (distance) (first1, last1);
 
             using zip_iterator = pika::util::zip_iterator<FwdIter1, FwdIter2>;
-            using reference = typename zip_iterator::reference;
 
             util::cancellation_token<std::size_t> tok(count);
 
-            // Note: replacing the invoke() with PIKA_INVOKE()
-            // below makes gcc generate errors
             auto f1 = [tok, f = PIKA_FORWARD(F, f)](zip_iterator it,
                           std::size_t part_count,
                           std::size_t base_idx) mutable -> void {
-                loop_idx_n<std::decay_t<ExPolicy>>(base_idx, it, part_count,
-                    tok,
-                    [&f, &tok](reference t, std::size_t i) mutable -> void {
-                        if (!pika::util::detail::invoke(
-                                f, std::get<0>(t), std::get<1>(t)))
-                        {
-                            tok.cancel(i);
-                        }
-                    });
+                auto const& iters = it.get_iterator_tuple();
+                sequential_mismatch_n<std::decay_t<ExPolicy>>(base_idx,
+                    std::get<0>(iters), std::get<1>(iters), part_count, tok, f,
+                    projection_identity{}, projection_identity{});
             };
 
             auto f2 = [=](std::vector<pika::future<void>>&& data) mutable
@@ -80,6 +80,7 @@ namespace pika {
 #include <pika/parallel/util/detail/sender_util.hpp>
 #include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/result_types.hpp>
+#include <pika/parallel/util/streaming_stores.hpp>
 #include <pika/parallel/util/transfer.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
@@ -129,15 +130,31 @@ namespace pika::parallel::detail {
         {
             using zip_iterator = pika::util::zip_iterator<FwdIter1, FwdIter2>;
 
+            std::size_t const count = detail::distance(first, last);
+            bool const streaming =
+                use_streaming_stores<FwdIter2>(policy, count);
+
             return get_in_out_result(foreach_partitioner<ExPolicy>::call(
                 PIKA_FORWARD(ExPolicy, policy),
-                pika::util::make_zip_iterator(first, dest),
-                detail::distance(first, last),
-                [](zip_iterator part_begin, std::size_t part_size,
+                pika::util::make_zip_iterator(first, dest), count,
+                [streaming](zip_iterator part_begin, std::size_t part_size,
                     std::size_t) {
                     using std::get;
 
                     auto iters = part_begin.get_iterator_tuple();
+
+                    // moving trivially copyable elements copies them
+                    if constexpr (supports_streaming_copy_v<FwdIter1,
+                                      FwdIter2>)
+                    {
+                        if (streaming)
+                        {
+                            streaming_copy_n(
+                                get<0>(iters), part_size, get<1>(iters));
+                            return;
+                        }
+                    }
+
                     move_n(get<0>(iters), part_size, get<1>(iters));
                 },
                 [](zip_iterator&& last) -> zip_iterator {
@@ -157,6 +157,7 @@ namespace pika {
 #include <pika/parallel/algorithms/copy.hpp>
 #include <pika/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/algorithms/detail/is_sorted.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
 #include <pika/parallel/algorithms/partial_sort.hpp>
@@ -165,9 +166,12 @@ namespace pika {
 #include <pika/parallel/util/detail/sender_util.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/result_types.hpp>
+#include <pika/parallel/util/scratch_memory.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -183,6 +187,31 @@ namespace pika::parallel::detail {
         {
         }
 
+        // Sorts the first min(ninput, noutput) of the ninput elements at aux
+        // and copies them to d_first, returns how many were copied.
+        template <typename T, typename RandIter, typename Compare>
+        static std::int64_t sequential_sort_copy(T* aux, std::int64_t ninput,
+            RandIter d_first, std::int64_t noutput, Compare& comp)
+        {
+            PIKA_ASSERT(ninput >= 0 && noutput >= 0);
+
+            auto nmin = ninput < noutput ? ninput : noutput;
+            if (noutput >= ninput)
+            {
+                sort<T*>().call(pika::execution::seq, aux, aux + ninput, comp,
+                    projection_identity{});
+            }
+            else
+            {
+                partial_sort<T*>().call(pika::execution::seq, aux, aux + nmin,
+                    aux + ninput, comp, projection_identity{});
+            }
+
+            copy_algo<in_out_result<T*, RandIter>>().call(
+                pika::execution::seq, aux, aux + nmin, d_first);
+            return nmin;
+        }
+
         ///////////////////////////////////////////////////////////////////////////
         ///
         /// \brief : Sorts some of the elements in the range [first, last) in
@@ -206,8 +235,9 @@ namespace pika::parallel::detail {
             typename RandIter, typename Sent2, typename Compare, typename Proj1,
             typename Proj2>
         static in_out_result<InIter, RandIter>
-        sequential(ExPolicy, InIter first, Sent1 last, RandIter d_first,
-            Sent2 d_last, Compare&& comp, Proj1&& proj1, Proj2&& proj2)
+        sequential(ExPolicy&& policy, InIter first, Sent1 last,
+            RandIter d_first, Sent2 d_last, Compare&& comp, Proj1&& proj1,
+            Proj2&& proj2)
         {
             auto last_iter = advance_to_sentinel(first, last);
             auto d_last_iter = advance_to_sentinel(d_first, d_last);
@@ -215,7 +245,6 @@ namespace pika::parallel::detail {
             using value_t = typename std::iterator_traits<InIter>::value_type;
             using value1_t =
                 typename std::iterator_traits<RandIter>::value_type;
-            using vec_iter_t = typename std::vector<value_t>::iterator;
 
             static_assert(
                 std::is_same_v<value1_t, value_t>, "Incompatible iterators\n");
@@ -223,30 +252,29 @@ namespace pika::parallel::detail {
             if ((last_iter == first) || (d_last_iter == d_first))
                 return in_out_result<InIter, RandIter>{last_iter, d_first};
 
-            std::vector<value_t> aux(first, last_iter);
-            std::int64_t noutput = d_last_iter - d_first;
-            std::int64_t ninput = aux.size();
-
-            PIKA_ASSERT(ninput >= 0 || noutput >= 0);
-
             compare_projected<Compare&, Proj1&, Proj2&> proj_comp{
                 comp, proj1, proj2};
 
-            auto nmin = ninput < noutput ? ninput : noutput;
-            if (noutput >= ninput)
+            std::int64_t noutput = d_last_iter - d_first;
+            std::int64_t nmin = 0;
+
+            // A single-pass input can be read only once, it is collected into
+            // a growing buffer instead of being measured and then copied.
+            if constexpr (pika::traits::is_forward_iterator_v<InIter>)
             {
-                sort<vec_iter_t>().call(pika::execution::seq, aux.begin(),
-                    aux.end(), PIKA_MOVE(proj_comp), projection_identity{});
+                std::int64_t ninput = detail::distance(first, last_iter);
+                std::shared_ptr<value_t[]> aux_data =
+                    make_scratch_array_copy(policy, first, std::size_t(ninput));
+                nmin = sequential_sort_copy(aux_data.get(), ninput, d_first,
+                    noutput, proj_comp);
             }
             else
             {
-                partial_sort<vec_iter_t>().call(pika::execution::seq,
-                    aux.begin(), aux.begin() + nmin, aux.end(),
-                    PIKA_MOVE(proj_comp), projection_identity{});
+                std::vector<value_t> aux(first, last_iter);
+                nmin = sequential_sort_copy(aux.data(),
+                    std::int64_t(aux.size()), d_first, noutput, proj_comp);
             }
 
-            copy_algo<in_out_result<vec_iter_t, RandIter>>().call(
-                pika::execution::seq, aux.begin(), aux.begin() + nmin, d_first);
             return in_out_result<InIter, RandIter>{last_iter, d_first + nmin};
         }
 
@@ -281,7 +309,7 @@ namespace pika::parallel::detail {
             using value_t = typename std::iterator_traits<FwdIter>::value_type;
             using value1_t =
                 typename std::iterator_traits<RandIter>::value_type;
-            using vec_iter_t = typename std::vector<value_t>::iterator;
+            using aux_iter_t = value_t*;
 
             static_assert(
                 std::is_same_v<value1_t, value_t>, "Incompatible iterators\n");
@@ -295,9 +323,11 @@ namespace pika::parallel::detail {
                     return result_type::get(
                         in_out_result<FwdIter, RandIter>{last_iter, d_first});
 
-                std::vector<value_t> aux(first, last_iter);
-                std::int64_t ninput = aux.size();
+                std::int64_t ninput = detail::distance(first, last_iter);
                 std::int64_t noutput = d_last_iter - d_first;
+                std::shared_ptr<value_t[]> aux_data =
+                    make_scratch_array_copy(policy, first, std::size_t(ninput));
+                value_t* aux = aux_data.get();
                 PIKA_ASSERT(ninput >= 0 and noutput >= 0);
 
                 compare_projected<Compare&, Proj1&, Proj2&> proj_comp{
@@ -306,22 +336,22 @@ namespace pika::parallel::detail {
                 auto nmin = ninput < noutput ? ninput : noutput;
                 if (noutput >= ninput)
                 {
-                    sort<vec_iter_t>().call(policy(pika::execution::non_task),
-                        aux.begin(), aux.end(), PIKA_MOVE(proj_comp),
+                    sort<aux_iter_t>().call(policy(pika::execution::non_task),
+                        aux, aux + ninput, PIKA_MOVE(proj_comp),
                         projection_identity{});
                 }
                 else
                 {
                     //
-                    partial_sort<vec_iter_t>().call(
-                        policy(pika::execution::non_task), aux.begin(),
-                        aux.begin() + nmin, aux.end(), PIKA_MOVE(proj_comp),
+                    partial_sort<aux_iter_t>().call(
+                        policy(pika::execution::non_task), aux, aux + nmin,
+                        aux + ninput, PIKA_MOVE(proj_comp),
                         projection_identity{});
                 };
 
-                copy_algo<in_out_result<vec_iter_t, RandIter>>().call(
-                    policy(pika::execution::non_task), aux.begin(),
-                    aux.begin() + nmin, d_first);
+                copy_algo<in_out_result<aux_iter_t, RandIter>>().call(
+                    policy(pika::execution::non_task), aux, aux + nmin,
+                    d_first);
 
                 return result_type::get(in_out_result<FwdIter, RandIter>{
                     last_iter, d_first + nmin});
@@ -447,6 +447,7 @@ namespace pika {
 #include <pika/config.hpp>
 #include <pika/assert.hpp>
 #include <pika/concepts/concepts.hpp>
+#include <pika/async_combinators/wait_all.hpp>
 #include <pika/functional/invoke.hpp>
 #include <pika/futures/future.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
@@ -465,6 +466,7 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/bulk_execute.hpp>
 #include <pika/parallel/util/detail/chunk_size.hpp>
 #include <pika/parallel/util/detail/handle_local_exceptions.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
@@ -472,6 +474,7 @@ namespace pika {
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/scan_partitioner.hpp>
+#include <pika/parallel/util/scratch_memory.hpp>
 #include <pika/parallel/util/transfer.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
@@ -482,6 +485,7 @@ namespace pika {
 #include <iterator>
 #include <list>
 #include <memory>
+#include <new>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -585,6 +589,148 @@ namespace pika::parallel::detail {
         }
     };
 
+    // Partitions with the help of a buffer holding size elements in two
+    // parallel passes. First, every chunk moves its elements into its part
+    // of the buffer, the elements satisfying the predicate to the front and
+    // the others to the back (in reverse order). The chunks then move their
+    // elements to the final positions, which are known from the number of
+    // elements satisfying the predicate in all chunks before them. This
+    // performs 2 * size moves, compared to O(size * log(size)) moves for the
+    // recursive partitioning with rotations.
+    struct stable_partition_buffered
+    {
+        struct chunk_data
+        {
+            std::size_t first = 0;
+            std::size_t last = 0;
+            std::size_t count_true = 0;
+            std::size_t count_false = 0;
+            std::size_t dest_true = 0;
+            std::size_t dest_false = 0;
+        };
+
+        // moves the elements of a chunk which were already moved into the
+        // buffer back into the chunk and destroys them in the buffer
+        template <typename RandIter, typename T>
+        static void restore(RandIter first, T* buffer, chunk_data& d)
+        {
+            RandIter dest = std::next(first, d.first);
+            dest = std::move(buffer + d.first,
+                buffer + d.first + d.count_true, dest);
+            std::move(std::make_reverse_iterator(buffer + d.last),
+                std::make_reverse_iterator(buffer + d.last - d.count_false),
+                dest);
+
+            std::destroy_n(buffer + d.first, d.count_true);
+            std::destroy_n(buffer + d.last - d.count_false, d.count_false);
+            d.count_true = d.count_false = 0;
+        }
+
+        template <typename ExPolicy, typename RandIter, typename F,
+            typename Proj, typename T>
+        RandIter operator()(ExPolicy& policy, RandIter first,
+            std::size_t size, F& f, Proj& proj, std::size_t chunks,
+            T* buffer) const
+        {
+            chunks = (std::max)(std::size_t(1), (std::min)(chunks, size));
+
+            std::vector<chunk_data> data(chunks);
+            for (std::size_t c = 0; c != chunks; ++c)
+            {
+                data[c].first = size * c / chunks;
+                data[c].last = size * (c + 1) / chunks;
+            }
+
+            // pass 1: partition every chunk into its part of the buffer
+            try
+            {
+                bulk_execute_n(policy, chunks, [&](std::size_t c) {
+                    chunk_data& d = data[c];
+                    T* true_dest = buffer + d.first;
+                    T* false_dest = buffer + d.last;
+
+                    RandIter it = std::next(first, d.first);
+                    try
+                    {
+                        for (std::size_t i = d.first; i != d.last; (void) ++i,
+                                         ++it)
+                        {
+                            if (PIKA_INVOKE(f, PIKA_INVOKE(proj, *it)))
+                            {
+                                ::new (static_cast<void*>(
+                                    true_dest + d.count_true))
+                                    T(PIKA_MOVE(*it));
+                                ++d.count_true;
+                            }
+                            else
+                            {
+                                ::new (static_cast<void*>(
+                                    false_dest - d.count_false - 1))
+                                    T(PIKA_MOVE(*it));
+                                ++d.count_false;
+                            }
+                        }
+                    }
+                    catch (...)
+                    {
+                        restore(first, buffer, d);
+                        throw;
+                    }
+                });
+            }
+            catch (...)
+            {
+                for (chunk_data& d : data)
+                {
+                    restore(first, buffer, d);
+                }
+                throw;
+            }
+
+            std::size_t dest_true = 0;
+            std::size_t dest_false = 0;
+            for (chunk_data const& d : data)
+            {
+                dest_false += d.count_true;
+            }
+
+            RandIter const result = std::next(first, dest_false);
+            for (chunk_data& d : data)
+            {
+                d.dest_true = dest_true;
+                d.dest_false = dest_false;
+                dest_true += d.count_true;
+                dest_false += d.count_false;
+            }
+
+            // pass 2: move the elements to their final positions
+            bulk_execute_n(policy, chunks, [&](std::size_t c) {
+                chunk_data& d = data[c];
+                T* const false_last = buffer + d.last;
+                T* const false_first = false_last - d.count_false;
+                try
+                {
+                    std::move(buffer + d.first,
+                        buffer + d.first + d.count_true,
+                        std::next(first, d.dest_true));
+                    std::move(std::make_reverse_iterator(false_last),
+                        std::make_reverse_iterator(false_first),
+                        std::next(first, d.dest_false));
+                }
+                catch (...)
+                {
+                    std::destroy_n(buffer + d.first, d.count_true);
+                    std::destroy(false_first, false_last);
+                    throw;
+                }
+                std::destroy_n(buffer + d.first, d.count_true);
+                std::destroy(false_first, false_last);
+            });
+
+            return result;
+        }
+    };
+
     template <typename BidirIter, typename Sent, typename F, typename Proj>
     static BidirIter
     stable_partition_seq(BidirIter first, Sent last, F&& f, Proj&& proj)
@@ -668,10 +814,50 @@ namespace pika::parallel::detail {
                     adjust_chunk_size_and_max_chunks(
                         cores, size, chunk_size, max_chunks);
 
-                    result = stable_partition_helper()(
-                        PIKA_FORWARD(ExPolicy, policy), first, last_iter, size,
-                        PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj),
-                        max_chunks);
+                    // use the linear algorithm if a buffer for all elements
+                    // is available, fall back to rotations otherwise
+                    using value_type =
+                        typename std::iterator_traits<RandIter>::value_type;
+
+                    pika::execution::scratch_resource* resource =
+                        &get_scratch_resource(policy);
+                    std::size_t const bytes = size * sizeof(value_type);
+
+                    std::shared_ptr<value_type> buffer;
+                    try
+                    {
+                        void* data =
+                            resource->allocate(bytes, alignof(value_type));
+                        buffer.reset(static_cast<value_type*>(data),
+                            [resource, bytes](value_type* p) {
+                                resource->deallocate(
+                                    p, bytes, alignof(value_type));
+                            });
+                    }
+                    catch (std::bad_alloc const&)
+                    {
+                        buffer.reset();
+                    }
+
+                    if (buffer)
+                    {
+                        result = execution::async_execute(policy.executor(),
+                            [policy, first, size, f = PIKA_FORWARD(F, f),
+                                proj = PIKA_FORWARD(Proj, proj), max_chunks,
+                                buffer = PIKA_MOVE(buffer)]() mutable
+                            -> RandIter {
+                                return stable_partition_buffered()(policy,
+                                    first, std::size_t(size), f, proj,
+                                    max_chunks, buffer.get());
+                            });
+                    }
+                    else
+                    {
+                        result = stable_partition_helper()(
+                            PIKA_FORWARD(ExPolicy, policy), first, last_iter,
+                            size, PIKA_FORWARD(F, f),
+                            PIKA_FORWARD(Proj, proj), max_chunks);
+                    }
                 }
             }
             catch (...)
@@ -1458,7 +1644,8 @@ namespace pika::parallel::detail {
             difference_type count =
                 detail::advance_and_get_distance(last_iter, last);
 
-            std::shared_ptr<bool[]> flags(new bool[count]);
+            std::shared_ptr<bool[]> flags =
+                make_scratch_array<bool>(policy, count);
             output_iterator_offset init = {0, 0};
 
             using pika::util::make_zip_iterator;
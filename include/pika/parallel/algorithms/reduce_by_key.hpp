@@ -9,354 +9,212 @@
 #pragma once
 //
 #include <pika/config.hpp>
-#include <pika/execution/executors/execution.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/futures/future.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/pack_traversal/unwrap.hpp>
 //
-#include <pika/iterator_support/range.hpp>
-#include <pika/iterator_support/transform_iterator.hpp>
-#include <pika/parallel/algorithms/for_each.hpp>
-#include <pika/parallel/algorithms/inclusive_scan.hpp>
-#include <pika/parallel/algorithms/sort.hpp>
-#include <pika/parallel/container_algorithms/copy.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/result_types.hpp>
-#include <pika/parallel/util/zip_iterator.hpp>
+#include <pika/parallel/util/scan_partitioner.hpp>
 //
+#include <cstddef>
 #include <cstdint>
 #include <functional>
-#include <tuple>
+#include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
-#include <vector>
-//
-/// \cond NOINTERNAL
-#ifdef EXTRA_DEBUG
-#include <iostream>
-#define debug_reduce_by_key(a) std::cout << a
-#else
-#define debug_reduce_by_key(a)
-#endif
-/// \endcond
 
 namespace pika {
     // reduce_by_key
     namespace detail {
         /// \cond NOINTERNAL
+
         // -------------------------------------------------------------------
-        // simple iterator helper object for access to prev/next items
+        // A run starts at every key which is not equivalent to its
+        // predecessor, the first key always starts a run.
         // -------------------------------------------------------------------
-        struct reduce_stencil_transformer
+        template <typename RanIter, typename Compare>
+        PIKA_FORCEINLINE bool is_run_start(
+            RanIter key_first, RanIter it, Compare& comp)
         {
-            // declare result type as a template
-            template <typename T>
-            struct result;
-
-            // specialize result for iterator type
-            template <typename This, typename Iterator>
-            struct result<This(Iterator)>
-            {
-                using element_type =
-                    typename std::iterator_traits<Iterator>::reference;
-                using type =
-                    std::tuple<element_type, element_type, element_type>;
-            };
-
-            // call operator for stencil transform
-            // it will dereference tuple(it-1, it, it+1)
-            template <typename Iterator>
-            typename result<reduce_stencil_transformer(Iterator)>::type
-            operator()(Iterator const& it) const
-            {
-                using type =
-                    typename result<reduce_stencil_transformer(Iterator)>::type;
-                return type(*std::prev(it), *it, *std::next(it));
-            }
-        };
+            return it == key_first || !PIKA_INVOKE(comp, *std::prev(it), *it);
+        }
 
         // -------------------------------------------------------------------
-        // transform iterator using reduce_stencil_transformer helper
+        // Partition summary of the segmented reduction: the number of runs
+        // starting in the partition and the reduction of its trailing run
+        // (of the whole partition if no run starts in it). Combining two
+        // summaries from left to right gives the number of runs starting
+        // before a partition and the carry of the run which is still open
+        // at its beginning.
         // -------------------------------------------------------------------
-        template <typename Iterator,
-            typename Transformer = detail::reduce_stencil_transformer>
-        class reduce_stencil_iterator
-          : public pika::util::transform_iterator<Iterator, Transformer>
+        template <typename T>
+        struct reduce_by_key_partition
         {
-        private:
-            using base_type =
-                pika::util::transform_iterator<Iterator, Transformer>;
-
-        public:
-            reduce_stencil_iterator() {}
-
-            explicit reduce_stencil_iterator(Iterator const& it)
-              : base_type(it, Transformer())
-            {
-            }
-
-            reduce_stencil_iterator(Iterator const& it, Transformer const& t)
-              : base_type(it, t)
-            {
-            }
+            std::size_t runs = 0;
+            T carry = T();
         };
 
-        template <typename Iterator, typename Transformer>
-        inline reduce_stencil_iterator<Iterator, Transformer>
-        make_reduce_stencil_iterator(Iterator const& it, Transformer const& t)
+        template <typename T, typename Func>
+        reduce_by_key_partition<T> combine_reduce_by_key_partitions(
+            reduce_by_key_partition<T> const& lhs,
+            reduce_by_key_partition<T> const& rhs, Func& func)
         {
-            return reduce_stencil_iterator<Iterator, Transformer>(it, t);
+            reduce_by_key_partition<T> result{lhs.runs + rhs.runs, rhs.carry};
+            if (rhs.runs == 0)
+            {
+                result.carry = PIKA_INVOKE(func, lhs.carry, rhs.carry);
+            }
+            return result;
         }
 
-        // -------------------------------------------------------------------
-        // state of a reduce by key step
-        // -------------------------------------------------------------------
-        struct reduce_key_series_states
+        // step 1: reduce the runs of a (non-empty) partition locally
+        template <typename T, typename RanIter, typename RanIter2,
+            typename Compare, typename Func>
+        reduce_by_key_partition<T> reduce_by_key_partition_summary(
+            RanIter key_first, RanIter2 values_first, RanIter part_begin,
+            std::size_t part_size, Compare& comp, Func& func)
         {
-            bool start;    // START of a segment
-            bool end;      // END of a segment
-            reduce_key_series_states(bool s = false, bool e = false)
-              : start(s)
-              , end(e)
+            RanIter2 values =
+                std::next(values_first, std::distance(key_first, part_begin));
+
+            reduce_by_key_partition<T> result{
+                std::size_t(is_run_start(key_first, part_begin, comp)),
+                *values};
+
+            for (++part_begin, ++values; --part_size != 0;
+                 (void) ++part_begin, ++values)
             {
+                if (is_run_start(key_first, part_begin, comp))
+                {
+                    ++result.runs;
+                    result.carry = *values;
+                }
+                else
+                {
+                    result.carry = PIKA_INVOKE(func, result.carry, *values);
+                }
             }
-        };
+            return result;
+        }
 
-        // -------------------------------------------------------------------
-        // callable that actually computes the state using the stencil iterator
-        // -------------------------------------------------------------------
-        template <typename Transformer, typename StencilIterType,
-            typename KeyStateIterType, typename Compare>
-        struct reduce_stencil_generate
+        // step 3: write every run which is closed by a run start inside the
+        // partition, the carry-in completes the run which was still open at
+        // the beginning of the partition. Every run is written to a position
+        // not after the last of its elements, which makes this safe for
+        // outputs aliasing the inputs as long as the partitions are written
+        // in order.
+        template <typename T, typename RanIter, typename RanIter2,
+            typename FwdIter1, typename FwdIter2, typename Compare,
+            typename Func>
+        void reduce_by_key_partition_write(RanIter key_first,
+            RanIter2 values_first, RanIter part_begin, std::size_t part_size,
+            FwdIter1 keys_output, FwdIter2 values_output,
+            reduce_by_key_partition<T> const& prefix, Compare& comp,
+            Func& func)
         {
-            using element_type =
-                typename Transformer::template result<Transformer(
-                    StencilIterType)>::element_type;
-            using tuple_type =
-                typename Transformer::template result<Transformer(
-                    StencilIterType)>::type;
-            using KeyStateType =
-                typename std::iterator_traits<KeyStateIterType>::reference;
-
-            reduce_stencil_generate() {}
-
-            void operator()(const tuple_type& value, KeyStateType& kiter,
-                const Compare& comp) const
-            {
-                // resolves to a tuple of values for *(it-1), *it, *(it+1)
+            RanIter2 values =
+                std::next(values_first, std::distance(key_first, part_begin));
 
-                element_type left = std::get<0>(value);
-                element_type mid = std::get<1>(value);
-                element_type right = std::get<2>(value);
+            std::size_t runs = prefix.runs;
+            T carry = prefix.carry;
 
-                // we need to determine which of three states this
-                // index is. It can be:
-                // 1. Middle of a set of equivalent keys.
-                // 2. Start of a set of equivalent keys.
-                // 3. End of a set of equivalent keys.
-                // 4. Both the start and end of a set of keys
+            if (runs != 0)
+            {
+                std::advance(keys_output, runs - 1);
+                std::advance(values_output, runs - 1);
+            }
 
+            for (/* */; part_size != 0;
+                 (void) --part_size, ++part_begin, ++values)
+            {
+                if (is_run_start(key_first, part_begin, comp))
                 {
-                    const bool leftMatches(comp(left, mid));
-                    const bool rightMatches(comp(mid, right));
-                    kiter =
-                        reduce_key_series_states(!leftMatches, !rightMatches);
+                    if (runs++ != 0)
+                    {
+                        // the key of a run is the key of its last element
+                        *keys_output++ = *std::prev(part_begin);
+                        *values_output++ = PIKA_MOVE(carry);
+                    }
+                    carry = *values;
+                }
+                else
+                {
+                    carry = PIKA_INVOKE(func, carry, *values);
                 }
             }
-        };
+        }
 
-        // -------------------------------------------------------------------
-        // helper that extracts the final output iterators from copy_if
-        // -------------------------------------------------------------------
-        // Zip iterator has 3 iterators inside
-        // Iter1, key type : Iter2, value type : Iter3, state type
-        template <typename ZIter, typename iKey, typename iVal>
-        parallel::detail::in_out_result<iKey, iVal>
-        make_pair_result(ZIter zipiter, iKey key_start, iVal val_start)
+        template <typename T>
+        PIKA_FORCEINLINE T const& get_reduce_by_key_total(T const& total)
         {
-            // the iterator we want is 'second' part of pair type (from copy_if)
-            auto t = zipiter.out.get_iterator_tuple();
-            iKey key_end = std::get<0>(t);
-            return parallel::detail::in_out_result<iKey, iVal>{key_end,
-                std::next(val_start, std::distance(key_start, key_end))};
+            return total;
         }
 
-        // async version that returns future<pair> from future<zip_iterator<blah>>
-        template <typename ZIter, typename iKey, typename iVal>
-        pika::future<parallel::detail::in_out_result<iKey, iVal>>
-        make_pair_result(
-            pika::future<ZIter>&& ziter, iKey key_start, iVal val_start)
+        template <typename T>
+        PIKA_FORCEINLINE T const& get_reduce_by_key_total(
+            pika::shared_future<T> const& total)
         {
-            using result_type = parallel::detail::in_out_result<iKey, iVal>;
-
-            return pika::make_future<result_type>(
-                PIKA_MOVE(ziter), [=](ZIter zipiter) {
-                    auto t = zipiter.second.get_iterator_tuple();
-                    iKey key_end = std::get<0>(t);
-                    return result_type{key_end,
-                        std::next(
-                            val_start, std::distance(key_start, key_end))};
-                });
+            return total.get();
         }
 
-        // -------------------------------------------------------------------
-        // The main algorithm is implemented here, it replaces any async
-        // execution policy with a non async one so that no waits are
-        // necessry on the internal algorithms. Async execution is handled
-        // by the wrapper layer that calls this.
-        // -------------------------------------------------------------------
-        template <typename ExPolicy, typename RanIter, typename RanIter2,
-            typename FwdIter1, typename FwdIter2, typename Compare,
-            typename Func>
-        static parallel::detail::in_out_result<FwdIter1, FwdIter2>
-        reduce_by_key_impl(ExPolicy&& policy, RanIter key_first,
-            RanIter key_last, RanIter2 values_first, FwdIter1 keys_output,
-            FwdIter2 values_output, Compare&& comp, Func&& func)
+        // Output ranges starting at the beginning of the corresponding input
+        // range are the only supported kind of overlap (reducing in place).
+        template <typename Iter, typename OutIter>
+        bool is_reduce_by_key_in_place(Iter const& first, OutIter const& dest)
         {
-            using namespace pika::parallel::detail;
-            using namespace pika::util;
-
-            // we need to determine based on the keys what is the keystate for
-            // each key. The states are start, middle, end of a series and the special
-            // state start and end of the sequence
-            std::vector<reduce_key_series_states> key_state;
-            using keystate_iter_type =
-                std::vector<reduce_key_series_states>::iterator;
-            using reducebykey_iter =
-                reduce_stencil_iterator<RanIter, reduce_stencil_transformer>;
-            using element_type =
-                typename std::iterator_traits<RanIter>::reference;
-            using zip_ref = typename zip_iterator<reducebykey_iter,
-                keystate_iter_type>::reference;
-            //
-            const std::uint64_t number_of_keys =
-                std::distance(key_first, key_last);
-            //
-            key_state.assign(number_of_keys, reduce_key_series_states());
+            if constexpr (pika::traits::is_contiguous_iterator_v<Iter> &&
+                pika::traits::is_contiguous_iterator_v<OutIter>)
             {
-                reduce_stencil_transformer r_s_t;
-                reducebykey_iter reduce_begin =
-                    make_reduce_stencil_iterator(key_first, r_s_t);
-                reducebykey_iter reduce_end =
-                    make_reduce_stencil_iterator(key_last, r_s_t);
+                return static_cast<void const*>(std::addressof(*first)) ==
+                    static_cast<void const*>(std::addressof(*dest));
+            }
+            else if constexpr (std::is_same_v<Iter, OutIter>)
+            {
+                return first == dest;
+            }
+            else
+            {
+                return false;
+            }
+        }
 
-                // FIXME: handle cases number_of_keys == 0 and
-                //        number_of_keys == 1
+        template <typename RanIter, typename RanIter2, typename FwdIter1,
+            typename FwdIter2, typename Compare, typename Func>
+        parallel::detail::in_out_result<FwdIter1, FwdIter2>
+        sequential_reduce_by_key(RanIter key_first, RanIter key_last,
+            RanIter2 values_first, FwdIter1 keys_output,
+            FwdIter2 values_output, Compare&& comp, Func&& func)
+        {
+            using value_type =
+                typename std::iterator_traits<RanIter2>::value_type;
 
-                if (number_of_keys == 2)
+            value_type carry = *values_first;
+            for (++key_first, ++values_first; key_first != key_last;
+                 (void) ++key_first, ++values_first)
+            {
+                if (PIKA_INVOKE(comp, *std::prev(key_first), *key_first))
                 {
-                    // for two entries, one is a start, the other an end,
-                    // if they are different, then they are both start/end
-                    element_type left = *key_first;
-                    element_type right = *std::next(key_first);
-                    key_state[0] =
-                        reduce_key_series_states(true, !comp(left, right));
-                    key_state[1] =
-                        reduce_key_series_states(!comp(left, right), true);
+                    carry = PIKA_INVOKE(func, carry, *values_first);
                 }
                 else
                 {
-                    // do the first and last elements by hand to simplify the iterator
-                    // traversal as there is no prev/next for first/last
-                    element_type elem0 = *key_first;
-                    element_type elem1 = *std::next(key_first);
-                    key_state[0] =
-                        reduce_key_series_states(true, elem0 != elem1);
-                    // middle elements
-                    reduce_stencil_generate<reduce_stencil_transformer, RanIter,
-                        keystate_iter_type, Compare>
-                        kernel;
-                    pika::for_each(policy(pika::execution::non_task),
-                        make_zip_iterator(
-                            reduce_begin + 1, key_state.begin() + 1),
-                        make_zip_iterator(reduce_end - 1, key_state.end() - 1),
-                        [&kernel, &comp](zip_ref ref) {
-                            kernel(std::get<0>(ref), std::get<1>(ref), comp);
-                        });
-                    // Last element
-                    element_type elemN = *std::prev(key_last);
-                    element_type elemn = *std::prev(std::prev(key_last));
-                    key_state.back() =
-                        reduce_key_series_states(elemN != elemn, true);
+                    *keys_output++ = *std::prev(key_first);
+                    *values_output++ = PIKA_MOVE(carry);
+                    carry = *values_first;
                 }
             }
-            {
-                using zip_iterator_in = zip_iterator<RanIter2,
-                    std::vector<reduce_key_series_states>::iterator>;
-                using zip_type_in = typename zip_iterator_in::value_type;
 
-                using zip_iterator_vout = zip_iterator<FwdIter2,
-                    std::vector<reduce_key_series_states>::iterator>;
+            *keys_output++ = *std::prev(key_last);
+            *values_output++ = PIKA_MOVE(carry);
 
-                using value_type =
-                    typename std::iterator_traits<RanIter2>::value_type;
-
-                zip_iterator_in states_begin = make_zip_iterator(
-                    values_first, pika::util::begin(key_state));
-                zip_iterator_in states_end = make_zip_iterator(
-                    values_first + number_of_keys, pika::util::end(key_state));
-                zip_iterator_vout states_out_begin = make_zip_iterator(
-                    values_output, pika::util::begin(key_state));
-                //
-
-                zip_type_in initial;
-                //
-                using lambda_type =
-                    std::tuple<value_type, reduce_key_series_states>;
-                pika::inclusive_scan(
-                    policy(pika::execution::non_task), states_begin, states_end,
-                    states_out_begin,
-                    // B is the current entry, A is the one passed in from 'previous'
-                    [&func](zip_type_in a, zip_type_in b) -> lambda_type {
-                        value_type a_val = std::get<0>(a);
-                        reduce_key_series_states a_state = std::get<1>(a);
-                        value_type b_val = std::get<0>(b);
-                        reduce_key_series_states b_state = std::get<1>(b);
-                        debug_reduce_by_key("{ " << a_val << "+" << b_val
-                                                 << " },\t" << a_state
-                                                 << b_state);
-                        // if carrying a start flag, then copy - don't add
-                        if (b_state.start)
-                        {
-                            debug_reduce_by_key(" = " << b_val << std::endl);
-                            return std::make_tuple(b_val,
-                                reduce_key_series_states(
-                                    a_state.start || b_state.start,
-                                    b_state.end));
-                        }
-                        // normal add of previous + this
-                        else
-                        {
-                            debug_reduce_by_key(
-                                " = " << func(a_val, b_val) << std::endl);
-                            value_type temp = func(a_val, b_val);
-                            return std::make_tuple(temp,
-                                reduce_key_series_states(
-                                    a_state.start || b_state.start,
-                                    b_state.end));
-                        }
-                    },
-                    initial);
-
-                // now copy the values and keys for each element that
-                // is marked by an 'END' state to the final output
-                using zip2_ref = typename pika::util::zip_iterator<RanIter,
-                    FwdIter2,
-                    std::vector<reduce_key_series_states>::iterator>::reference;
-
-                std::vector<value_type> temp(number_of_keys);
-                pika::copy(policy(pika::execution::non_task), values_output,
-                    values_output + number_of_keys, temp.begin());
-
-                return make_pair_result(
-                    pika::ranges::copy_if(policy(pika::execution::non_task),
-                        make_zip_iterator(key_first, temp.begin(),
-                            pika::util::begin(key_state)),
-                        make_zip_iterator(key_last,
-                            temp.begin() + number_of_keys,
-                            pika::util::end(key_state)),
-                        make_zip_iterator(keys_output, values_output,
-                            pika::util::begin(key_state)),
-                        // copies to dest only when 'end' state is true
-                        [](zip2_ref it) { return std::get<2>(it).end; }),
-                    keys_output, values_output);
-            }
+            return parallel::detail::in_out_result<FwdIter1, FwdIter2>{
+                keys_output, values_output};
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -375,16 +233,22 @@ namespace pika {
             template <typename ExPolicy, typename RanIter, typename RanIter2,
                 typename Compare, typename Func>
             static parallel::detail::in_out_result<FwdIter1, FwdIter2>
-            sequential(ExPolicy&& policy, RanIter key_first, RanIter key_last,
+            sequential(ExPolicy&&, RanIter key_first, RanIter key_last,
                 RanIter2 values_first, FwdIter1 keys_output,
                 FwdIter2 values_output, Compare&& comp, Func&& func)
             {
-                return reduce_by_key_impl(PIKA_FORWARD(ExPolicy, policy),
-                    key_first, key_last, values_first, keys_output,
-                    values_output, PIKA_FORWARD(Compare, comp),
-                    PIKA_FORWARD(Func, func));
+                return sequential_reduce_by_key(key_first, key_last,
+                    values_first, keys_output, values_output,
+                    PIKA_FORWARD(Compare, comp), PIKA_FORWARD(Func, func));
             }
 
+            // Segmented reduction: every partition reduces its runs locally
+            // (step 1), the partition summaries are combined from left to
+            // right (step 2), and every partition writes its completed runs
+            // directly to the output, starting with the carry of the run
+            // which is still open at its beginning (step 3). The last run is
+            // written from the overall summary. Apart from the outputs only
+            // one summary per partition is stored.
             template <typename ExPolicy, typename RanIter, typename RanIter2,
                 typename Compare, typename Func>
             static typename parallel::detail::algorithm_result<ExPolicy,
@@ -393,30 +257,108 @@ namespace pika {
                 RanIter2 values_first, FwdIter1 keys_output,
                 FwdIter2 values_output, Compare&& comp, Func&& func)
             {
-                return parallel::detail::algorithm_result<ExPolicy,
-                    parallel::detail::in_out_result<FwdIter1, FwdIter2>>::
-                    get(parallel::execution::async_execute(policy.executor(),
-                        pika::util::detail::deferred_call(
-                            &reduce_by_key_impl<ExPolicy&&, RanIter, RanIter2,
-                                FwdIter1, FwdIter2, Compare&&, Func&&>,
-                            policy, key_first, key_last, values_first,
-                            keys_output, values_output,
-                            PIKA_FORWARD(Compare, comp),
-                            PIKA_FORWARD(Func, func))));
+                using result_type =
+                    parallel::detail::in_out_result<FwdIter1, FwdIter2>;
+                using value_type =
+                    typename std::iterator_traits<RanIter2>::value_type;
+                using partition_type = reduce_by_key_partition<value_type>;
+
+                std::size_t const count = std::distance(key_first, key_last);
+
+                auto f1 = [key_first, values_first, comp, func](
+                              RanIter part_begin,
+                              std::size_t part_size) mutable -> partition_type {
+                    return reduce_by_key_partition_summary<value_type>(
+                        key_first, values_first, part_begin, part_size, comp,
+                        func);
+                };
+
+                auto f2 = [func](partition_type const& lhs,
+                              partition_type const& rhs) mutable {
+                    return combine_reduce_by_key_partitions(lhs, rhs, func);
+                };
+
+                auto f3 = [key_first, values_first, keys_output, values_output,
+                              comp, func](RanIter part_begin,
+                              std::size_t part_size,
+                              partition_type const& prefix) mutable {
+                    reduce_by_key_partition_write(key_first, values_first,
+                        part_begin, part_size, keys_output, values_output,
+                        prefix, comp, func);
+                };
+
+                auto f4 = [key_last, keys_output, values_output](
+                              auto&& items, auto&& data) mutable
+                    -> result_type {
+                    partition_type const& total =
+                        get_reduce_by_key_total(items.back());
+
+                    // make sure iterators embedded in function object that is
+                    // attached to futures are invalidated
+                    data.clear();
+
+                    std::advance(keys_output, total.runs - 1);
+                    std::advance(values_output, total.runs - 1);
+
+                    *keys_output++ = *std::prev(key_last);
+                    *values_output++ = total.carry;
+
+                    return result_type{keys_output, values_output};
+                };
+
+                // Partitions which reduce in place write into the inputs of
+                // the partitions to their left, the final step has to be
+                // performed in order in this case.
+                if (is_reduce_by_key_in_place(key_first, keys_output) ||
+                    is_reduce_by_key_in_place(values_first, values_output))
+                {
+                    using scan_partitioner_type =
+                        parallel::detail::scan_partitioner<ExPolicy,
+                            result_type, partition_type, void,
+                            parallel::detail::
+                                scan_partitioner_sequential_f3_tag>;
+
+                    return scan_partitioner_type::call(
+                        PIKA_FORWARD(ExPolicy, policy), key_first, count,
+                        partition_type{},
+                        // step 1 reduces the runs of each partition
+                        PIKA_MOVE(f1),
+                        // step 2 propagates the partition results from left
+                        // to right
+                        pika::unwrapping(PIKA_MOVE(f2)),
+                        // step 3 writes the completed runs of each partition
+                        [f3 = PIKA_MOVE(f3)](RanIter part_begin,
+                            std::size_t part_size,
+                            pika::shared_future<partition_type> prev,
+                            pika::shared_future<partition_type> curr) mutable {
+                            curr.get();    // rethrow exceptions
+                            f3(part_begin, part_size, prev.get());
+                        },
+                        // step 4 writes the last run
+                        PIKA_MOVE(f4));
+                }
+
+                using scan_partitioner_type =
+                    parallel::detail::scan_partitioner<ExPolicy, result_type,
+                        partition_type>;
+
+                return scan_partitioner_type::call(
+                    PIKA_FORWARD(ExPolicy, policy), key_first, count,
+                    partition_type{},
+                    // step 1 reduces the runs of each partition
+                    PIKA_MOVE(f1),
+                    // step 2 propagates the partition results from left to
+                    // right
+                    PIKA_MOVE(f2),
+                    // step 3 writes the completed runs of each partition
+                    PIKA_MOVE(f3),
+                    // step 4 writes the last run
+                    PIKA_MOVE(f4));
             }
         };
         /// \endcond
     }    // namespace detail
 
-#ifdef EXTRA_DEBUG
-    std::ostream& operator<<(
-        std::ostream& os, const detail::reduce_key_series_states& rs)
-    {
-        os << "{ start=" << rs.start << ",end=" << rs.end << "} ";
-        return os;
-    }
-#endif
-
     //-----------------------------------------------------------------------------
     /// Reduce by Key performs an inclusive scan reduction operation on elements
     /// supplied in key/value pairs. The algorithm produces a single output
@@ -0,0 +1,582 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/reduce_by_key_unsorted.hpp
+
+#pragma once
+//
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/functional/deferred_call.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/type_support/unused.hpp>
+//
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/merge_k.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/bulk_execute.hpp>
+#include <pika/parallel/util/result_types.hpp>
+//
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika {
+    // reduce_by_key_unsorted
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        ///////////////////////////////////////////////////////////////////////
+        // Open-addressing (linear probing) hash table collecting one group
+        // per distinct key. The groups are stored densely in insertion
+        // order, the slots refer to them by index.
+        template <typename Key, typename T, typename Hash, typename KeyEqual>
+        class reduce_by_key_table
+        {
+        public:
+            struct entry
+            {
+                std::size_t hash;
+                Key key;
+                T value;
+            };
+
+            reduce_by_key_table(Hash const& hash, KeyEqual const& key_eq)
+              : hash_(hash)
+              , key_eq_(key_eq)
+              , slots_(std::size_t(1) << initial_log2_capacity, 0)
+              , log2_capacity_(initial_log2_capacity)
+            {
+            }
+
+            template <typename K>
+            std::size_t hash(K const& key)
+            {
+                return PIKA_INVOKE(hash_, key);
+            }
+
+            // Combines the value with the group of an equal key, values of
+            // groups inserted earlier are passed as the first argument.
+            template <typename K, typename V, typename Func>
+            void insert(std::size_t hash, K&& key, V&& value, Func& func)
+            {
+                std::size_t const mask = slots_.size() - 1;
+                for (std::size_t i = slot(hash);; i = (i + 1) & mask)
+                {
+                    std::size_t& s = slots_[i];
+                    if (s == 0)
+                    {
+                        entries_.push_back(entry{hash, PIKA_FORWARD(K, key),
+                            PIKA_FORWARD(V, value)});
+                        s = entries_.size();
+
+                        // keep the load factor below 1/2
+                        if (2 * entries_.size() > slots_.size())
+                        {
+                            grow();
+                        }
+                        return;
+                    }
+
+                    entry& e = entries_[s - 1];
+                    if (e.hash == hash && PIKA_INVOKE(key_eq_, e.key, key))
+                    {
+                        e.value = PIKA_INVOKE(
+                            func, PIKA_MOVE(e.value), PIKA_FORWARD(V, value));
+                        return;
+                    }
+                }
+            }
+
+            std::vector<entry>& entries() noexcept
+            {
+                return entries_;
+            }
+
+        private:
+            static constexpr std::size_t initial_log2_capacity = 4;
+
+            // Fibonacci hashing spreads consecutive hash values (std::hash
+            // of integers is the identity) and ignores the low bits used to
+            // select the shard of a group.
+            std::size_t slot(std::size_t hash) const noexcept
+            {
+                return std::size_t((std::uint64_t(hash) *
+                                       0x9e37'79b9'7f4a'7c15ull) >>
+                    (64 - log2_capacity_));
+            }
+
+            void grow()
+            {
+                ++log2_capacity_;
+                slots_.assign(std::size_t(1) << log2_capacity_, 0);
+
+                std::size_t const mask = slots_.size() - 1;
+                for (std::size_t n = 0; n != entries_.size(); ++n)
+                {
+                    std::size_t i = slot(entries_[n].hash);
+                    while (slots_[i] != 0)
+                    {
+                        i = (i + 1) & mask;
+                    }
+                    slots_[i] = n + 1;
+                }
+            }
+
+            Hash hash_;
+            KeyEqual key_eq_;
+            std::vector<entry> entries_;
+            std::vector<std::size_t> slots_;
+            std::size_t log2_capacity_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Placeholder for the comparison used to order the output, groups
+        // are written in unspecified order if no comparison is given.
+        struct unordered_groups
+        {
+        };
+
+        template <typename Compare>
+        inline constexpr bool is_ordered_groups_v =
+            !std::is_same_v<std::decay_t<Compare>, unordered_groups>;
+
+        // sorts the groups by their keys if an order is given
+        template <typename Entry, typename Compare>
+        void sort_reduce_by_key_groups(
+            std::vector<Entry>& groups, Compare& comp)
+        {
+            if constexpr (is_ordered_groups_v<Compare>)
+            {
+                std::sort(groups.begin(), groups.end(),
+                    [&comp](Entry const& lhs, Entry const& rhs) {
+                        return PIKA_INVOKE(comp, lhs.key, rhs.key);
+                    });
+            }
+            else
+            {
+                PIKA_UNUSED(groups);
+                PIKA_UNUSED(comp);
+            }
+        }
+
+        template <typename Entry, typename FwdIter1, typename FwdIter2>
+        parallel::detail::in_out_result<FwdIter1, FwdIter2>
+        write_reduce_by_key_groups(std::vector<Entry>& groups,
+            FwdIter1 keys_output, FwdIter2 values_output)
+        {
+            for (Entry& e : groups)
+            {
+                *keys_output++ = PIKA_MOVE(e.key);
+                *values_output++ = PIKA_MOVE(e.value);
+            }
+            return parallel::detail::in_out_result<FwdIter1, FwdIter2>{
+                keys_output, values_output};
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Every worker reduces a contiguous part of the input into a local
+        // hash table and distributes its groups into one bucket per shard
+        // (by hash value). The shards are then merged independently, each
+        // into its own hash table, and written to the output at the offset
+        // given by the sizes of the shards before it. The merge visits the
+        // workers in order, which keeps the values of each group reduced in
+        // the order of the input sequence.
+        template <typename ExPolicy, typename RanIter, typename RanIter2,
+            typename FwdIter1, typename FwdIter2, typename Func, typename Hash,
+            typename KeyEqual, typename Compare>
+        static parallel::detail::in_out_result<FwdIter1, FwdIter2>
+        reduce_by_key_unsorted_impl(ExPolicy&& policy, RanIter key_first,
+            RanIter key_last, RanIter2 values_first, FwdIter1 keys_output,
+            FwdIter2 values_output, Func&& func, Hash&& hash,
+            KeyEqual&& key_eq, Compare&& comp)
+        {
+            using key_type = typename std::iterator_traits<RanIter>::value_type;
+            using value_type =
+                typename std::iterator_traits<RanIter2>::value_type;
+            using table_type = reduce_by_key_table<key_type, value_type,
+                std::decay_t<Hash>, std::decay_t<KeyEqual>>;
+            using entry = typename table_type::entry;
+
+            std::size_t const count = std::distance(key_first, key_last);
+            std::size_t const cores =
+                parallel::execution::processing_units_count(
+                    policy.parameters(), policy.executor());
+
+            std::size_t const workers = (std::max)(
+                std::size_t(1), (std::min)(cores, count));
+            std::size_t const shards = workers;
+
+            // step 1: reduce the part of every worker locally
+            std::vector<std::vector<entry>> buckets(workers * shards);
+            parallel::detail::bulk_execute_n(
+                policy, workers, [&](std::size_t w) {
+                    std::size_t const first = count * w / workers;
+                    std::size_t const last = count * (w + 1) / workers;
+
+                    table_type table(hash, key_eq);
+                    for (std::size_t i = first; i != last; ++i)
+                    {
+                        auto&& key = key_first[i];
+                        table.insert(
+                            table.hash(key), key, values_first[i], func);
+                    }
+
+                    for (entry& e : table.entries())
+                    {
+                        buckets[w * shards + e.hash % shards].push_back(
+                            PIKA_MOVE(e));
+                    }
+                });
+
+            // step 2: merge the buckets of every shard, the groups of an
+            // ordered output are sorted per shard right away
+            std::vector<std::vector<entry>> groups(shards);
+            parallel::detail::bulk_execute_n(
+                policy, shards, [&](std::size_t s) {
+                    table_type table(hash, key_eq);
+                    for (std::size_t w = 0; w != workers; ++w)
+                    {
+                        std::vector<entry>& bucket = buckets[w * shards + s];
+                        for (entry& e : bucket)
+                        {
+                            table.insert(e.hash, PIKA_MOVE(e.key),
+                                PIKA_MOVE(e.value), func);
+                        }
+                        bucket = std::vector<entry>();
+                    }
+                    groups[s] = PIKA_MOVE(table.entries());
+                    sort_reduce_by_key_groups(groups[s], comp);
+                });
+
+            std::vector<std::size_t> offsets(shards + 1, 0);
+            for (std::size_t s = 0; s != shards; ++s)
+            {
+                offsets[s + 1] = offsets[s] + groups[s].size();
+            }
+            std::size_t const ngroups = offsets[shards];
+
+            // step 3: write the groups
+            if constexpr (is_ordered_groups_v<Compare>)
+            {
+                // the sorted shards are k-way merged by the addresses of
+                // their groups, which are then written in parts of equal
+                // size
+                std::vector<std::vector<entry*>> runs(shards);
+                for (std::size_t s = 0; s != shards; ++s)
+                {
+                    runs[s].reserve(groups[s].size());
+                    for (entry& e : groups[s])
+                    {
+                        runs[s].push_back(&e);
+                    }
+                }
+
+                std::vector<entry*> merged(ngroups);
+                auto key_of = [](entry const* e) -> key_type const& {
+                    return e->key;
+                };
+                parallel::detail::merge_k_impl(policy, runs.begin(),
+                    runs.end(), merged.begin(), comp, key_of);
+
+                parallel::detail::bulk_execute_n(
+                    policy, shards, [&](std::size_t s) {
+                        std::size_t const first = ngroups * s / shards;
+                        std::size_t const last = ngroups * (s + 1) / shards;
+
+                        auto keys = std::next(keys_output, first);
+                        auto values = std::next(values_output, first);
+                        for (std::size_t i = first; i != last; ++i)
+                        {
+                            *keys++ = PIKA_MOVE(merged[i]->key);
+                            *values++ = PIKA_MOVE(merged[i]->value);
+                        }
+                    });
+            }
+            else
+            {
+                parallel::detail::bulk_execute_n(
+                    policy, shards, [&](std::size_t s) {
+                        write_reduce_by_key_groups(groups[s],
+                            std::next(keys_output, offsets[s]),
+                            std::next(values_output, offsets[s]));
+                    });
+            }
+
+            return parallel::detail::in_out_result<FwdIter1, FwdIter2>{
+                std::next(keys_output, ngroups),
+                std::next(values_output, ngroups)};
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // reduce_by_key_unsorted wrapper struct
+        template <typename FwdIter1, typename FwdIter2>
+        struct reduce_by_key_unsorted
+          : public parallel::detail::algorithm<
+                reduce_by_key_unsorted<FwdIter1, FwdIter2>,
+                parallel::detail::in_out_result<FwdIter1, FwdIter2>>
+        {
+            reduce_by_key_unsorted()
+              : reduce_by_key_unsorted::algorithm("reduce_by_key_unsorted")
+            {
+            }
+
+            template <typename ExPolicy, typename RanIter, typename RanIter2,
+                typename Func, typename Hash, typename KeyEqual,
+                typename Compare>
+            static parallel::detail::in_out_result<FwdIter1, FwdIter2>
+            sequential(ExPolicy&&, RanIter key_first, RanIter key_last,
+                RanIter2 values_first, FwdIter1 keys_output,
+                FwdIter2 values_output, Func&& func, Hash&& hash,
+                KeyEqual&& key_eq, Compare&& comp)
+            {
+                using key_type =
+                    typename std::iterator_traits<RanIter>::value_type;
+                using value_type =
+                    typename std::iterator_traits<RanIter2>::value_type;
+
+                reduce_by_key_table<key_type, value_type, std::decay_t<Hash>,
+                    std::decay_t<KeyEqual>>
+                    table(hash, key_eq);
+
+                for (/* */; key_first != key_last;
+                     (void) ++key_first, ++values_first)
+                {
+                    auto&& key = *key_first;
+                    table.insert(table.hash(key), key, *values_first, func);
+                }
+
+                // without a comparison the groups are written in the order
+                // of the first occurrence of their keys
+                sort_reduce_by_key_groups(table.entries(), comp);
+                return write_reduce_by_key_groups(
+                    table.entries(), keys_output, values_output);
+            }
+
+            template <typename ExPolicy, typename RanIter, typename RanIter2,
+                typename Func, typename Hash, typename KeyEqual,
+                typename Compare>
+            static typename parallel::detail::algorithm_result<ExPolicy,
+                parallel::detail::in_out_result<FwdIter1, FwdIter2>>::type
+            parallel(ExPolicy&& policy, RanIter key_first, RanIter key_last,
+                RanIter2 values_first, FwdIter1 keys_output,
+                FwdIter2 values_output, Func&& func, Hash&& hash,
+                KeyEqual&& key_eq, Compare&& comp)
+            {
+                return parallel::detail::algorithm_result<ExPolicy,
+                    parallel::detail::in_out_result<FwdIter1, FwdIter2>>::
+                    get(parallel::execution::async_execute(policy.executor(),
+                        pika::util::detail::deferred_call(
+                            &reduce_by_key_unsorted_impl<ExPolicy&&, RanIter,
+                                RanIter2, FwdIter1, FwdIter2, Func&&, Hash&&,
+                                KeyEqual&&, Compare&&>,
+                            policy, key_first, key_last, values_first,
+                            keys_output, values_output,
+                            PIKA_FORWARD(Func, func), PIKA_FORWARD(Hash, hash),
+                            PIKA_FORWARD(KeyEqual, key_eq),
+                            PIKA_FORWARD(Compare, comp))));
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Reduce by Key Unsorted reduces the values of all elements with equal
+    /// keys supplied in key/value pairs, regardless of where in
+    /// [key_first, key_last) the keys occur. The algorithm produces a single
+    /// output key and value for each set of equal keys, the value being the
+    /// GENERALIZED_NONCOMMUTATIVE_SUM(func, *values...) of the values of all
+    /// elements with that key, taken in the order of the input sequence.
+    /// Unlike \a reduce_by_key the keys do not have to be sorted, the groups
+    /// are collected in hash tables instead. This is cheaper than sorting by
+    /// key whenever the number of distinct keys is small.
+    /// The number of keys supplied must match the number of values.
+    ///
+    /// \note   Complexity: O(\a last - \a first) applications of the
+    ///         hash function \a hash and of the binary operation \a func,
+    ///         expected O(\a last - \a first) applications of \a key_eq.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RanIter     The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam RanIter2    The type of the value iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter1    The type of the iterator representing the
+    ///                     destination key range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination value range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam Func        The type of the function/function object to use
+    ///                     (deduced). Assumed to be std::plus otherwise.
+    /// \tparam Hash        The type of the hash function to use for the keys
+    ///                     (deduced). Assumed to be std::hash otherwise.
+    /// \tparam KeyEqual    The type of the function/function object to use
+    ///                     to compare keys for equality (deduced).
+    ///                     Assumed to be std::equal_to otherwise.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param key_first    Refers to the beginning of the sequence of key elements
+    ///                     the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of key elements the
+    ///                     algorithm will be applied to.
+    /// \param values_first Refers to the beginning of the sequence of value elements
+    ///                     the algorithm will be applied to.
+    /// \param keys_output  Refers to the start output location for the keys
+    ///                     produced by the algorithm. The output ranges must
+    ///                     not overlap the input ranges.
+    /// \param values_output Refers to the start output location for the values
+    ///                     produced by the algorithm.
+    /// \param func         Specifies the function (or function object) which
+    ///                     will be invoked to combine the values of elements
+    ///                     with equal keys. The signature of this function
+    ///                     should be equivalent to:
+    ///                     \code
+    ///                     Ret fun(const Type1 &a, const Type1 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&.
+    ///                     The types \a Type1 \a Ret must be
+    ///                     such that an object of type \a RanIter2 can be
+    ///                     dereferenced and then implicitly converted to any
+    ///                     of those types.
+    /// \param hash         Specifies the hash function to apply to the keys.
+    ///                     Equal keys must produce equal hash values.
+    /// \param key_eq       key_eq is a callable object. The return value of
+    ///                     the INVOKE operation applied to two keys, when
+    ///                     contextually converted to bool, yields true if the
+    ///                     keys are equal, and false otherwise.
+    ///
+    /// The groups are written in unspecified order, the sequential execution
+    /// policy writes them in the order of the first occurrence of their keys.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a reduce_by_key_unsorted algorithm returns a
+    ///           \a pika::future<pair<Iter1,Iter2>> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a pair<Iter1,Iter2>
+    ///           otherwise. The returned iterators refer to the ends of the
+    ///           written output ranges.
+    template <typename ExPolicy, typename RanIter, typename RanIter2,
+        typename FwdIter1, typename FwdIter2,
+        typename Func =
+            std::plus<typename std::iterator_traits<RanIter2>::value_type>,
+        typename Hash =
+            std::hash<typename std::iterator_traits<RanIter>::value_type>,
+        typename KeyEqual =
+            std::equal_to<typename std::iterator_traits<RanIter>::value_type>,
+        PIKA_CONCEPT_REQUIRES_(pika::is_execution_policy<ExPolicy>::value&&
+                pika::traits::is_iterator<RanIter>::value&&
+                    pika::traits::is_iterator<RanIter2>::value&&
+                        pika::traits::is_iterator<FwdIter1>::value&&
+                            pika::traits::is_iterator<FwdIter2>::value)>
+    typename parallel::detail::algorithm_result<ExPolicy,
+        parallel::detail::in_out_result<FwdIter1, FwdIter2>>::type
+    reduce_by_key_unsorted(ExPolicy&& policy, RanIter key_first,
+        RanIter key_last, RanIter2 values_first, FwdIter1 keys_output,
+        FwdIter2 values_output, Func&& func = Func(), Hash&& hash = Hash(),
+        KeyEqual&& key_eq = KeyEqual())
+    {
+        static_assert(
+            (pika::traits::is_random_access_iterator<RanIter>::value) &&
+                (pika::traits::is_random_access_iterator<RanIter2>::value) &&
+                (pika::traits::is_forward_iterator<FwdIter1>::value) &&
+                (pika::traits::is_forward_iterator<FwdIter2>::value),
+            "iterators : Random_access for inputs and forward for outputs.");
+
+        return detail::reduce_by_key_unsorted<FwdIter1, FwdIter2>().call(
+            PIKA_FORWARD(ExPolicy, policy), key_first, key_last, values_first,
+            keys_output, values_output, PIKA_FORWARD(Func, func),
+            PIKA_FORWARD(Hash, hash), PIKA_FORWARD(KeyEqual, key_eq),
+            detail::unordered_groups{});
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Reduce by Key Unsorted as above, but the groups are written in
+    /// ascending order of their keys as defined by \a comp.
+    ///
+    /// \note   Complexity: O(\a last - \a first) applications of the
+    ///         hash function \a hash and of the binary operation \a func,
+    ///         expected O(\a last - \a first) applications of \a key_eq and
+    ///         O(N log(N)) applications of \a comp, where N is the number of
+    ///         distinct keys.
+    ///
+    /// The parallel versions sort the groups of every shard of the hash
+    /// tables concurrently and merge the sorted shards in parallel.
+    ///
+    /// \tparam Compare     The type of the function/function object to use
+    ///                     to order the keys of the output (deduced).
+    ///
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to two keys, when
+    ///                     contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. \a comp has to induce
+    ///                     a strict weak ordering on the keys.
+    ///
+    /// \returns  The \a reduce_by_key_unsorted algorithm returns a
+    ///           \a pika::future<pair<Iter1,Iter2>> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a pair<Iter1,Iter2>
+    ///           otherwise. The returned iterators refer to the ends of the
+    ///           written output ranges.
+    template <typename ExPolicy, typename RanIter, typename RanIter2,
+        typename FwdIter1, typename FwdIter2, typename Func, typename Hash,
+        typename KeyEqual, typename Compare,
+        PIKA_CONCEPT_REQUIRES_(pika::is_execution_policy<ExPolicy>::value&&
+                pika::traits::is_iterator<RanIter>::value&&
+                    pika::traits::is_iterator<RanIter2>::value&&
+                        pika::traits::is_iterator<FwdIter1>::value&&
+                            pika::traits::is_iterator<FwdIter2>::value)>
+    typename parallel::detail::algorithm_result<ExPolicy,
+        parallel::detail::in_out_result<FwdIter1, FwdIter2>>::type
+    reduce_by_key_unsorted(ExPolicy&& policy, RanIter key_first,
+        RanIter key_last, RanIter2 values_first, FwdIter1 keys_output,
+        FwdIter2 values_output, Func&& func, Hash&& hash, KeyEqual&& key_eq,
+        Compare&& comp)
+    {
+        static_assert(
+            (pika::traits::is_random_access_iterator<RanIter>::value) &&
+                (pika::traits::is_random_access_iterator<RanIter2>::value) &&
+                (pika::traits::is_forward_iterator<FwdIter1>::value) &&
+                (pika::traits::is_forward_iterator<FwdIter2>::value),
+            "iterators : Random_access for inputs and forward for outputs.");
+
+        return detail::reduce_by_key_unsorted<FwdIter1, FwdIter2>().call(
+            PIKA_FORWARD(ExPolicy, policy), key_first, key_last, values_first,
+            keys_output, values_output, PIKA_FORWARD(Func, func),
+            PIKA_FORWARD(Hash, hash), PIKA_FORWARD(KeyEqual, key_eq),
+            PIKA_FORWARD(Compare, comp));
+    }
+}    // namespace pika
@@ -228,6 +228,7 @@ namespace pika {
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/scan_partitioner.hpp>
+#include <pika/parallel/util/scratch_memory.hpp>
 #include <pika/parallel/util/transfer.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
@@ -292,7 +293,8 @@ namespace pika::parallel::detail {
             if (count == 0)
                 return algorithm_result::get(PIKA_MOVE(first));
 
-            std::shared_ptr<bool[]> flags(new bool[count]);
+            std::shared_ptr<bool[]> flags =
+                make_scratch_array<bool>(policy, count);
             std::size_t init = 0u;
 
             using pika::util::make_zip_iterator;
@@ -479,12 +479,16 @@ namespace pika {
 #include <pika/algorithms/traits/projected.hpp>
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
-#include <pika/parallel/algorithms/for_each.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/replace.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/result_types.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -493,21 +497,6 @@ namespace pika::parallel::detail {
     ///////////////////////////////////////////////////////////////////////////
     // replace
     /// \cond NOINTERNAL
-    // sequential replace
-    template <typename InIter, typename T1, typename T2, typename Proj>
-    inline InIter sequential_replace(InIter first, InIter last,
-        T1 const& old_value, T2 const& new_value, Proj&& proj)
-    {
-        for (/* */; first != last; ++first)
-        {
-            if (PIKA_INVOKE(proj, *first) == old_value)
-            {
-                *first = new_value;
-            }
-        }
-        return first;
-    }
-
     template <typename Iter>
     struct replace : public algorithm<replace<Iter>, Iter>
     {
@@ -521,7 +510,7 @@ namespace pika::parallel::detail {
         static InIter sequential(ExPolicy, InIter first, InIter last,
             T1 const& old_value, T2 const& new_value, Proj&& proj)
         {
-            return sequential_replace(
+            return sequential_replace<std::decay_t<ExPolicy>>(
                 first, last, old_value, new_value, PIKA_FORWARD(Proj, proj));
         }
 
@@ -531,18 +520,23 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, FwdIter first, FwdIter last,
             T1 const& old_value, T2 const& new_value, Proj&& proj)
         {
-            using type = typename std::iterator_traits<FwdIter>::value_type;
-
-            return for_each_n<FwdIter>().call(
-                PIKA_FORWARD(ExPolicy, policy), first,
-                std::distance(first, last),
-                [old_value, new_value, proj = PIKA_FORWARD(Proj, proj)](
-                    type& t) -> void {
-                    if (PIKA_INVOKE(proj, t) == old_value)
-                    {
-                        t = new_value;
-                    }
-                },
+            std::size_t count = std::distance(first, last);
+            if (count == 0)
+            {
+                return algorithm_result<ExPolicy, FwdIter>::get(
+                    PIKA_MOVE(first));
+            }
+
+            auto f1 = [old_value, new_value, proj = PIKA_FORWARD(Proj, proj)](
+                          FwdIter part_begin, std::size_t part_size,
+                          std::size_t) mutable -> void {
+                sequential_replace<std::decay_t<ExPolicy>>(part_begin,
+                    std::next(part_begin, part_size), old_value, new_value,
+                    proj);
+            };
+
+            return foreach_partitioner<ExPolicy>::call(
+                PIKA_FORWARD(ExPolicy, policy), first, count, PIKA_MOVE(f1),
                 projection_identity());
         }
     };
@@ -551,23 +545,6 @@ namespace pika::parallel::detail {
     ///////////////////////////////////////////////////////////////////////////
     // replace_if
     /// \cond NOINTERNAL
-
-    // sequential replace_if
-    template <typename InIter, typename Sent, typename F, typename T,
-        typename Proj>
-    inline InIter sequential_replace_if(
-        InIter first, Sent sent, F&& f, T const& new_value, Proj&& proj)
-    {
-        for (/* */; first != sent; ++first)
-        {
-            if (PIKA_INVOKE(f, PIKA_INVOKE(proj, *first)))
-            {
-                *first = new_value;
-            }
-        }
-        return first;
-    }
-
     template <typename Iter>
     struct replace_if : public algorithm<replace_if<Iter>, Iter>
     {
@@ -581,8 +558,8 @@ namespace pika::parallel::detail {
         static InIter sequential(ExPolicy, InIter first, Sent last, F&& f,
             T const& new_value, Proj&& proj)
         {
-            return sequential_replace_if(first, last, PIKA_FORWARD(F, f),
-                new_value, PIKA_FORWARD(Proj, proj));
+            return sequential_replace_if<std::decay_t<ExPolicy>>(first, last,
+                PIKA_FORWARD(F, f), new_value, PIKA_FORWARD(Proj, proj));
         }
 
         template <typename ExPolicy, typename FwdIter, typename Sent,
@@ -591,17 +568,22 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, FwdIter first, Sent last, F&& f,
             T const& new_value, Proj&& proj)
         {
-            using type = typename std::iterator_traits<FwdIter>::value_type;
-
-            return for_each_n<FwdIter>().call(
-                PIKA_FORWARD(ExPolicy, policy), first, (distance) (first, last),
-                [new_value, f = PIKA_FORWARD(F, f),
-                    proj = PIKA_FORWARD(Proj, proj)](type& t) mutable -> void {
-                    if (PIKA_INVOKE(f, PIKA_INVOKE(proj, t)))
-                    {
-                        t = new_value;
-                    }
-                },
+            std::size_t count = (distance) (first, last);
+            if (count == 0)
+            {
+                return algorithm_result<ExPolicy, FwdIter>::get(
+                    PIKA_MOVE(first));
+            }
+
+            auto f1 = [new_value, f = PIKA_FORWARD(F, f),
+                          proj = PIKA_FORWARD(Proj, proj)](FwdIter part_begin,
+                          std::size_t part_size, std::size_t) mutable -> void {
+                sequential_replace_if<std::decay_t<ExPolicy>>(part_begin,
+                    std::next(part_begin, part_size), f, new_value, proj);
+            };
+
+            return foreach_partitioner<ExPolicy>::call(
+                PIKA_FORWARD(ExPolicy, policy), first, count, PIKA_MOVE(f1),
                 projection_identity());
         }
     };
@@ -610,24 +592,6 @@ namespace pika::parallel::detail {
     ///////////////////////////////////////////////////////////////////////////
     // replace_copy
     /// \cond NOINTERNAL
-
-    // sequential replace_copy
-    template <typename InIter, typename Sent, typename OutIter, typename T,
-        typename Proj>
-    inline in_out_result<InIter, OutIter>
-    sequential_replace_copy(InIter first, Sent sent, OutIter dest,
-        T const& old_value, T const& new_value, Proj&& proj)
-    {
-        for (/* */; first != sent; ++first)
-        {
-            if (PIKA_INVOKE(proj, *first) == old_value)
-                *dest++ = new_value;
-            else
-                *dest++ = *first;
-        }
-        return in_out_result<InIter, OutIter>(first, dest);
-    }
-
     template <typename IterPair>
     struct replace_copy : public algorithm<replace_copy<IterPair>, IterPair>
     {
@@ -642,8 +606,8 @@ namespace pika::parallel::detail {
         sequential(ExPolicy, InIter first, Sent sent, OutIter dest,
             T const& old_value, T const& new_value, Proj&& proj)
         {
-            return sequential_replace_copy(first, sent, dest, old_value,
-                new_value, PIKA_FORWARD(Proj, proj));
+            return sequential_replace_copy<std::decay_t<ExPolicy>>(first, sent,
+                dest, old_value, new_value, PIKA_FORWARD(Proj, proj));
         }
 
         template <typename ExPolicy, typename FwdIter1, typename Sent,
@@ -654,21 +618,30 @@ namespace pika::parallel::detail {
             T const& old_value, T const& new_value, Proj&& proj)
         {
             using zip_iterator = pika::util::zip_iterator<FwdIter1, FwdIter2>;
-            using reference = typename zip_iterator::reference;
 
-            return get_in_out_result(for_each_n<zip_iterator>().call(
+            std::size_t count = (distance) (first, sent);
+            if (count == 0)
+            {
+                return algorithm_result<ExPolicy,
+                    in_out_result<FwdIter1, FwdIter2>>::get(
+                    in_out_result<FwdIter1, FwdIter2>{
+                        PIKA_MOVE(first), PIKA_MOVE(dest)});
+            }
+
+            auto f1 = [old_value, new_value, proj = PIKA_FORWARD(Proj, proj)](
+                          zip_iterator part_begin, std::size_t part_size,
+                          std::size_t) mutable -> void {
+                auto const& iters = part_begin.get_iterator_tuple();
+                sequential_replace_copy<std::decay_t<ExPolicy>>(
+                    std::get<0>(iters),
+                    std::next(std::get<0>(iters), part_size),
+                    std::get<1>(iters), old_value, new_value, proj);
+            };
+
+            return get_in_out_result(foreach_partitioner<ExPolicy>::call(
                 PIKA_FORWARD(ExPolicy, policy),
-                pika::util::make_zip_iterator(first, dest),
-                (distance) (first, sent),
-                [old_value, new_value, proj = PIKA_FORWARD(Proj, proj)](
-                    reference t) -> void {
-                    using std::get;
-                    if (PIKA_INVOKE(proj, get<0>(t)) == old_value)
-                        get<1>(t) = new_value;
-                    else
-                        get<1>(t) = get<0>(t);    //-V573
-                },
-                projection_identity()));
+                pika::util::make_zip_iterator(first, dest), count,
+                PIKA_MOVE(f1), projection_identity()));
         }
     };
     /// \endcond
@@ -676,28 +649,6 @@ namespace pika::parallel::detail {
     ///////////////////////////////////////////////////////////////////////////
     // replace_copy_if
     /// \cond NOINTERNAL
-
-    // sequential replace_copy_if
-    template <typename InIter, typename Sent, typename OutIter, typename F,
-        typename T, typename Proj>
-    inline in_out_result<InIter, OutIter>
-    sequential_replace_copy_if(InIter first, Sent sent, OutIter dest, F&& f,
-        T const& new_value, Proj&& proj)
-    {
-        for (/* */; first != sent; ++first)
-        {
-            if (PIKA_INVOKE(f, PIKA_INVOKE(proj, *first)))
-            {
-                *dest++ = new_value;
-            }
-            else
-            {
-                *dest++ = *first;
-            }
-        }
-        return in_out_result<InIter, OutIter>{first, dest};
-    }
-
     template <typename IterPair>
     struct replace_copy_if
       : public algorithm<replace_copy_if<IterPair>, IterPair>
@@ -712,8 +663,9 @@ namespace pika::parallel::detail {
         static in_out_result<InIter, OutIter> sequential(ExPolicy, InIter first,
             Sent sent, OutIter dest, F&& f, T const& new_value, Proj&& proj)
         {
-            return sequential_replace_copy_if(first, sent, dest,
-                PIKA_FORWARD(F, f), new_value, PIKA_FORWARD(Proj, proj));
+            return sequential_replace_copy_if<std::decay_t<ExPolicy>>(first,
+                sent, dest, PIKA_FORWARD(F, f), new_value,
+                PIKA_FORWARD(Proj, proj));
         }
 
         template <typename ExPolicy, typename FwdIter1, typename Sent,
@@ -724,26 +676,31 @@ namespace pika::parallel::detail {
             F&& f, T const& new_value, Proj&& proj)
         {
             using zip_iterator = pika::util::zip_iterator<FwdIter1, FwdIter2>;
-            using reference = typename zip_iterator::reference;
 
-            return get_in_out_result(for_each_n<zip_iterator>().call(
+            std::size_t count = (distance) (first, sent);
+            if (count == 0)
+            {
+                return algorithm_result<ExPolicy,
+                    in_out_result<FwdIter1, FwdIter2>>::get(
+                    in_out_result<FwdIter1, FwdIter2>{
+                        PIKA_MOVE(first), PIKA_MOVE(dest)});
+            }
+
+            auto f1 = [new_value, f = PIKA_FORWARD(F, f),
+                          proj = PIKA_FORWARD(Proj, proj)](
+                          zip_iterator part_begin, std::size_t part_size,
+                          std::size_t) mutable -> void {
+                auto const& iters = part_begin.get_iterator_tuple();
+                sequential_replace_copy_if<std::decay_t<ExPolicy>>(
+                    std::get<0>(iters),
+                    std::next(std::get<0>(iters), part_size),
+                    std::get<1>(iters), f, new_value, proj);
+            };
+
+            return get_in_out_result(foreach_partitioner<ExPolicy>::call(
                 PIKA_FORWARD(ExPolicy, policy),
-                pika::util::make_zip_iterator(first, dest),
-                (distance) (first, sent),
-                [new_value, f = PIKA_FORWARD(F, f),
-                    proj = PIKA_FORWARD(Proj, proj)](
-                    reference t) mutable -> void {
-                    using std::get;
-                    if (PIKA_INVOKE(f, PIKA_INVOKE(proj, get<0>(t))))
-                    {
-                        get<1>(t) = new_value;
-                    }
-                    else
-                    {
-                        get<1>(t) = get<0>(t);    //-V573
-                    }
-                },
-                projection_identity()));
+                pika::util::make_zip_iterator(first, dest), count,
+                PIKA_MOVE(f1), projection_identity()));
         }
     };
     /// \endcond
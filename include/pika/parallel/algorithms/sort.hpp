@@ -241,6 +241,7 @@ namespace pika {
 #include <pika/executors/execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/indirect.hpp>
 #include <pika/parallel/algorithms/detail/is_sorted.hpp>
 #include <pika/parallel/algorithms/detail/pivot.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
@@ -252,13 +253,17 @@ namespace pika {
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <iterator>
 #include <list>
+#include <memory>
+#include <numeric>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #if defined(PIKA_HAVE_TUPLE_RVALUE_SWAP)
 namespace std {
@@ -426,6 +431,48 @@ namespace pika::parallel::detail {
             PIKA_FORWARD(Comp, comp), chunk_size);
     }
 
+    /// \brief Sort an array of indices into the sequence and move the
+    ///        elements to their final position once afterwards
+    template <typename ExPolicy, typename RandomIt, typename Comp>
+    pika::future<RandomIt> parallel_sort_indirect_async(
+        ExPolicy&& policy, RandomIt first, RandomIt last, Comp&& comp)
+    {
+        using value_type = typename std::iterator_traits<RandomIt>::value_type;
+        using index_iterator = std::vector<std::size_t>::iterator;
+
+        std::uint32_t const cores =
+            static_cast<std::uint32_t>(execution::processing_units_count(
+                policy.parameters(), policy.executor()));
+
+        std::size_t const count = std::size_t(last - first);
+        auto scratch = std::make_shared<indirect_sort_scratch<value_type>>();
+
+        // the index is filled by a task as well, the caller only launches
+        // the sort
+        pika::future<index_iterator> f = execution::async_execute(
+            policy.executor(),
+            [policy, first, cores, count, scratch,
+                comp = std::decay_t<Comp>(PIKA_FORWARD(Comp, comp))]() mutable
+            -> pika::future<index_iterator> {
+                prepare_indirect_sort(
+                    policy.executor(), cores, *scratch, count);
+                return parallel_sort_async(policy, scratch->index.begin(),
+                    scratch->index.end(),
+                    indirect_compare<RandomIt, std::decay_t<Comp>>(
+                        first, PIKA_MOVE(comp)));
+            });
+
+        return pika::dataflow(
+            [policy, first, last, cores, scratch = PIKA_MOVE(scratch)](
+                pika::future<index_iterator>&& f) mutable -> RandomIt {
+                f.get();
+                parallel_apply_permutation(
+                    policy.executor(), cores, first, *scratch);
+                return last;
+            },
+            PIKA_MOVE(f));
+    }
+
     ///////////////////////////////////////////////////////////////////////
     // sort
     template <typename RandomIt>
@@ -442,8 +489,21 @@ namespace pika::parallel::detail {
             ExPolicy, RandomIt first, Sent last, Comp&& comp, Proj&& proj)
         {
             auto last_iter = advance_to_sentinel(first, last);
-            std::sort(
-                first, last_iter, compare_projected<Comp&, Proj&>(comp, proj));
+            if constexpr (sort_indirectly_v<RandomIt>)
+            {
+                std::vector<std::size_t> index(last_iter - first);
+                std::iota(index.begin(), index.end(), std::size_t(0));
+
+                std::sort(index.begin(), index.end(),
+                    indirect_compare<RandomIt, compare_projected<Comp&, Proj&>>(
+                        first, compare_projected<Comp&, Proj&>(comp, proj)));
+                apply_permutation(first, index);
+            }
+            else
+            {
+                std::sort(first, last_iter,
+                    compare_projected<Comp&, Proj&>(comp, proj));
+            }
             return last_iter;
         }
 
@@ -460,9 +520,19 @@ namespace pika::parallel::detail {
             {
                 // call the sort routine and return the right type,
                 // depending on execution policy
-                return algorithm_result::get(
-                    parallel_sort_async(PIKA_FORWARD(ExPolicy, policy), first,
-                        last, compare_projected<Comp&, Proj&>(comp, proj)));
+                if constexpr (sort_indirectly_v<RandomIt>)
+                {
+                    return algorithm_result::get(parallel_sort_indirect_async(
+                        PIKA_FORWARD(ExPolicy, policy), first, last,
+                        compare_projected<Comp&, Proj&>(comp, proj)));
+                }
+                else
+                {
+                    return algorithm_result::get(
+                        parallel_sort_async(PIKA_FORWARD(ExPolicy, policy),
+                            first, last,
+                            compare_projected<Comp&, Proj&>(comp, proj)));
+                }
             }
             catch (...)
             {
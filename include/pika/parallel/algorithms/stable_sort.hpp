@@ -219,6 +219,54 @@ namespace pika {
     stable_sort(ExPolicy&& policy, RandomIt first, RandomIt last, Comp&& comp,
         Proj&& proj);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// Sorts the elements in the range [first, last) in ascending order like
+    /// the overloads above, taking the temporary memory the algorithm needs
+    /// from the given workspace. The workspace keeps that memory for later
+    /// calls, sorting sequences no larger than the ones sorted before with the
+    /// same workspace does not allocate any of it. The overload without an
+    /// execution policy sorts sequentially in the calling thread.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a pika::parallel::detail::projection_identity.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param workspace    The \a sort_workspace to take temporary memory
+    ///                     from. It must not be used by any other sort until
+    ///                     this one has finished.
+    /// \param comp         comp is a callable object inducing a strict weak
+    ///                     ordering on the values.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \returns  The \a stable_sort algorithm returns a
+    ///           \a pika::future<void> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns nothing
+    ///           otherwise.
+    ///
+    template <typename ExPolicy, typename RandomIt, typename Comp,
+        typename Proj>
+    typename parallel::detail::algorithm_result<ExPolicy>::type
+    stable_sort(ExPolicy&& policy, RandomIt first, RandomIt last,
+        sort_workspace<typename std::iterator_traits<RandomIt>::value_type>&
+            workspace,
+        Comp&& comp, Proj&& proj);
+
     // clang-format on
 }    // namespace pika
 
@@ -241,6 +289,7 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/indirect.hpp>
 #include <pika/parallel/algorithms/detail/parallel_stable_sort.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
 #include <pika/parallel/algorithms/detail/spin_sort.hpp>
@@ -249,13 +298,17 @@ namespace pika {
 #include <pika/parallel/util/detail/chunk_size.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/scratch_memory.hpp>
+#include <pika/parallel/util/sort_workspace.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <iterator>
 #include <list>
+#include <numeric>
 #include <type_traits>
 #include <utility>
 
@@ -268,21 +321,66 @@ namespace pika::parallel::detail {
     template <typename RandomIt>
     struct stable_sort : public algorithm<stable_sort<RandomIt>, RandomIt>
     {
+        using value_type = typename std::iterator_traits<RandomIt>::value_type;
+        using workspace_type = sort_workspace<value_type>;
+        using scratch_type = indirect_sort_scratch<value_type>;
+
         stable_sort()
           : stable_sort::algorithm("stable_sort")
         {
         }
 
+        // the memory of indirect sorts is kept in the workspace if given
+        static scratch_type& indirect_scratch(
+            workspace_type* workspace, scratch_type& local_scratch)
+        {
+            return workspace != nullptr ?
+                workspace->template scratch<scratch_type>() :
+                local_scratch;
+        }
+
         template <typename ExPolicy, typename Sentinel, typename Compare,
             typename Proj>
-        static RandomIt sequential(ExPolicy, RandomIt first, Sentinel last,
-            Compare&& comp, Proj&& proj)
+        static RandomIt sequential(ExPolicy&& policy, RandomIt first,
+            Sentinel last, Compare&& comp, Proj&& proj,
+            workspace_type* workspace = nullptr)
         {
             using compare_type = compare_projected<Compare&, Proj&>;
 
-            auto last_iter = advance_to_sentinel(first, last);
+            auto last_iter = first;
+            std::size_t count = advance_and_get_distance(last_iter, last);
+
+            if constexpr (sort_indirectly_v<RandomIt>)
+            {
+                scratch_type local_scratch;
+                scratch_type& scratch =
+                    indirect_scratch(workspace, local_scratch);
+
+                scratch.resize(count, 1);
+                std::iota(scratch.index.begin(), scratch.index.end(),
+                    std::size_t(0));
 
-            spin_sort(first, last_iter, compare_type(comp, proj));
+                std::size_t naux = (count + 1) >> 1;
+                std::size_t* aux = scratch.index_workspace.buffer(naux);
+                spin_sort(scratch.index.begin(), scratch.index.end(),
+                    indirect_compare<RandomIt, compare_type>(
+                        first, compare_type(comp, proj)),
+                    range<std::size_t*>(aux, aux + naux));
+
+                apply_permutation(first, scratch.index);
+            }
+            else if (workspace != nullptr)
+            {
+                std::size_t naux = (count + 1) >> 1;
+                auto* aux = workspace->buffer(naux);
+                spin_sort(first, last_iter, compare_type(comp, proj),
+                    range<decltype(aux)>(aux, aux + naux));
+            }
+            else
+            {
+                spin_sort(first, last_iter, compare_type(comp, proj),
+                    get_scratch_resource(policy));
+            }
             return last_iter;
         }
 
@@ -290,7 +388,7 @@ namespace pika::parallel::detail {
             typename Proj>
         static typename algorithm_result<ExPolicy, RandomIt>::type
         parallel(ExPolicy&& policy, RandomIt first, Sentinel last,
-            Compare&& compare, Proj&& proj)
+            Compare&& compare, Proj&& proj, workspace_type* workspace = nullptr)
         {
             using algorithm_result = algorithm_result<ExPolicy, RandomIt>;
             using compare_type = compare_projected<Compare&, Proj&>;
@@ -322,9 +420,41 @@ namespace pika::parallel::detail {
                 // depending on execution policy
                 compare_type comp(compare, proj);
 
-                return algorithm_result::get(
-                    parallel_stable_sort(policy.executor(), first, last_iter,
-                        cores, chunk_size, PIKA_MOVE(comp)));
+                if constexpr (sort_indirectly_v<RandomIt>)
+                {
+                    scratch_type local_scratch;
+                    scratch_type& scratch =
+                        indirect_scratch(workspace, local_scratch);
+                    if (workspace != nullptr)
+                    {
+                        scratch.index_workspace.oversampling(
+                            workspace->oversampling());
+                    }
+
+                    std::uint32_t const nthreads =
+                        static_cast<std::uint32_t>(cores);
+                    prepare_indirect_sort(
+                        policy.executor(), nthreads, scratch, count);
+
+                    parallel_stable_sort(policy.executor(),
+                        scratch.index.begin(), scratch.index.end(), cores,
+                        chunk_size,
+                        indirect_compare<RandomIt, compare_type>(
+                            first, PIKA_MOVE(comp)),
+                        &scratch.index_workspace);
+
+                    parallel_apply_permutation(
+                        policy.executor(), nthreads, first, scratch);
+
+                    return algorithm_result::get(PIKA_MOVE(last_iter));
+                }
+                else
+                {
+                    return algorithm_result::get(parallel_stable_sort(
+                        policy.executor(), first, last_iter, cores, chunk_size,
+                        PIKA_MOVE(comp), workspace,
+                        &get_scratch_resource(policy)));
+                }
             }
             catch (...)
             {
@@ -399,6 +529,69 @@ namespace pika {
                        PIKA_FORWARD(ExPolicy, policy), first, last,
                        PIKA_FORWARD(Comp, comp), PIKA_FORWARD(Proj, proj));
         }
+
+        // clang-format off
+        template <typename RandomIt,
+            typename Comp = pika::parallel::detail::less,
+            typename Proj = parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<RandomIt> &&
+                parallel::detail::is_projected<Proj, RandomIt>::value &&
+                parallel::detail::is_indirect_callable<
+                    pika::execution::sequenced_policy, Comp,
+                    parallel::detail::projected<Proj, RandomIt>,
+                    parallel::detail::projected<Proj, RandomIt>
+                >::value
+            )>
+        // clang-format on
+        friend void tag_fallback_invoke(pika::stable_sort_t, RandomIt first,
+            RandomIt last,
+            sort_workspace<typename std::iterator_traits<RandomIt>::value_type>&
+                workspace,
+            Comp&& comp = Comp(), Proj&& proj = Proj())
+        {
+            static_assert(pika::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+
+            pika::parallel::detail::stable_sort<RandomIt>().call(
+                pika::execution::seq, first, last, PIKA_FORWARD(Comp, comp),
+                PIKA_FORWARD(Proj, proj), &workspace);
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandomIt,
+            typename Comp = pika::parallel::detail::less,
+            typename Proj = parallel::detail::projection_identity,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy<ExPolicy>::value &&
+                pika::traits::is_iterator_v<RandomIt> &&
+                parallel::detail::is_projected<Proj, RandomIt>::value &&
+                parallel::detail::is_indirect_callable<ExPolicy, Comp,
+                    parallel::detail::projected<Proj, RandomIt>,
+                    parallel::detail::projected<Proj, RandomIt>
+                >::value
+            )>
+        // clang-format on
+        friend typename parallel::detail::algorithm_result<ExPolicy>::type
+        tag_fallback_invoke(pika::stable_sort_t, ExPolicy&& policy,
+            RandomIt first, RandomIt last,
+            sort_workspace<typename std::iterator_traits<RandomIt>::value_type>&
+                workspace,
+            Comp&& comp = Comp(), Proj&& proj = Proj())
+        {
+            static_assert(pika::traits::is_random_access_iterator_v<RandomIt>,
+                "Requires a random access iterator.");
+
+            using result_type =
+                typename pika::parallel::detail::algorithm_result<
+                    ExPolicy>::type;
+
+            return pika::detail::void_guard<result_type>(),
+                   pika::parallel::detail::stable_sort<RandomIt>().call(
+                       PIKA_FORWARD(ExPolicy, policy), first, last,
+                       PIKA_FORWARD(Comp, comp), PIKA_FORWARD(Proj, proj),
+                       &workspace);
+        }
     } stable_sort{};
 }    // namespace pika
 
@@ -0,0 +1,418 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/stencil_transform.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace pika {
+    // clang-format off
+
+    /// Applies the stencil \a f to the neighborhood of each element of the
+    /// range [first, last) and stores the result in the corresponding
+    /// element of the destination range. The neighborhood of an element
+    /// consists of the \a radius elements preceding and the \a radius
+    /// elements following it. The first and last \a radius elements don't
+    /// have a complete neighborhood, they are copied to the destination
+    /// range unchanged (fixed boundary values).
+    ///
+    /// \note   Complexity: Exactly (last - first) - 2 * \a radius
+    ///         applications of \a f and 2 * \a radius assignments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the invocations of \a f.
+    /// \tparam RandIter    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam F           The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range,
+    ///                     which must not overlap with [first, last).
+    /// \param radius       The number of neighbors on each side of an element
+    ///                     the stencil accesses.
+    /// \param f            Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements having a
+    ///                     complete neighborhood. The signature of this
+    ///                     function should be equivalent to:
+    ///                     \code
+    ///                     Ret f(Neighborhood const& nb);
+    ///                     \endcode \n
+    ///                     nb[k] yields the element k positions away from
+    ///                     the current one, where -radius <= k <= radius.
+    ///                     The type \a Ret must be such that it can be
+    ///                     assigned to an object of the value type of
+    ///                     \a FwdIter.
+    ///
+    /// Every chunk of elements the algorithm is partitioned into reads the
+    /// \a radius elements adjacent to it on each side as a read-only halo
+    /// directly from the source range, no data is exchanged between the
+    /// chunks. Invoked with \a par_simd or \a simd, if both ranges are
+    /// contiguous sequences of arithmetic elements of the same size, nb[k]
+    /// yields vector packs of elements and \a f has to return a vector pack.
+    ///
+    /// The invocations of \a f in the parallel \a stencil_transform
+    /// algorithm invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the calling
+    /// thread.
+    ///
+    /// The invocations of \a f in the parallel \a stencil_transform
+    /// algorithm invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are permitted to
+    /// execute in an unordered fashion in unspecified threads, and
+    /// indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a stencil_transform algorithm returns a
+    ///           \a pika::future<FwdIter> if the execution policy is of
+    ///           type \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter otherwise.
+    ///           The \a stencil_transform algorithm returns the output
+    ///           iterator to the element in the destination range, one past
+    ///           the last element written.
+    ///
+    template <typename ExPolicy, typename RandIter, typename FwdIter,
+        typename F>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        FwdIter>::type
+    stencil_transform(ExPolicy&& policy, RandIter first, RandIter last,
+        FwdIter dest, std::size_t radius, F&& f);
+
+    /// Applies the stencil \a f \a steps times to the range [first, last)
+    /// and stores the result of the last step in the destination range, see
+    /// the overload above for the semantics of a single step. The source
+    /// range is not modified.
+    ///
+    /// The steps are time-blocked: the range is processed in blocks sized
+    /// to fit in cache, for each of which all steps are computed before
+    /// moving on to the next one. For this, each block starts from a copy
+    /// of its elements extended by a halo of \a steps * \a radius elements
+    /// on each side, the halo shrinks by \a radius elements per step. The
+    /// elements of the halos are computed by both adjacent blocks.
+    ///
+    /// \note   Complexity: At most \a steps * ((last - first) + 2 * \a steps
+    ///         * \a radius * B) applications of \a f, where B is the number
+    ///         of blocks.
+    ///
+    /// \param steps        The number of times the stencil is applied.
+    ///
+    /// The results of \a f are stored as intermediate values of the value
+    /// type of \a RandIter, which must be default constructible.
+    ///
+    /// \returns  The \a stencil_transform algorithm returns a
+    ///           \a pika::future<FwdIter> if the execution policy is of
+    ///           type \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter otherwise.
+    ///           The \a stencil_transform algorithm returns the output
+    ///           iterator to the element in the destination range, one past
+    ///           the last element written.
+    ///
+    template <typename ExPolicy, typename RandIter, typename FwdIter,
+        typename F>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        FwdIter>::type
+    stencil_transform(ExPolicy&& policy, RandIter first, RandIter last,
+        FwdIter dest, std::size_t radius, std::size_t steps, F&& f);
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/scratch_memory.hpp>
+#include <pika/parallel/util/transform_loop.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // stencil_transform
+    /// \cond NOINTERNAL
+
+    // The number of bytes of each of the two buffers a block of the
+    // time-blocked stencil is computed in.
+    inline constexpr std::size_t stencil_block_bytes = std::size_t(64) << 10;
+
+    // Computes one step of the elements [b, e) of a sequence of count
+    // elements from the elements at src, which refers to element b. Only the
+    // elements with a complete neighborhood are computed, the others are
+    // copied.
+    template <typename ExPolicy, typename Iter, typename OutIter, typename F>
+    OutIter stencil_step(Iter src, OutIter dest, std::size_t count,
+        std::size_t radius, std::size_t b, std::size_t e, F& f)
+    {
+        std::size_t const interior_first = (std::min)(radius, count);
+        std::size_t const interior_last =
+            (std::max)(interior_first, count - interior_first);
+
+        std::size_t const m1 = (std::clamp)(interior_first, b, e);
+        std::size_t const m2 = (std::clamp)(interior_last, b, e);
+
+        dest = std::copy_n(src, m1 - b, dest);
+        std::tie(src, dest) = stencil_transform_loop_n<ExPolicy>(
+            std::next(src, m1 - b), m2 - m1, dest, f);
+        return std::copy_n(src, e - m2, dest);
+    }
+
+    // Computes steps steps of the elements [b, e) of the sequence of count
+    // elements at first, one cache sized block at a time. The buffers have
+    // to provide room for two blocks extended by their halos.
+    template <typename ExPolicy, typename RandIter, typename FwdIter,
+        typename T, typename F>
+    FwdIter stencil_time_blocked(RandIter first, FwdIter dest,
+        std::size_t count, std::size_t radius, std::size_t steps,
+        std::size_t b, std::size_t e, std::size_t block_size, T* buffers,
+        F& f)
+    {
+        std::size_t const halo = steps * radius;
+        T* const buffer0 = buffers;
+        T* const buffer1 = buffers + block_size + 2 * halo;
+
+        for (/**/; b != e; b = (std::min)(b + block_size, e))
+        {
+            std::size_t const block_end = (std::min)(b + block_size, e);
+
+            // the elements [lo, hi) are valid after the copy, each step
+            // shrinks this range by the radius on each side which is not
+            // a boundary of the whole sequence
+            std::size_t const lo = b - (std::min)(b, halo);
+            std::size_t const hi = (std::min)(count, block_end + halo);
+
+            T* current = buffer0;
+            T* next = buffer1;
+            std::copy_n(std::next(first, lo), hi - lo, current);
+
+            std::size_t valid_first = lo;
+            std::size_t valid_last = hi;
+            for (std::size_t step = 0; step != steps; ++step)
+            {
+                if (lo != 0)
+                    valid_first += radius;
+                if (hi != count)
+                    valid_last -= radius;
+
+                stencil_step<ExPolicy>(current + (valid_first - lo),
+                    next + (valid_first - lo), count, radius, valid_first,
+                    valid_last, f);
+                std::swap(current, next);
+            }
+
+            dest = std::copy_n(current + (b - lo), block_end - b, dest);
+        }
+        return dest;
+    }
+
+    template <typename ExPolicy, typename RandIter, typename FwdIter,
+        typename F>
+    FwdIter stencil_transform_part(ExPolicy&& policy, RandIter first,
+        FwdIter dest, std::size_t count, std::size_t radius,
+        std::size_t steps, std::size_t b, std::size_t e, F& f)
+    {
+        using policy_type = std::decay_t<ExPolicy>;
+
+        if (steps == 0)
+        {
+            return std::copy_n(std::next(first, b), e - b, dest);
+        }
+
+        if (steps == 1)
+        {
+            return stencil_step<policy_type>(
+                std::next(first, b), dest, count, radius, b, e, f);
+        }
+
+        using value_type = typename std::iterator_traits<RandIter>::value_type;
+
+        std::size_t const halo = steps * radius;
+        std::size_t const block_size = (std::min)(e - b,
+            (std::max)(stencil_block_bytes / sizeof(value_type), 8 * halo));
+
+        std::shared_ptr<value_type[]> buffers = make_scratch_array<value_type>(
+            policy, 2 * (block_size + 2 * halo));
+
+        return stencil_time_blocked<policy_type>(first, dest, count, radius,
+            steps, b, e, block_size, buffers.get(), f);
+    }
+
+    template <typename FwdIter>
+    struct stencil_transform
+      : public algorithm<stencil_transform<FwdIter>, FwdIter>
+    {
+        stencil_transform()
+          : stencil_transform::algorithm("stencil_transform")
+        {
+        }
+
+        template <typename ExPolicy, typename RandIter, typename Sent,
+            typename F>
+        static FwdIter sequential(ExPolicy&& policy, RandIter first,
+            Sent last, FwdIter dest, std::size_t radius, std::size_t steps,
+            F&& f)
+        {
+            std::size_t const count = detail::distance(first, last);
+            return stencil_transform_part(
+                policy, first, dest, count, radius, steps, 0, count, f);
+        }
+
+        template <typename ExPolicy, typename RandIter, typename Sent,
+            typename F>
+        static typename algorithm_result<ExPolicy, FwdIter>::type parallel(
+            ExPolicy&& policy, RandIter first, Sent last, FwdIter dest,
+            std::size_t radius, std::size_t steps, F&& f)
+        {
+            if (first == last)
+            {
+                return algorithm_result<ExPolicy, FwdIter>::get(
+                    PIKA_MOVE(dest));
+            }
+
+            std::size_t const count = detail::distance(first, last);
+
+            // the chunks read their halos directly from the source range,
+            // which is never written
+            return foreach_partitioner<ExPolicy>::call(
+                PIKA_FORWARD(ExPolicy, policy), dest, count,
+                [policy, first, count, radius, steps, f = PIKA_FORWARD(F, f)](
+                    FwdIter part_begin, std::size_t part_size,
+                    std::size_t base_idx) mutable {
+                    stencil_transform_part(policy, first, part_begin, count,
+                        radius, steps, base_idx, base_idx + part_size, f);
+                },
+                projection_identity());
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::stencil_transform
+    inline constexpr struct stencil_transform_t final
+      : pika::detail::tag_parallel_algorithm<stencil_transform_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter, typename FwdIter,
+            typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<RandIter> &&
+                pika::traits::is_iterator_v<FwdIter>
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter>::type
+        tag_fallback_invoke(stencil_transform_t, ExPolicy&& policy,
+            RandIter first, RandIter last, FwdIter dest, std::size_t radius,
+            F&& f)
+        {
+            static_assert(pika::traits::is_random_access_iterator_v<RandIter>,
+                "Requires at least random access iterator.");
+            static_assert(pika::traits::is_forward_iterator_v<FwdIter>,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::stencil_transform<FwdIter>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, dest, radius,
+                std::size_t(1), PIKA_FORWARD(F, f));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandIter, typename FwdIter,
+            typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<RandIter> &&
+                pika::traits::is_iterator_v<FwdIter>
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            FwdIter>::type
+        tag_fallback_invoke(stencil_transform_t, ExPolicy&& policy,
+            RandIter first, RandIter last, FwdIter dest, std::size_t radius,
+            std::size_t steps, F&& f)
+        {
+            static_assert(pika::traits::is_random_access_iterator_v<RandIter>,
+                "Requires at least random access iterator.");
+            static_assert(pika::traits::is_forward_iterator_v<FwdIter>,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::stencil_transform<FwdIter>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, dest, radius,
+                steps, PIKA_FORWARD(F, f));
+        }
+
+        // clang-format off
+        template <typename RandIter, typename FwdIter, typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<RandIter> &&
+                pika::traits::is_iterator_v<FwdIter>
+            )>
+        // clang-format on
+        friend FwdIter tag_fallback_invoke(stencil_transform_t,
+            RandIter first, RandIter last, FwdIter dest, std::size_t radius,
+            F&& f)
+        {
+            static_assert(pika::traits::is_random_access_iterator_v<RandIter>,
+                "Requires at least random access iterator.");
+            static_assert(pika::traits::is_forward_iterator_v<FwdIter>,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::stencil_transform<FwdIter>().call(
+                pika::execution::seq, first, last, dest, radius,
+                std::size_t(1), PIKA_FORWARD(F, f));
+        }
+
+        // clang-format off
+        template <typename RandIter, typename FwdIter, typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<RandIter> &&
+                pika::traits::is_iterator_v<FwdIter>
+            )>
+        // clang-format on
+        friend FwdIter tag_fallback_invoke(stencil_transform_t,
+            RandIter first, RandIter last, FwdIter dest, std::size_t radius,
+            std::size_t steps, F&& f)
+        {
+            static_assert(pika::traits::is_random_access_iterator_v<RandIter>,
+                "Requires at least random access iterator.");
+            static_assert(pika::traits::is_forward_iterator_v<FwdIter>,
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::stencil_transform<FwdIter>().call(
+                pika::execution::seq, first, last, dest, radius, steps,
+                PIKA_FORWARD(F, f));
+        }
+    } stencil_transform{};
+}    // namespace pika
+
+#endif    // DOXYGEN
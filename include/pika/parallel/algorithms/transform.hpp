@@ -188,7 +188,9 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/foreach_partitioner.hpp>
+#include <pika/parallel/util/prefetching.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/streaming_stores.hpp>
 #include <pika/parallel/util/transform_loop.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
@@ -340,6 +342,38 @@ namespace pika::parallel::detail {
         }
     };
 
+    template <typename FwdIter1, typename FwdIter2, typename F, typename Proj>
+    inline constexpr bool supports_streaming_transform_v =
+        supports_streaming_stores_v<FwdIter2,
+            std::invoke_result_t<std::decay_t<F>&,
+                std::invoke_result_t<std::decay_t<Proj>&,
+                    typename std::iterator_traits<FwdIter1>::reference>>>;
+
+    // transform writing its output using streaming stores
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+        typename F, typename Proj>
+    typename algorithm_result<ExPolicy, in_out_result<FwdIter1, FwdIter2>>::type
+    streaming_transform(ExPolicy&& policy, FwdIter1 first, std::size_t count,
+        FwdIter2 dest, F&& f, Proj&& proj)
+    {
+        using zip_iterator = pika::util::zip_iterator<FwdIter1, FwdIter2>;
+
+        return get_in_out_result(foreach_partitioner<ExPolicy>::call(
+            PIKA_FORWARD(ExPolicy, policy),
+            pika::util::make_zip_iterator(first, dest), count,
+            [f = PIKA_FORWARD(F, f), proj = PIKA_FORWARD(Proj, proj)](
+                zip_iterator part_begin, std::size_t part_size,
+                std::size_t) mutable {
+                auto iters = part_begin.get_iterator_tuple();
+                FwdIter1 it = std::get<0>(iters);
+                streaming_store_n(std::get<1>(iters), part_size, [&]() {
+                    FwdIter1 curr = it++;
+                    return PIKA_INVOKE(f, PIKA_INVOKE(proj, *curr));
+                });
+            },
+            projection_identity()));
+    }
+
     ///////////////////////////////////////////////////////////////////////
     template <typename IterPair>
     struct transform : public algorithm<transform<IterPair>, IterPair>
@@ -356,8 +390,18 @@ namespace pika::parallel::detail {
         sequential(ExPolicy&& policy, InIterB first, InIterE last, OutIter dest,
             F&& f, Proj&& proj)
         {
-            return transform_loop(PIKA_FORWARD(ExPolicy, policy), first, last,
-                dest, transform_projected<F, Proj>(f, proj));
+            if constexpr (is_prefetching_iterator_v<InIterB>)
+            {
+                return prefetching_transform_loop(
+                    first, last, dest, [&](auto curr) {
+                        return PIKA_INVOKE(f, PIKA_INVOKE(proj, *curr));
+                    });
+            }
+            else
+            {
+                return transform_loop(PIKA_FORWARD(ExPolicy, policy), first,
+                    last, dest, transform_projected<F, Proj>(f, proj));
+            }
         }
 
         // sequential execution without projection
@@ -367,8 +411,16 @@ namespace pika::parallel::detail {
         sequential(ExPolicy&& policy, InIterB first, InIterE last, OutIter dest,
             F&& f, projection_identity)
         {
-            return transform_loop_ind(PIKA_FORWARD(ExPolicy, policy), first,
-                last, dest, PIKA_FORWARD(F, f));
+            if constexpr (is_prefetching_iterator_v<InIterB>)
+            {
+                return prefetching_transform_loop(first, last, dest,
+                    [&](auto curr) { return PIKA_INVOKE(f, *curr); });
+            }
+            else
+            {
+                return transform_loop_ind(PIKA_FORWARD(ExPolicy, policy), first,
+                    last, dest, PIKA_FORWARD(F, f));
+            }
         }
 
         template <typename ExPolicy, typename FwdIter1B, typename FwdIter1E,
@@ -378,8 +430,29 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, FwdIter1B first, FwdIter1E last,
             FwdIter2 dest, F&& f, Proj&& proj)
         {
-            if (first != last)
+            if constexpr (is_prefetching_iterator_v<FwdIter1B>)
             {
+                return prefetching_transform(PIKA_FORWARD(ExPolicy, policy),
+                    first, last, dest,
+                    [f = PIKA_FORWARD(F, f), proj = PIKA_FORWARD(Proj, proj)](
+                        auto curr) mutable {
+                        return PIKA_INVOKE(f, PIKA_INVOKE(proj, *curr));
+                    });
+            }
+            else if (first != last)
+            {
+                if constexpr (supports_streaming_transform_v<FwdIter1B,
+                                  FwdIter2, F, Proj>)
+                {
+                    std::size_t const count = detail::distance(first, last);
+                    if (use_streaming_stores<FwdIter2>(policy, count))
+                    {
+                        return streaming_transform(
+                            PIKA_FORWARD(ExPolicy, policy), first, count,
+                            dest, PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj));
+                    }
+                }
+
                 auto f1 = transform_iteration<ExPolicy, F, Proj>(
                     PIKA_FORWARD(F, f), PIKA_FORWARD(Proj, proj));
 
@@ -536,6 +609,47 @@ namespace pika::parallel::detail {
         }
     };
 
+    template <typename FwdIter1, typename FwdIter2, typename FwdIter3,
+        typename F, typename Proj1, typename Proj2>
+    inline constexpr bool supports_streaming_transform_binary_v =
+        supports_streaming_stores_v<FwdIter3,
+            std::invoke_result_t<std::decay_t<F>&,
+                std::invoke_result_t<std::decay_t<Proj1>&,
+                    typename std::iterator_traits<FwdIter1>::reference>,
+                std::invoke_result_t<std::decay_t<Proj2>&,
+                    typename std::iterator_traits<FwdIter2>::reference>>>;
+
+    // binary transform writing its output using streaming stores
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+        typename FwdIter3, typename F, typename Proj1, typename Proj2>
+    typename algorithm_result<ExPolicy,
+        in_in_out_result<FwdIter1, FwdIter2, FwdIter3>>::type
+    streaming_transform_binary(ExPolicy&& policy, FwdIter1 first1,
+        std::size_t count, FwdIter2 first2, FwdIter3 dest, F&& f,
+        Proj1&& proj1, Proj2&& proj2)
+    {
+        using zip_iterator =
+            pika::util::zip_iterator<FwdIter1, FwdIter2, FwdIter3>;
+
+        return get_in_in_out_result(foreach_partitioner<ExPolicy>::call(
+            PIKA_FORWARD(ExPolicy, policy),
+            pika::util::make_zip_iterator(first1, first2, dest), count,
+            [f = PIKA_FORWARD(F, f), proj1 = PIKA_FORWARD(Proj1, proj1),
+                proj2 = PIKA_FORWARD(Proj2, proj2)](zip_iterator part_begin,
+                std::size_t part_size, std::size_t) mutable {
+                auto iters = part_begin.get_iterator_tuple();
+                FwdIter1 it1 = std::get<0>(iters);
+                FwdIter2 it2 = std::get<1>(iters);
+                streaming_store_n(std::get<2>(iters), part_size, [&]() {
+                    FwdIter1 curr1 = it1++;
+                    FwdIter2 curr2 = it2++;
+                    return PIKA_INVOKE(f, PIKA_INVOKE(proj1, *curr1),
+                        PIKA_INVOKE(proj2, *curr2));
+                });
+            },
+            projection_identity()));
+    }
+
     ///////////////////////////////////////////////////////////////////////
     template <typename IterTuple>
     struct transform_binary
@@ -578,6 +692,20 @@ namespace pika::parallel::detail {
         {
             if (first1 != last1)
             {
+                if constexpr (supports_streaming_transform_binary_v<FwdIter1B,
+                                  FwdIter2, FwdIter3, F, Proj1, Proj2>)
+                {
+                    std::size_t const count = detail::distance(first1, last1);
+                    if (use_streaming_stores<FwdIter3>(policy, count))
+                    {
+                        return streaming_transform_binary(
+                            PIKA_FORWARD(ExPolicy, policy), first1, count,
+                            first2, dest, PIKA_FORWARD(F, f),
+                            PIKA_FORWARD(Proj1, proj1),
+                            PIKA_FORWARD(Proj2, proj2));
+                    }
+                }
+
                 auto f1 = transform_binary_iteration<ExPolicy, F, Proj1, Proj2>(
                     PIKA_FORWARD(F, f), PIKA_FORWARD(Proj1, proj1),
                     PIKA_FORWARD(Proj2, proj2));
@@ -644,6 +772,22 @@ namespace pika::parallel::detail {
         {
             if (first1 != last1 && first2 != last2)
             {
+                if constexpr (supports_streaming_transform_binary_v<FwdIter1B,
+                                  FwdIter2B, FwdIter3, F, Proj1, Proj2>)
+                {
+                    std::size_t const count =
+                        (std::min) (detail::distance(first1, last1),
+                            detail::distance(first2, last2));
+                    if (use_streaming_stores<FwdIter3>(policy, count))
+                    {
+                        return streaming_transform_binary(
+                            PIKA_FORWARD(ExPolicy, policy), first1, count,
+                            first2, dest, PIKA_FORWARD(F, f),
+                            PIKA_FORWARD(Proj1, proj1),
+                            PIKA_FORWARD(Proj2, proj2));
+                    }
+                }
+
                 auto f1 = transform_binary_iteration<ExPolicy, F, Proj1, Proj2>(
                     PIKA_FORWARD(F, f), PIKA_FORWARD(Proj1, proj1),
                     PIKA_FORWARD(Proj2, proj2));
@@ -0,0 +1,272 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/transform_n_out.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace pika {
+    // clang-format off
+
+    /// Applies the given function \a f to the range [first, last) and
+    /// stores the elements of the tuple it returns for each element in the
+    /// corresponding output ranges, the k-th element of the tuple returned
+    /// for first[i] is assigned to std::get<k>(dests)[i]. All outputs are
+    /// written in a single pass over the input, without the proxy
+    /// references of a \a zip_iterator.
+    ///
+    /// \note   Complexity: Exactly \a last - \a first applications of \a f
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the invocations of \a f.
+    /// \tparam FwdIter1    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The types of the iterators representing the
+    ///                     destination ranges (deduced).
+    ///                     These iterator types must meet the requirements of
+    ///                     an forward iterator.
+    /// \tparam F           The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dests        Refers to the beginnings of the destination
+    ///                     ranges.
+    /// \param f            Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements in the
+    ///                     sequence specified by [first, last). The signature
+    ///                     of this function should be equivalent to:
+    ///                     \code
+    ///                     std::tuple<Ret...> f(const Type &a);
+    ///                     \endcode \n
+    ///                     The type \a Type must be such that an object of
+    ///                     type \a FwdIter1 can be dereferenced and then
+    ///                     implicitly converted to Type. The k-th type of
+    ///                     \a Ret must be such that it can be assigned to
+    ///                     an object of the value type of the k-th type of
+    ///                     \a FwdIter2. Any type for which std::get is
+    ///                     defined (like std::pair or std::array) may be
+    ///                     returned instead of a std::tuple.
+    ///
+    /// Invoked with \a par_simd or \a simd, if the input and all outputs
+    /// are contiguous sequences of arithmetic elements of the same size
+    /// (splitting an interleaved sequence into columns, for instance), \a f
+    /// is invoked with vector packs of input elements and has to return a
+    /// tuple of vector packs of the element types of the outputs. Each
+    /// output is then written a vector pack at a time.
+    ///
+    /// The invocations of \a f in the parallel \a transform_n_out algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The invocations of \a f in the parallel \a transform_n_out algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a transform_n_out algorithm returns a
+    ///           \a pika::future<std::tuple<FwdIter2...>> if the execution
+    ///           policy is of type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns
+    ///           \a std::tuple<FwdIter2...> otherwise.
+    ///           The \a transform_n_out algorithm returns the output
+    ///           iterators to the elements in the destination ranges, one
+    ///           past the last elements written.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename... FwdIter2,
+        typename F>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        std::tuple<FwdIter2...>>::type
+    transform_n_out(ExPolicy&& policy, FwdIter1 first, FwdIter1 last,
+        std::tuple<FwdIter2...> dests, F&& f);
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/type_support/pack.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/transform_loop.hpp>
+#include <pika/parallel/util/zip_iterator.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // transform_n_out
+    /// \cond NOINTERNAL
+
+    // the output iterators of the iterator tuple of a zip_iterator over the
+    // input and the outputs
+    template <typename FwdIter1, typename... FwdIter2, std::size_t... Is>
+    std::tuple<FwdIter2...> get_transform_n_out_dests(
+        std::tuple<FwdIter1, FwdIter2...> const& iters,
+        pika::util::detail::index_pack<Is...>)
+    {
+        return std::tuple<FwdIter2...>(std::get<Is + 1>(iters)...);
+    }
+
+    template <typename FwdIter1, typename... FwdIter2>
+    std::tuple<FwdIter2...> get_transform_n_out_dests(
+        std::tuple<FwdIter1, FwdIter2...> const& iters)
+    {
+        return get_transform_n_out_dests(iters,
+            pika::util::detail::make_index_pack_t<sizeof...(FwdIter2)>());
+    }
+
+    template <typename... FwdIter2>
+    struct transform_n_out
+      : public algorithm<transform_n_out<FwdIter2...>, std::tuple<FwdIter2...>>
+    {
+        transform_n_out()
+          : transform_n_out::algorithm("transform_n_out")
+        {
+        }
+
+        template <typename ExPolicy, typename InIter, typename Sent,
+            typename F>
+        static std::tuple<FwdIter2...> sequential(ExPolicy&&, InIter first,
+            Sent last, std::tuple<FwdIter2...> dests, F&& f)
+        {
+            // an input iterator can't be measured before it is read
+            if constexpr (pika::traits::is_forward_iterator_v<InIter>)
+            {
+                return transform_n_out_loop_n<std::decay_t<ExPolicy>>(first,
+                    detail::distance(first, last), PIKA_MOVE(dests),
+                    PIKA_FORWARD(F, f))
+                    .second;
+            }
+            else
+            {
+                return transform_n_out_loop(
+                    first, last, PIKA_MOVE(dests), PIKA_FORWARD(F, f))
+                    .second;
+            }
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename Sent,
+            typename F>
+        static typename algorithm_result<ExPolicy,
+            std::tuple<FwdIter2...>>::type
+        parallel(ExPolicy&& policy, FwdIter1 first, Sent last,
+            std::tuple<FwdIter2...> dests, F&& f)
+        {
+            if (first == last)
+            {
+                return algorithm_result<ExPolicy,
+                    std::tuple<FwdIter2...>>::get(PIKA_MOVE(dests));
+            }
+
+            using policy_type = std::decay_t<ExPolicy>;
+            using zip_iterator =
+                pika::util::zip_iterator<FwdIter1, FwdIter2...>;
+
+            return convert_to_result(
+                foreach_partitioner<ExPolicy>::call(
+                    PIKA_FORWARD(ExPolicy, policy),
+                    std::apply(
+                        [&](FwdIter2... its) {
+                            return pika::util::make_zip_iterator(first, its...);
+                        },
+                        dests),
+                    detail::distance(first, last),
+                    [f = PIKA_FORWARD(F, f)](zip_iterator part_begin,
+                        std::size_t part_size, std::size_t) mutable {
+                        auto iters = part_begin.get_iterator_tuple();
+                        transform_n_out_loop_n<policy_type>(std::get<0>(iters),
+                            part_size, get_transform_n_out_dests(iters), f);
+                    },
+                    projection_identity()),
+                [](zip_iterator const& last) -> std::tuple<FwdIter2...> {
+                    return get_transform_n_out_dests(
+                        last.get_iterator_tuple());
+                });
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::transform_n_out
+    inline constexpr struct transform_n_out_t final
+      : pika::detail::tag_parallel_algorithm<transform_n_out_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter1, typename... FwdIter2,
+            typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<FwdIter1> &&
+                (pika::traits::is_iterator_v<FwdIter2> && ...)
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            std::tuple<FwdIter2...>>::type
+        tag_fallback_invoke(transform_n_out_t, ExPolicy&& policy,
+            FwdIter1 first, FwdIter1 last, std::tuple<FwdIter2...> dests,
+            F&& f)
+        {
+            static_assert(pika::traits::is_forward_iterator_v<FwdIter1>,
+                "Requires at least forward iterator.");
+            static_assert((pika::traits::is_forward_iterator_v<FwdIter2> &&
+                              ...),
+                "Requires at least forward iterator.");
+
+            return pika::parallel::detail::transform_n_out<FwdIter2...>().call(
+                PIKA_FORWARD(ExPolicy, policy), first, last, PIKA_MOVE(dests),
+                PIKA_FORWARD(F, f));
+        }
+
+        // clang-format off
+        template <typename FwdIter1, typename... FwdIter2, typename F,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<FwdIter1> &&
+                (pika::traits::is_iterator_v<FwdIter2> && ...)
+            )>
+        // clang-format on
+        friend std::tuple<FwdIter2...> tag_fallback_invoke(transform_n_out_t,
+            FwdIter1 first, FwdIter1 last, std::tuple<FwdIter2...> dests,
+            F&& f)
+        {
+            static_assert(pika::traits::is_input_iterator_v<FwdIter1>,
+                "Requires at least input iterator.");
+            static_assert((pika::traits::is_output_iterator_v<FwdIter2> &&
+                              ...),
+                "Requires at least output iterator.");
+
+            return pika::parallel::detail::transform_n_out<FwdIter2...>().call(
+                pika::execution::seq, first, last, PIKA_MOVE(dests),
+                PIKA_FORWARD(F, f));
+        }
+    } transform_n_out{};
+}    // namespace pika
+
+#endif    // DOXYGEN
@@ -268,6 +268,7 @@ namespace pika {
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner.hpp>
+#include <pika/parallel/util/prefetching.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
@@ -328,15 +329,9 @@ namespace pika::parallel::detail {
         PIKA_HOST_DEVICE PIKA_FORCEINLINE T operator()(
             Iter part_begin, std::size_t part_size)
         {
-            using reference = typename std::iterator_traits<Iter>::reference;
-
             T val = PIKA_INVOKE(convert_, *part_begin);
-            return accumulate_n(++part_begin, --part_size, PIKA_MOVE(val),
-                [PIKA_CXX20_CAPTURE_THIS(=)](
-                    T const& res, reference next) mutable -> T {
-                    return PIKA_INVOKE(
-                        reduce_, res, PIKA_INVOKE(convert_, next));
-                });
+            return transform_reduce_n<execution_policy_type>(++part_begin,
+                --part_size, PIKA_MOVE(val), reduce_, convert_);
         }
     };
 
@@ -353,12 +348,30 @@ namespace pika::parallel::detail {
         static T sequential(ExPolicy, Iter first, Sent last, T_&& init,
             Reduce&& r, Convert&& conv)
         {
-            using value_type = typename std::iterator_traits<Iter>::value_type;
-
-            return detail::accumulate(first, last, PIKA_FORWARD(T_, init),
-                [&r, &conv](T const& res, value_type const& next) -> T {
-                    return PIKA_INVOKE(r, res, PIKA_INVOKE(conv, next));
+            if constexpr (is_prefetching_iterator_v<Iter>)
+            {
+                T val = PIKA_FORWARD(T_, init);
+                prefetching_loop(first, last, [&](auto curr) {
+                    val = PIKA_INVOKE(r, val, PIKA_INVOKE(conv, *curr));
                 });
+                return val;
+            }
+            else if constexpr (pika::traits::is_random_access_iterator_v<Iter>)
+            {
+                return transform_reduce_n<ExPolicy>(first,
+                    static_cast<std::size_t>(detail::distance(first, last)),
+                    T(PIKA_FORWARD(T_, init)), r, conv);
+            }
+            else
+            {
+                using value_type =
+                    typename std::iterator_traits<Iter>::value_type;
+
+                return detail::accumulate(first, last, PIKA_FORWARD(T_, init),
+                    [&r, &conv](T const& res, value_type const& next) -> T {
+                        return PIKA_INVOKE(r, res, PIKA_INVOKE(conv, next));
+                    });
+            }
         }
 
         template <typename ExPolicy, typename Iter, typename Sent, typename T_,
@@ -373,18 +386,49 @@ namespace pika::parallel::detail {
                 return algorithm_result<ExPolicy, T>::get(PIKA_MOVE(init_));
             }
 
-            auto f1 = transform_reduce_iteration<T, ExPolicy, Reduce, Convert>(
-                PIKA_FORWARD(Reduce, r), PIKA_FORWARD(Convert, conv));
-
-            return detail::partitioner<ExPolicy, T>::call(
-                PIKA_FORWARD(ExPolicy, policy), first,
-                detail::distance(first, last), PIKA_MOVE(f1),
-                pika::unwrapping([init = PIKA_FORWARD(T_, init),
-                                     r = PIKA_FORWARD(Reduce, r)](
-                                     std::vector<T>&& results) mutable -> T {
+            auto f2 = pika::unwrapping(
+                [init = PIKA_FORWARD(T_, init), r](
+                    std::vector<T>&& results) mutable -> T {
                     return accumulate_n(pika::util::begin(results),
                         pika::util::size(results), init, r);
-                }));
+                });
+
+            if constexpr (is_prefetching_iterator_v<Iter>)
+            {
+                // every partition starts with the first element of a chunk
+                auto f1 = [r = PIKA_FORWARD(Reduce, r),
+                              conv = PIKA_FORWARD(Convert, conv)](
+                              Iter part_begin, std::size_t part_size) -> T {
+                    auto const base = part_begin.base();
+                    T val = PIKA_INVOKE(conv, *base);
+                    prefetching::prefetching_loop_n(
+                        part_begin, part_size,
+                        [&](auto curr) {
+                            if (curr != base)
+                            {
+                                val = PIKA_INVOKE(
+                                    r, val, PIKA_INVOKE(conv, *curr));
+                            }
+                        },
+                        []() constexpr { return false; });
+                    return val;
+                };
+
+                return detail::partitioner<ExPolicy, T>::call(
+                    PIKA_FORWARD(ExPolicy, policy), first, last - first,
+                    PIKA_MOVE(f1), PIKA_MOVE(f2));
+            }
+            else
+            {
+                auto f1 =
+                    transform_reduce_iteration<T, ExPolicy, Reduce, Convert>(
+                        PIKA_FORWARD(Reduce, r), PIKA_FORWARD(Convert, conv));
+
+                return detail::partitioner<ExPolicy, T>::call(
+                    PIKA_FORWARD(ExPolicy, policy), first,
+                    detail::distance(first, last), PIKA_MOVE(f1),
+                    PIKA_MOVE(f2));
+            }
         }
     };
 
@@ -0,0 +1,395 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/transpose.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace pika {
+    // clang-format off
+
+    /// Transposes the matrix of \a rows x \a cols elements stored in row
+    /// major order starting at \a src into the matrix of \a cols x \a rows
+    /// elements stored in row major order starting at \a dest, i.e.
+    /// dest[j * rows + i] = src[i * cols + j] for all i in [0, rows) and j in
+    /// [0, cols).
+    ///
+    /// \note   Complexity: Exactly \a rows * \a cols assignments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter1   The type of the source iterator used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam RandIter2   The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param src          Refers to the first element of the matrix to
+    ///                     transpose.
+    /// \param rows         The number of rows of the source matrix.
+    /// \param cols         The number of columns of the source matrix.
+    /// \param dest         Refers to the first element of the transposed
+    ///                     matrix, which must not overlap with the source
+    ///                     matrix.
+    ///
+    /// The matrix is transposed in a cache-oblivious manner: blocks are
+    /// recursively halved along their longer side until they are small
+    /// enough to be transposed directly. Invoked with \a par_simd or
+    /// \a simd, if both matrices are contiguous sequences of the same
+    /// arithmetic type, the built-in vector-pack backend transposes these
+    /// blocks in square tiles of vector packs by shuffling their lanes in
+    /// registers (std::experimental::simd does not provide shuffles, its
+    /// blocks are transposed element by element). The parallel versions
+    /// partition the rows of the destination matrix, when invoked with the
+    /// \a numa_affinity executor parameter each partition runs on the
+    /// domain owning the rows it writes.
+    ///
+    /// The assignments in the parallel \a transpose algorithm invoked with
+    /// an execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a transpose algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a transpose algorithm returns a
+    ///           \a pika::future<RandIter2> if the execution policy is of
+    ///           type \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandIter2 otherwise.
+    ///           The \a transpose algorithm returns the output iterator to
+    ///           the element in the destination range, one past the last
+    ///           element of the transposed matrix.
+    ///
+    template <typename ExPolicy, typename RandIter1, typename RandIter2>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        RandIter2>::type
+    transpose(ExPolicy&& policy, RandIter1 src, std::size_t rows,
+        std::size_t cols, RandIter2 dest);
+
+    /// Copies the tile of \a rows x \a cols elements starting at \a src,
+    /// whose consecutive rows start \a src_stride elements apart, to the
+    /// tile starting at \a dest, whose consecutive rows start
+    /// \a dest_stride elements apart, i.e. dest[i * dest_stride + j] =
+    /// src[i * src_stride + j] for all i in [0, rows) and j in [0, cols).
+    /// This copies a block of a larger matrix into a contiguous buffer (or
+    /// back), or between blocks of two matrices.
+    ///
+    /// \note   Complexity: Exactly \a rows * \a cols assignments.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter1   The type of the source iterator used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam RandIter2   The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param src          Refers to the first element of the source tile.
+    /// \param rows         The number of rows of the tile.
+    /// \param cols         The number of columns of the tile.
+    /// \param src_stride   The distance between the beginnings of two
+    ///                     consecutive rows of the source tile, at least
+    ///                     \a cols.
+    /// \param dest         Refers to the first element of the destination
+    ///                     tile, which must not overlap with the source tile.
+    /// \param dest_stride  The distance between the beginnings of two
+    ///                     consecutive rows of the destination tile, at least
+    ///                     \a cols.
+    ///
+    /// Each row is copied as a whole, using memmove for contiguous
+    /// sequences of trivially copyable elements. The parallel versions
+    /// partition the rows of the destination tile, when invoked with the
+    /// \a numa_affinity executor parameter each partition runs on the
+    /// domain owning the rows it writes.
+    ///
+    /// The assignments in the parallel \a tiled_copy algorithm invoked with
+    /// an execution policy object of type \a sequenced_policy execute in
+    /// sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a tiled_copy algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a tiled_copy algorithm returns a
+    ///           \a pika::future<RandIter2> if the execution policy is of
+    ///           type \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandIter2 otherwise.
+    ///           The \a tiled_copy algorithm returns the output iterator to
+    ///           the element in the destination range, one past the last
+    ///           element written (\a dest if \a rows is zero).
+    ///
+    template <typename ExPolicy, typename RandIter1, typename RandIter2>
+    typename pika::parallel::detail::algorithm_result<ExPolicy,
+        RandIter2>::type
+    tiled_copy(ExPolicy&& policy, RandIter1 src, std::size_t rows,
+        std::size_t cols, std::size_t src_stride, RandIter2 dest,
+        std::size_t dest_stride);
+
+    // clang-format on
+}    // namespace pika
+
+#else    // DOXYGEN
+
+#include <pika/config.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+
+#include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/dispatch.hpp>
+#include <pika/parallel/algorithms/detail/transpose.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/transfer.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // transpose
+    /// \cond NOINTERNAL
+    template <typename RandIter2>
+    struct transpose : public algorithm<transpose<RandIter2>, RandIter2>
+    {
+        transpose()
+          : transpose::algorithm("transpose")
+        {
+        }
+
+        template <typename ExPolicy, typename RandIter1>
+        static RandIter2 sequential(ExPolicy&&, RandIter1 src,
+            std::size_t rows, std::size_t cols, RandIter2 dest)
+        {
+            transpose_recursive<std::decay_t<ExPolicy>>(
+                src, cols, rows, cols, dest, rows);
+            return dest + rows * cols;
+        }
+
+        template <typename ExPolicy, typename RandIter1>
+        static typename algorithm_result<ExPolicy, RandIter2>::type parallel(
+            ExPolicy&& policy, RandIter1 src, std::size_t rows,
+            std::size_t cols, RandIter2 dest)
+        {
+            if (rows == 0 || cols == 0)
+            {
+                return algorithm_result<ExPolicy, RandIter2>::get(
+                    PIKA_MOVE(dest));
+            }
+
+            using policy_type = std::decay_t<ExPolicy>;
+            using index_iterator = pika::util::counting_iterator<std::size_t>;
+
+            // the rows of the destination are the columns of the source
+            return convert_to_result(
+                foreach_partitioner<ExPolicy>::call(
+                    PIKA_FORWARD(ExPolicy, policy), index_iterator(0), cols,
+                    [src, rows, cols, dest](index_iterator,
+                        std::size_t part_size, std::size_t base_idx) {
+                        transpose_recursive<policy_type>(src + base_idx, cols,
+                            rows, part_size, dest + base_idx * rows, rows);
+                    },
+                    projection_identity()),
+                [dest, count = rows * cols](index_iterator const&) {
+                    return dest + count;
+                });
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // tiled_copy
+
+    // copies the rows [first_row, last_row) of the tile
+    template <typename ExPolicy, typename RandIter1, typename RandIter2>
+    void tiled_copy_rows(RandIter1 src, std::size_t cols,
+        std::size_t src_stride, RandIter2 dest, std::size_t dest_stride,
+        std::size_t first_row, std::size_t last_row)
+    {
+        for (std::size_t i = first_row; i != last_row; ++i)
+        {
+            copy_n<ExPolicy>(
+                src + i * src_stride, cols, dest + i * dest_stride);
+        }
+    }
+
+    template <typename RandIter2>
+    struct tiled_copy : public algorithm<tiled_copy<RandIter2>, RandIter2>
+    {
+        tiled_copy()
+          : tiled_copy::algorithm("tiled_copy")
+        {
+        }
+
+        static RandIter2 get_last(RandIter2 dest, std::size_t rows,
+            std::size_t cols, std::size_t dest_stride)
+        {
+            return rows == 0 ? dest : dest + (rows - 1) * dest_stride + cols;
+        }
+
+        template <typename ExPolicy, typename RandIter1>
+        static RandIter2 sequential(ExPolicy&&, RandIter1 src,
+            std::size_t rows, std::size_t cols, std::size_t src_stride,
+            RandIter2 dest, std::size_t dest_stride)
+        {
+            tiled_copy_rows<std::decay_t<ExPolicy>>(
+                src, cols, src_stride, dest, dest_stride, 0, rows);
+            return get_last(dest, rows, cols, dest_stride);
+        }
+
+        template <typename ExPolicy, typename RandIter1>
+        static typename algorithm_result<ExPolicy, RandIter2>::type parallel(
+            ExPolicy&& policy, RandIter1 src, std::size_t rows,
+            std::size_t cols, std::size_t src_stride, RandIter2 dest,
+            std::size_t dest_stride)
+        {
+            if (rows == 0 || cols == 0)
+            {
+                return algorithm_result<ExPolicy, RandIter2>::get(
+                    get_last(dest, rows, cols, dest_stride));
+            }
+
+            using policy_type = std::decay_t<ExPolicy>;
+            using index_iterator = pika::util::counting_iterator<std::size_t>;
+
+            return convert_to_result(
+                foreach_partitioner<ExPolicy>::call(
+                    PIKA_FORWARD(ExPolicy, policy), index_iterator(0), rows,
+                    [src, cols, src_stride, dest, dest_stride](index_iterator,
+                        std::size_t part_size, std::size_t base_idx) {
+                        tiled_copy_rows<policy_type>(src, cols, src_stride,
+                            dest, dest_stride, base_idx, base_idx + part_size);
+                    },
+                    projection_identity()),
+                [=](index_iterator const&) {
+                    return get_last(dest, rows, cols, dest_stride);
+                });
+        }
+    };
+    /// \endcond
+}    // namespace pika::parallel::detail
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::transpose
+    inline constexpr struct transpose_t final
+      : pika::detail::tag_parallel_algorithm<transpose_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<RandIter1> &&
+                pika::traits::is_iterator_v<RandIter2>
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            RandIter2>::type
+        tag_fallback_invoke(transpose_t, ExPolicy&& policy, RandIter1 src,
+            std::size_t rows, std::size_t cols, RandIter2 dest)
+        {
+            static_assert(pika::traits::is_random_access_iterator_v<RandIter1>,
+                "Requires at least random access iterator.");
+            static_assert(pika::traits::is_random_access_iterator_v<RandIter2>,
+                "Requires at least random access iterator.");
+
+            return pika::parallel::detail::transpose<RandIter2>().call(
+                PIKA_FORWARD(ExPolicy, policy), src, rows, cols, dest);
+        }
+
+        // clang-format off
+        template <typename RandIter1, typename RandIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<RandIter1> &&
+                pika::traits::is_iterator_v<RandIter2>
+            )>
+        // clang-format on
+        friend RandIter2 tag_fallback_invoke(transpose_t, RandIter1 src,
+            std::size_t rows, std::size_t cols, RandIter2 dest)
+        {
+            static_assert(pika::traits::is_random_access_iterator_v<RandIter1>,
+                "Requires at least random access iterator.");
+            static_assert(pika::traits::is_random_access_iterator_v<RandIter2>,
+                "Requires at least random access iterator.");
+
+            return pika::parallel::detail::transpose<RandIter2>().call(
+                pika::execution::seq, src, rows, cols, dest);
+        }
+    } transpose{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for pika::tiled_copy
+    inline constexpr struct tiled_copy_t final
+      : pika::detail::tag_parallel_algorithm<tiled_copy_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::is_execution_policy_v<ExPolicy> &&
+                pika::traits::is_iterator_v<RandIter1> &&
+                pika::traits::is_iterator_v<RandIter2>
+            )>
+        // clang-format on
+        friend typename pika::parallel::detail::algorithm_result<ExPolicy,
+            RandIter2>::type
+        tag_fallback_invoke(tiled_copy_t, ExPolicy&& policy, RandIter1 src,
+            std::size_t rows, std::size_t cols, std::size_t src_stride,
+            RandIter2 dest, std::size_t dest_stride)
+        {
+            static_assert(pika::traits::is_random_access_iterator_v<RandIter1>,
+                "Requires at least random access iterator.");
+            static_assert(pika::traits::is_random_access_iterator_v<RandIter2>,
+                "Requires at least random access iterator.");
+
+            return pika::parallel::detail::tiled_copy<RandIter2>().call(
+                PIKA_FORWARD(ExPolicy, policy), src, rows, cols, src_stride,
+                dest, dest_stride);
+        }
+
+        // clang-format off
+        template <typename RandIter1, typename RandIter2,
+            PIKA_CONCEPT_REQUIRES_(
+                pika::traits::is_iterator_v<RandIter1> &&
+                pika::traits::is_iterator_v<RandIter2>
+            )>
+        // clang-format on
+        friend RandIter2 tag_fallback_invoke(tiled_copy_t, RandIter1 src,
+            std::size_t rows, std::size_t cols, std::size_t src_stride,
+            RandIter2 dest, std::size_t dest_stride)
+        {
+            static_assert(pika::traits::is_random_access_iterator_v<RandIter1>,
+                "Requires at least random access iterator.");
+            static_assert(pika::traits::is_random_access_iterator_v<RandIter2>,
+                "Requires at least random access iterator.");
+
+            return pika::parallel::detail::tiled_copy<RandIter2>().call(
+                pika::execution::seq, src, rows, cols, src_stride, dest,
+                dest_stride);
+        }
+    } tiled_copy{};
+}    // namespace pika
+
+#endif    // DOXYGEN
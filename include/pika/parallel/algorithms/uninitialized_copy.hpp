@@ -201,9 +201,11 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/is_negative.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner_with_cleanup.hpp>
 #include <pika/parallel/util/result_types.hpp>
+#include <pika/parallel/util/transfer.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
@@ -261,6 +263,33 @@ namespace pika::parallel::detail {
                 [](InIter2 dest) -> void { (*dest).~value_type(); })};
     }
 
+    // Copies count elements whose construction cannot throw, trivially
+    // copyable elements are copied with memmove.
+    template <typename InIter1, typename InIter2>
+    in_out_result<InIter1, InIter2> sequential_uninitialized_copy_n_nothrow(
+        InIter1 first, std::size_t count, InIter2 dest)
+    {
+        using category = pika::detail::pointer_copy_category_t<
+            std::decay_t<InIter1>, std::decay_t<InIter2>>;
+
+        if constexpr (std::is_same_v<category,
+                          pika::detail::trivially_copyable_pointer_tag>)
+        {
+            return copy_memmove(first, count, dest);
+        }
+        else
+        {
+            using value_type =
+                typename std::iterator_traits<InIter2>::value_type;
+
+            for (/* */; count != 0; (void) ++first, ++dest, --count)
+            {
+                ::new (std::addressof(*dest)) value_type(*first);
+            }
+            return in_out_result<InIter1, InIter2>{first, dest};
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////
     template <typename ExPolicy, typename Iter, typename FwdIter2>
     typename algorithm_result<ExPolicy, in_out_result<Iter, FwdIter2>>::type
@@ -277,6 +306,25 @@ namespace pika::parallel::detail {
         using partition_result_type = std::pair<FwdIter2, FwdIter2>;
         using value_type = typename std::iterator_traits<FwdIter2>::value_type;
 
+        // elements whose construction cannot throw need no cleanup
+        if constexpr (std::is_nothrow_constructible_v<value_type,
+                          typename std::iterator_traits<Iter>::reference>)
+        {
+            return get_in_out_result(foreach_partitioner<ExPolicy>::call(
+                PIKA_FORWARD(ExPolicy, policy),
+                pika::util::make_zip_iterator(first, dest), count,
+                [](zip_iterator part_begin, std::size_t part_size,
+                    std::size_t) {
+                    using std::get;
+                    auto iters = part_begin.get_iterator_tuple();
+                    sequential_uninitialized_copy_n_nothrow(
+                        get<0>(iters), part_size, get<1>(iters));
+                },
+                [](zip_iterator&& last) -> zip_iterator {
+                    return PIKA_MOVE(last);
+                }));
+        }
+
         util::cancellation_token<util::detail::no_data> tok;
 
         return partitioner_with_cleanup<ExPolicy, in_out_result<Iter, FwdIter2>,
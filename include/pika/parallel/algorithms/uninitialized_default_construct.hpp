@@ -171,11 +171,13 @@ namespace pika {
 #include <pika/type_support/void_guard.hpp>
 
 #include <pika/executors/execution_policy.hpp>
+#include <pika/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <pika/parallel/algorithms/detail/dispatch.hpp>
 #include <pika/parallel/algorithms/detail/distance.hpp>
 #include <pika/parallel/algorithms/detail/is_negative.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner_with_cleanup.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
@@ -200,6 +202,12 @@ namespace pika::parallel::detail {
     {
         using value_type = typename std::iterator_traits<Iter>::value_type;
 
+        // default-initializing trivial elements leaves them unchanged
+        if constexpr (std::is_trivially_default_constructible_v<value_type>)
+        {
+            return advance_to_sentinel(first, last);
+        }
+
         Iter s_first = first;
         try
         {
@@ -232,19 +240,52 @@ namespace pika::parallel::detail {
             [](InIter it) -> void { (*it).~value_type(); });
     }
 
+    // Default-initializes count elements whose construction cannot throw.
+    template <typename InIter>
+    InIter sequential_uninitialized_default_construct_n_nothrow(
+        InIter first, std::size_t count)
+    {
+        using value_type = typename std::iterator_traits<InIter>::value_type;
+
+        for (/* */; count != 0; (void) ++first, --count)
+        {
+            ::new (std::addressof(*first)) value_type;
+        }
+        return first;
+    }
+
     ///////////////////////////////////////////////////////////////////////
     template <typename ExPolicy, typename FwdIter>
     typename algorithm_result<ExPolicy, FwdIter>::type
     parallel_sequential_uninitialized_default_construct_n(
         ExPolicy&& policy, FwdIter first, std::size_t count)
     {
+        using partition_result_type = std::pair<FwdIter, FwdIter>;
+        using value_type = typename std::iterator_traits<FwdIter>::value_type;
+
+        // default-initializing trivial elements leaves them unchanged
+        if constexpr (std::is_trivially_default_constructible_v<value_type>)
+        {
+            std::advance(first, count);
+            return algorithm_result<ExPolicy, FwdIter>::get(PIKA_MOVE(first));
+        }
+
         if (count == 0)
         {
             return algorithm_result<ExPolicy, FwdIter>::get(PIKA_MOVE(first));
         }
 
-        using partition_result_type = std::pair<FwdIter, FwdIter>;
-        using value_type = typename std::iterator_traits<FwdIter>::value_type;
+        // elements whose construction cannot throw need no cleanup
+        if constexpr (std::is_nothrow_default_constructible_v<value_type>)
+        {
+            return foreach_partitioner<ExPolicy>::call(
+                PIKA_FORWARD(ExPolicy, policy), first, count,
+                [](FwdIter part_begin, std::size_t part_size, std::size_t) {
+                    sequential_uninitialized_default_construct_n_nothrow(
+                        part_begin, part_size);
+                },
+                [](FwdIter&& last) -> FwdIter { return PIKA_MOVE(last); });
+        }
 
         util::cancellation_token<util::detail::no_data> tok;
         return detail::partitioner_with_cleanup<ExPolicy, FwdIter,
@@ -318,6 +359,12 @@ namespace pika::parallel::detail {
     {
         using value_type = typename std::iterator_traits<InIter>::value_type;
 
+        // default-initializing trivial elements leaves them unchanged
+        if constexpr (std::is_trivially_default_constructible_v<value_type>)
+        {
+            return std::next(first, count);
+        }
+
         InIter s_first = first;
         try
         {
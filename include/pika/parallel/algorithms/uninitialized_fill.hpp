@@ -181,8 +181,10 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/is_negative.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner_with_cleanup.hpp>
+#include <pika/parallel/util/streaming_stores.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
@@ -237,6 +239,31 @@ namespace pika::parallel::detail {
             [](InIter it) -> void { (*it).~value_type(); });
     }
 
+    // Fills count elements whose construction cannot throw, elements which
+    // are trivially copied are assigned instead, which allows for
+    // vectorization.
+    template <typename InIter, typename T>
+    InIter sequential_uninitialized_fill_n_nothrow(
+        InIter first, std::size_t count, T const& value)
+    {
+        using value_type = typename std::iterator_traits<InIter>::value_type;
+
+        if constexpr (std::is_trivially_copy_constructible_v<value_type> &&
+            std::is_trivially_copy_assignable_v<value_type> &&
+            std::is_trivially_destructible_v<value_type>)
+        {
+            return std::fill_n(first, count, value_type(value));
+        }
+        else
+        {
+            for (/* */; count != 0; (void) ++first, --count)
+            {
+                ::new (std::addressof(*first)) value_type(value);
+            }
+            return first;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////
     template <typename ExPolicy, typename Iter, typename T>
     typename algorithm_result<ExPolicy, Iter>::type
@@ -246,9 +273,31 @@ namespace pika::parallel::detail {
         if (count == 0)
             return algorithm_result<ExPolicy, Iter>::get(PIKA_MOVE(first));
 
+        // trivially copyable elements need no cleanup if an error occurs
+        if constexpr (supports_streaming_stores_v<Iter, T const&>)
+        {
+            if (use_streaming_stores<Iter>(policy, count))
+            {
+                return streaming_generate_n(PIKA_FORWARD(ExPolicy, policy),
+                    first, count, [value]() { return value; });
+            }
+        }
+
         using partition_result_type = std::pair<Iter, Iter>;
         using value_type = typename std::iterator_traits<Iter>::value_type;
 
+        // elements whose construction cannot throw need no cleanup
+        if constexpr (std::is_nothrow_constructible_v<value_type, T const&>)
+        {
+            return foreach_partitioner<ExPolicy>::call(
+                PIKA_FORWARD(ExPolicy, policy), first, count,
+                [value](Iter part_begin, std::size_t part_size, std::size_t) {
+                    sequential_uninitialized_fill_n_nothrow(
+                        part_begin, part_size, value);
+                },
+                [](Iter&& last) -> Iter { return PIKA_MOVE(last); });
+        }
+
         util::cancellation_token<util::detail::no_data> tok;
         return partitioner_with_cleanup<ExPolicy, Iter, partition_result_type>::
             call(
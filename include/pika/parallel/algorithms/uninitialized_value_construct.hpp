@@ -178,12 +178,14 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/is_negative.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/partitioner_with_cleanup.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -233,6 +235,31 @@ namespace pika::parallel::detail {
             [](InIter it) -> void { (*it).~value_type(); });
     }
 
+    // Value-initializes count elements whose construction cannot throw,
+    // contiguous arithmetic and enumeration elements are zeroed with memset.
+    template <typename InIter>
+    InIter sequential_uninitialized_value_construct_n_nothrow(
+        InIter first, std::size_t count)
+    {
+        using value_type = typename std::iterator_traits<InIter>::value_type;
+
+        if constexpr (pika::traits::is_contiguous_iterator_v<InIter> &&
+            (std::is_arithmetic_v<value_type> || std::is_enum_v<value_type>))
+        {
+            std::memset(static_cast<void*>(std::addressof(*first)), 0,
+                count * sizeof(value_type));
+            return std::next(first, count);
+        }
+        else
+        {
+            for (/* */; count != 0; (void) ++first, --count)
+            {
+                ::new (std::addressof(*first)) value_type();
+            }
+            return first;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////
     template <typename ExPolicy, typename FwdIter>
     typename algorithm_result<ExPolicy, FwdIter>::type
@@ -247,6 +274,18 @@ namespace pika::parallel::detail {
         using partition_result_type = std::pair<FwdIter, FwdIter>;
         using value_type = typename std::iterator_traits<FwdIter>::value_type;
 
+        // elements whose construction cannot throw need no cleanup
+        if constexpr (std::is_nothrow_default_constructible_v<value_type>)
+        {
+            return foreach_partitioner<ExPolicy>::call(
+                PIKA_FORWARD(ExPolicy, policy), first, count,
+                [](FwdIter part_begin, std::size_t part_size, std::size_t) {
+                    sequential_uninitialized_value_construct_n_nothrow(
+                        part_begin, part_size);
+                },
+                [](FwdIter&& last) -> FwdIter { return PIKA_MOVE(last); });
+        }
+
         util::cancellation_token<util::detail::no_data> tok;
         return partitioner_with_cleanup<ExPolicy, FwdIter,
             partition_result_type>::
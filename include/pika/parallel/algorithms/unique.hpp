@@ -460,6 +460,9 @@ namespace pika {
 
 #include <pika/config.hpp>
 #include <pika/concepts/concepts.hpp>
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/functional/deferred_call.hpp>
 #include <pika/functional/invoke.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
 #include <pika/type_support/unused.hpp>
@@ -472,18 +475,22 @@ namespace pika {
 #include <pika/parallel/algorithms/detail/is_negative.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
 #include <pika/parallel/algorithms/detail/transfer.hpp>
+#include <pika/parallel/algorithms/rotate.hpp>
 #include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/detail/bulk_execute.hpp>
 #include <pika/parallel/util/detail/sender_util.hpp>
 #include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/loop.hpp>
 #include <pika/parallel/util/projection_identity.hpp>
 #include <pika/parallel/util/scan_partitioner.hpp>
+#include <pika/parallel/util/scratch_memory.hpp>
 #include <pika/parallel/util/transfer.hpp>
 #include <pika/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <exception>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -521,6 +528,105 @@ namespace pika::parallel::detail {
         return ++result;
     }
 
+    // Below this number of elements a chunk is not split any further
+    inline constexpr std::size_t unique_min_chunk_size = 4096;
+
+    // Moves the count elements starting at first to dest, which precedes
+    // first. The elements in [dest, first) are not needed anymore.
+    template <typename ExPolicy, typename RandIter>
+    void parallel_unique_close_gap(
+        ExPolicy& policy, RandIter dest, RandIter first, std::size_t count)
+    {
+        std::size_t const gap = first - dest;
+        if (gap == 0 || count == 0)
+        {
+            return;
+        }
+
+        if (gap < count)
+        {
+            // the ranges overlap, the elements are moved into place by
+            // rotating them with the ones in the gap
+            rotate_helper(policy, dest, first, first + count).get();
+            return;
+        }
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t const nparts = (std::max)(std::size_t(1),
+            (std::min)(cores, count / unique_min_chunk_size));
+
+        bulk_execute_n(policy, nparts, [&](std::size_t p) {
+            std::size_t const part_first = count * p / nparts;
+            std::size_t const part_last = count * (p + 1) / nparts;
+            std::move(
+                first + part_first, first + part_last, dest + part_first);
+        });
+    }
+
+    // Every chunk removes its duplicates locally, which leaves the unique
+    // elements of each chunk at its beginning. The gaps between them are
+    // then closed pairwise, doubling the number of adjacent chunks combined
+    // in every round, without needing any additional storage for the
+    // elements.
+    template <typename ExPolicy, typename RandIter, typename Pred,
+        typename Proj>
+    RandIter parallel_unique(ExPolicy&& policy, RandIter first,
+        std::size_t count, Pred&& pred, Proj&& proj)
+    {
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t const nchunks = (std::max)(std::size_t(1),
+            (std::min)(cores, count / unique_min_chunk_size));
+
+        auto chunk_first = [&](std::size_t c) {
+            return first + count * c / nchunks;
+        };
+
+        // number of leading elements of each chunk which are duplicates of
+        // the last element of the preceding chunk
+        std::vector<std::size_t> skipped(nchunks, 0);
+        bulk_execute_n(policy, nchunks - 1, [&](std::size_t c) {
+            RandIter const prev = chunk_first(c + 1) - 1;
+            RandIter const last = chunk_first(c + 2);
+
+            RandIter it = prev + 1;
+            while (it != last &&
+                PIKA_INVOKE(
+                    pred, PIKA_INVOKE(proj, *prev), PIKA_INVOKE(proj, *it)))
+            {
+                ++it;
+            }
+            skipped[c + 1] = it - (prev + 1);
+        });
+
+        // the unique elements of chunk c are [starts[c], starts[c] + kept[c])
+        std::vector<RandIter> starts(nchunks);
+        std::vector<std::size_t> kept(nchunks);
+        bulk_execute_n(policy, nchunks, [&](std::size_t c) {
+            RandIter const chunk_last = chunk_first(c + 1);
+            starts[c] = chunk_first(c) + skipped[c];
+            kept[c] =
+                sequential_unique(starts[c], chunk_last, pred, proj) -
+                starts[c];
+        });
+
+        for (std::size_t step = 1; step < nchunks; step *= 2)
+        {
+            bulk_execute_n(policy, (nchunks - step + 2 * step - 1) / (2 * step),
+                [&, step](std::size_t p) {
+                    std::size_t const lhs = p * 2 * step;
+                    std::size_t const rhs = lhs + step;
+
+                    parallel_unique_close_gap(policy, starts[lhs] + kept[lhs],
+                        starts[rhs], kept[rhs]);
+                    kept[lhs] += kept[rhs];
+                });
+        }
+
+        return starts[0] + kept[0];
+    }
+
     template <typename Iter>
     struct unique : public algorithm<unique<Iter>, Iter>
     {
@@ -544,136 +650,160 @@ namespace pika::parallel::detail {
         parallel(ExPolicy&& policy, FwdIter first, Sent last, Pred&& pred,
             Proj&& proj)
         {
-            using zip_iterator = pika::util::zip_iterator<FwdIter, bool*>;
             using algorithm_result = algorithm_result<ExPolicy, FwdIter>;
-            using difference_type =
-                typename std::iterator_traits<FwdIter>::difference_type;
-
-            difference_type count = detail::distance(first, last);
 
-            if (count < 2)
+            if constexpr (pika::traits::is_random_access_iterator_v<FwdIter>)
             {
-                std::advance(first, count);
-                return algorithm_result::get(PIKA_MOVE(first));
-            }
-
-            std::shared_ptr<bool[]> flags(new bool[count]);
-            std::size_t init = 0u;
-
-            flags[0] = false;
+                std::size_t const count = detail::distance(first, last);
+                if (count < 2)
+                {
+                    return algorithm_result::get(first + count);
+                }
 
-            using pika::util::make_zip_iterator;
-            using std::get;
-            using scan_partitioner_type = scan_partitioner<ExPolicy, FwdIter,
-                std::size_t, void, scan_partitioner_sequential_f3_tag>;
+                return algorithm_result::get(
+                    execution::async_execute(policy.executor(),
+                        pika::util::detail::deferred_call(
+                            &parallel_unique<ExPolicy&&, FwdIter, Pred&&,
+                                Proj&&>,
+                            policy, first, count, PIKA_FORWARD(Pred, pred),
+                            PIKA_FORWARD(Proj, proj))));
+            }
+            else
+            {
+                using zip_iterator = pika::util::zip_iterator<FwdIter, bool*>;
+                using difference_type =
+                    typename std::iterator_traits<FwdIter>::difference_type;
 
-            auto f1 = [pred = PIKA_FORWARD(Pred, pred),
-                          proj = PIKA_FORWARD(Proj, proj)](
-                          zip_iterator part_begin,
-                          std::size_t part_size) -> std::size_t {
-                FwdIter base = get<0>(part_begin.get_iterator_tuple());
+                difference_type count = detail::distance(first, last);
 
-                // Note: replacing the invoke() with PIKA_INVOKE()
-                // below makes gcc generate errors
+                if (count < 2)
+                {
+                    std::advance(first, count);
+                    return algorithm_result::get(PIKA_MOVE(first));
+                }
 
-                // MSVC complains if pred or proj is captured by ref below
-                loop_n<std::decay_t<ExPolicy>>(++part_begin, part_size,
-                    [base, pred, proj](zip_iterator it) mutable -> void {
-                        bool f = pika::util::detail::invoke(pred,
-                            pika::util::detail::invoke(proj, *base),
-                            pika::util::detail::invoke(proj, get<0>(*it)));
+                std::shared_ptr<bool[]> flags =
+                    make_scratch_array<bool>(policy, count);
+                std::size_t init = 0u;
 
-                        if (!(get<1>(*it) = f))
-                            base = get<0>(it.get_iterator_tuple());
-                    });
+                flags[0] = false;
 
-                // There is no need to return the partition result.
-                // But, the scan_partitioner doesn't support 'void' as
-                // Result1. So, unavoidably return non-meaning value.
-                return 0u;
-            };
+                using pika::util::make_zip_iterator;
+                using std::get;
+                using scan_partitioner_type =
+                    scan_partitioner<ExPolicy, FwdIter, std::size_t, void,
+                        scan_partitioner_sequential_f3_tag>;
 
-            std::shared_ptr<FwdIter> dest_ptr =
-                std::make_shared<FwdIter>(first);
-            auto f3 =
-                [dest_ptr, flags](zip_iterator part_begin,
-                    std::size_t part_size,
-                    pika::shared_future<std::size_t> curr,
-                    pika::shared_future<std::size_t> next) mutable -> void {
-                PIKA_UNUSED(flags);
+                auto f1 = [pred = PIKA_FORWARD(Pred, pred),
+                              proj = PIKA_FORWARD(Proj, proj)](
+                              zip_iterator part_begin,
+                              std::size_t part_size) -> std::size_t {
+                    FwdIter base = get<0>(part_begin.get_iterator_tuple());
 
-                curr.get();    // rethrow exceptions
-                next.get();    // rethrow exceptions
+                    // Note: replacing the invoke() with PIKA_INVOKE()
+                    // below makes gcc generate errors
 
-                FwdIter& dest = *dest_ptr;
+                    // MSVC complains if pred or proj is captured by ref below
+                    loop_n<std::decay_t<ExPolicy>>(++part_begin, part_size,
+                        [base, pred, proj](zip_iterator it) mutable -> void {
+                            bool f = pika::util::detail::invoke(pred,
+                                pika::util::detail::invoke(proj, *base),
+                                pika::util::detail::invoke(proj, get<0>(*it)));
 
-                using execution_policy_type = std::decay_t<ExPolicy>;
-                if (dest == get<0>(part_begin.get_iterator_tuple()))
-                {
-                    // Self-assignment must be detected.
-                    loop_n<execution_policy_type>(
-                        part_begin, part_size, [&dest](zip_iterator it) {
-                            if (!get<1>(*it))
-                            {
-                                if (dest != get<0>(it.get_iterator_tuple()))
-                                    *dest++ = PIKA_MOVE(get<0>(*it));
-                                else
-                                    ++dest;
-                            }
+                            if (!(get<1>(*it) = f))
+                                base = get<0>(it.get_iterator_tuple());
                         });
-                }
-                else
-                {
-                    // Self-assignment can't be performed.
-                    loop_n<execution_policy_type>(
-                        part_begin, part_size, [&dest](zip_iterator it) {
-                            if (!get<1>(*it))
-                                *dest++ = PIKA_MOVE(get<0>(*it));
-                        });
-                }
-            };
 
-            auto f4 =
-                [dest_ptr = PIKA_MOVE(dest_ptr), first, count, flags](
-                    std::vector<pika::shared_future<std::size_t>>&& items,
-                    std::vector<pika::future<void>>&& data) mutable -> FwdIter {
-                // make sure iterators embedded in function object that is
-                // attached to futures are invalidated
-                items.clear();
-                data.clear();
-
-                if (!flags[count - 1])
-                {
-                    std::advance(first, count - 1);
-                    if (first != (*dest_ptr))
-                        *(*dest_ptr)++ = PIKA_MOVE(*first);
-                    else
-                        ++(*dest_ptr);
-                }
-                return *dest_ptr;
-            };
-
-            return scan_partitioner_type::call(
-                PIKA_FORWARD(ExPolicy, policy),
-                make_zip_iterator(first, flags.get()), count - 1, init,
-                // step 1 performs first part of scan algorithm
-                PIKA_MOVE(f1),
-                // step 2 propagates the partition results from left
-                // to right
-                [](pika::shared_future<std::size_t> fut1,
-                    pika::shared_future<std::size_t> fut2) -> std::size_t {
-                    fut1.get();
-                    fut2.get();    // propagate exceptions
-                    // There is no need to propagate the partition
-                    // results. But, the scan_partitioner doesn't
-                    // support 'void' as Result1. So, unavoidably
-                    // return non-meaning value.
+                    // There is no need to return the partition result.
+                    // But, the scan_partitioner doesn't support 'void' as
+                    // Result1. So, unavoidably return non-meaning value.
                     return 0u;
-                },
-                // step 3 runs final accumulation on each partition
-                PIKA_MOVE(f3),
-                // step 4 use this return value
-                PIKA_MOVE(f4));
+                };
+
+                std::shared_ptr<FwdIter> dest_ptr =
+                    std::make_shared<FwdIter>(first);
+                auto f3 =
+                    [dest_ptr, flags](zip_iterator part_begin,
+                        std::size_t part_size,
+                        pika::shared_future<std::size_t> curr,
+                        pika::shared_future<std::size_t> next) mutable -> void {
+                    PIKA_UNUSED(flags);
+
+                    curr.get();    // rethrow exceptions
+                    next.get();    // rethrow exceptions
+
+                    FwdIter& dest = *dest_ptr;
+
+                    using execution_policy_type = std::decay_t<ExPolicy>;
+                    if (dest == get<0>(part_begin.get_iterator_tuple()))
+                    {
+                        // Self-assignment must be detected.
+                        loop_n<execution_policy_type>(
+                            part_begin, part_size, [&dest](zip_iterator it) {
+                                if (!get<1>(*it))
+                                {
+                                    if (dest != get<0>(it.get_iterator_tuple()))
+                                        *dest++ = PIKA_MOVE(get<0>(*it));
+                                    else
+                                        ++dest;
+                                }
+                            });
+                    }
+                    else
+                    {
+                        // Self-assignment can't be performed.
+                        loop_n<execution_policy_type>(
+                            part_begin, part_size, [&dest](zip_iterator it) {
+                                if (!get<1>(*it))
+                                    *dest++ = PIKA_MOVE(get<0>(*it));
+                            });
+                    }
+                };
+
+                auto f4 = [dest_ptr = PIKA_MOVE(dest_ptr), first, count,
+                              flags](
+                              std::vector<pika::shared_future<std::size_t>>&&
+                                  items,
+                              std::vector<pika::future<void>>&& data) mutable
+                    -> FwdIter {
+                    // make sure iterators embedded in function object that is
+                    // attached to futures are invalidated
+                    items.clear();
+                    data.clear();
+
+                    if (!flags[count - 1])
+                    {
+                        std::advance(first, count - 1);
+                        if (first != (*dest_ptr))
+                            *(*dest_ptr)++ = PIKA_MOVE(*first);
+                        else
+                            ++(*dest_ptr);
+                    }
+                    return *dest_ptr;
+                };
+
+                return scan_partitioner_type::call(
+                    PIKA_FORWARD(ExPolicy, policy),
+                    make_zip_iterator(first, flags.get()), count - 1, init,
+                    // step 1 performs first part of scan algorithm
+                    PIKA_MOVE(f1),
+                    // step 2 propagates the partition results from left
+                    // to right
+                    [](pika::shared_future<std::size_t> fut1,
+                        pika::shared_future<std::size_t> fut2) -> std::size_t {
+                        fut1.get();
+                        fut2.get();    // propagate exceptions
+                        // There is no need to propagate the partition
+                        // results. But, the scan_partitioner doesn't
+                        // support 'void' as Result1. So, unavoidably
+                        // return non-meaning value.
+                        return 0u;
+                    },
+                    // step 3 runs final accumulation on each partition
+                    PIKA_MOVE(f3),
+                    // step 4 use this return value
+                    PIKA_MOVE(f4));
+            }
         }
     };
     /// \endcond
@@ -793,7 +923,8 @@ namespace pika::parallel::detail {
                         PIKA_MOVE(++first), PIKA_MOVE(dest)});
             }
 
-            std::shared_ptr<bool[]> flags(new bool[count - 1]);
+            std::shared_ptr<bool[]> flags =
+                make_scratch_array<bool>(policy, count - 1);
             std::size_t init = 0;
 
             using pika::util::make_zip_iterator;
@@ -15,11 +15,17 @@
 #include <pika/parallel/datapar/adjacent_difference.hpp>
 #include <pika/parallel/datapar/fill.hpp>
 #include <pika/parallel/datapar/find.hpp>
+#include <pika/parallel/datapar/gather.hpp>
 #include <pika/parallel/datapar/generate.hpp>
 #include <pika/parallel/datapar/iterator_helpers.hpp>
 #include <pika/parallel/datapar/loop.hpp>
+#include <pika/parallel/datapar/mismatch.hpp>
+#include <pika/parallel/datapar/replace.hpp>
+#include <pika/parallel/datapar/scan.hpp>
+#include <pika/parallel/datapar/soa_iterator.hpp>
 #include <pika/parallel/datapar/transfer.hpp>
 #include <pika/parallel/datapar/transform_loop.hpp>
+#include <pika/parallel/datapar/transpose.hpp>
 #include <pika/parallel/datapar/zip_iterator.hpp>
 
 #endif
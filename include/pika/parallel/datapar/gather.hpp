@@ -0,0 +1,100 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR)
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/detail/gather.hpp>
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename MapIter, typename RandIter, typename OutIter,
+        typename Enable = void>
+    struct is_datapar_gather_compatible : std::false_type
+    {
+    };
+
+    template <typename MapIter, typename RandIter, typename OutIter>
+    struct is_datapar_gather_compatible<MapIter, RandIter, OutIter,
+        std::enable_if_t<iterator_datapar_compatible<MapIter>::value &&
+            iterator_datapar_compatible<RandIter>::value &&
+            iterator_datapar_compatible<OutIter>::value>>
+    {
+        static constexpr bool value =
+            std::is_integral_v<
+                typename std::iterator_traits<MapIter>::value_type> &&
+            std::is_same_v<typename std::iterator_traits<RandIter>::value_type,
+                typename std::iterator_traits<OutIter>::value_type>;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Neither vector pack backend exposes a gather, the lanes of a pack are
+    // filled from scalar loads (prefetching the source elements of the
+    // following lanes) and the pack is written with a single store. This
+    // only replaces the scalar stores to the destination by vector stores.
+    struct datapar_gather
+    {
+        template <typename MapIter, typename RandIter, typename OutIter>
+        static OutIter call(
+            MapIter map, std::size_t count, RandIter src, OutIter dest)
+        {
+            using value_type =
+                typename std::iterator_traits<OutIter>::value_type;
+            using V =
+                typename traits::detail::vector_pack_type<value_type>::type;
+
+            constexpr std::size_t size =
+                traits::detail::vector_pack_size<V>::value;
+            constexpr std::size_t distance = indirect_prefetch_distance;
+
+            for (/* */; count >= size; count -= size)
+            {
+                V v;
+                for (std::size_t i = 0; i != size; ++i)
+                {
+                    if (i + distance < count)
+                    {
+                        prefetch_indirect(src, map[i + distance]);
+                    }
+                    v[i] = src[map[i]];
+                }
+                traits::detail::vector_pack_store<V, value_type>::unaligned(
+                    v, dest);
+
+                std::advance(map, size);
+                std::advance(dest, size);
+            }
+
+            return gather_loop_n(map, count, src, dest);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename MapIter, typename RandIter,
+        typename OutIter,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_gather_compatible<MapIter, RandIter,
+                    OutIter>::value)>
+    inline OutIter tag_invoke(sequential_gather_t<ExPolicy>, MapIter map,
+        std::size_t count, RandIter src, OutIter dest)
+    {
+        return datapar_gather::call(map, count, src, dest);
+    }
+}    // namespace pika::parallel::detail
+#endif
@@ -19,7 +19,6 @@
 #include <pika/parallel/util/vector_pack_type.hpp>
 
 #include <cstddef>
-#include <cstdint>
 #include <type_traits>
 #include <utility>
 
@@ -48,8 +47,7 @@ namespace pika::parallel::detail {
                 *first++ = f.template operator()<value_type>();
             }
 
-            for (std::int64_t len_v = std::int64_t(len - (size + 1)); len_v > 0;
-                 len_v -= size, len -= size)
+            for (/* */; len >= size; len -= size)
             {
                 auto tmp = f.template operator()<V>();
                 traits::detail::vector_pack_store<V, value_type>::aligned(
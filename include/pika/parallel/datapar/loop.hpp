@@ -22,7 +22,6 @@
 
 #include <algorithm>
 #include <cstddef>
-#include <cstdint>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -129,8 +128,7 @@ namespace pika::parallel::detail {
             static std::size_t constexpr size =
                 traits::detail::vector_pack_size<V>::value;
 
-            End const lastV = last - (size + 1);
-            while (first < lastV)
+            while (last - first >= std::ptrdiff_t(size))
             {
                 datapar_loop_step<Begin>::callv(f, first);
             }
@@ -174,8 +172,7 @@ namespace pika::parallel::detail {
             static std::size_t constexpr size =
                 traits::detail::vector_pack_size<V>::value;
 
-            End const lastV = last - (size + 1);
-            while (first < lastV)
+            while (last - first >= std::ptrdiff_t(size))
             {
                 std::size_t incr =
                     datapar_loop_step_tok<Begin>::callv(f, first);
@@ -237,8 +234,7 @@ namespace pika::parallel::detail {
             static std::size_t constexpr size =
                 traits::detail::vector_pack_size<V>::value;
 
-            End const lastV = last - (size + 1);
-            while (first < lastV)
+            while (last - first >= std::ptrdiff_t(size))
             {
                 datapar_loop_step_ind<Begin>::callv(f, first);
             }
@@ -297,8 +293,7 @@ namespace pika::parallel::detail {
             static std::size_t constexpr size =
                 traits::detail::vector_pack_size<V>::value;
 
-            InIter1 const last1V = last1 - (size + 1);
-            while (it1 < last1V)
+            while (last1 - it1 >= std::ptrdiff_t(size))
             {
                 datapar_loop_step2<InIter1, InIter2>::callv(f, it1, it2);
             }
@@ -359,8 +354,7 @@ namespace pika::parallel::detail {
             static std::size_t constexpr size =
                 traits::detail::vector_pack_size<V>::value;
 
-            for (std::int64_t len_v = std::int64_t(len - (size + 1)); len_v > 0;
-                 len_v -= size, len -= size)
+            for (/* */; len >= size; len -= size)
             {
                 datapar_loop_step<InIter>::callv(f, first);
             }
@@ -405,8 +399,7 @@ namespace pika::parallel::detail {
             static std::size_t constexpr size =
                 traits::detail::vector_pack_size<V>::value;
 
-            for (std::int64_t len_v = std::int64_t(len - (size + 1)); len_v > 0;
-                 len_v -= size, len -= size)
+            for (/* */; len >= size; len -= size)
             {
                 std::size_t incr =
                     datapar_loop_step_tok<InIter>::callv(f, first);
@@ -469,8 +462,7 @@ namespace pika::parallel::detail {
             static std::size_t constexpr size =
                 traits::detail::vector_pack_size<V>::value;
 
-            for (std::int64_t len_v = std::int64_t(len - (size + 1)); len_v > 0;
-                 len_v -= size, len -= size)
+            for (/* */; len >= size; len -= size)
             {
                 datapar_loop_step_ind<InIter>::callv(f, first);
             }
@@ -523,13 +515,11 @@ namespace pika::parallel::detail {
             static std::size_t constexpr size =
                 traits::detail::vector_pack_size<V>::value;
 
-            for (std::int64_t len_v = std::int64_t(len - (size + 1)); len_v > 0;
-                 len_v -= size, len -= size)
+            for (/* */; len >= size; len -= size)
             {
-                std::size_t incr =
-                    datapar_loop_idx_step<Iter>::callv(f, it, base_idx);
-                std::advance(it, incr);
-                base_idx += incr;
+                datapar_loop_idx_step<Iter>::callv(f, it, base_idx);
+                std::advance(it, size);
+                base_idx += size;
             }
 
             for (/* */; len != 0; --len)
@@ -559,8 +549,7 @@ namespace pika::parallel::detail {
             static std::size_t constexpr size =
                 traits::detail::vector_pack_size<V>::value;
 
-            for (std::int64_t len_v = std::int64_t(len - (size + 1)); len_v > 0;
-                 len_v -= size, len -= size)
+            for (/* */; len >= size; len -= size)
             {
                 datapar_loop_idx_step<Iter>::callv(f, it, base_idx);
                 if (tok.was_cancelled(base_idx))
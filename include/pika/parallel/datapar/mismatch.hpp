@@ -0,0 +1,282 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR)
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/detail/mismatch.hpp>
+#include <pika/parallel/algorithms/detail/predicates.hpp>
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/vector_pack_all_any_none.hpp>
+#include <pika/parallel/util/vector_pack_find.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The vectorized comparison kernels are used only if both ranges hold
+    // the same arithmetic type and no projections are involved.
+    template <typename Iter1, typename Iter2, typename Proj1, typename Proj2,
+        typename Enable = void>
+    struct is_datapar_compare_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter1, typename Iter2, typename Proj1, typename Proj2>
+    struct is_datapar_compare_compatible<Iter1, Iter2, Proj1, Proj2,
+        std::enable_if_t<iterator_datapar_compatible<Iter1>::value &&
+            iterator_datapar_compatible<Iter2>::value>>
+    {
+        using value_type = typename std::iterator_traits<Iter1>::value_type;
+
+        static constexpr bool value = std::is_same_v<value_type,
+                                          typename std::iterator_traits<
+                                              Iter2>::value_type> &&
+            !std::is_same_v<value_type, bool> &&
+            std::is_same_v<std::decay_t<Proj1>, projection_identity> &&
+            std::is_same_v<std::decay_t<Proj2>, projection_identity>;
+    };
+
+    template <typename Iter, typename Pred>
+    struct is_datapar_equal_to
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using pred_type = std::decay_t<Pred>;
+
+        static constexpr bool value = std::is_same_v<pred_type, equal_to> ||
+            std::is_same_v<pred_type, std::equal_to<>> ||
+            std::is_same_v<pred_type, std::equal_to<value_type>>;
+    };
+
+    template <typename Iter, typename Pred>
+    struct is_datapar_less
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using pred_type = std::decay_t<Pred>;
+
+        static constexpr bool value = std::is_same_v<pred_type, less> ||
+            std::is_same_v<pred_type, std::less<>> ||
+            std::is_same_v<pred_type, std::less<value_type>>;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Predicates identifying differing elements, these are applied to
+    // vector-packs (yielding masks) as well as to scalars (yielding bool).
+    struct datapar_not_equal
+    {
+        template <typename T>
+        PIKA_FORCEINLINE auto operator()(T const& lhs, T const& rhs) const
+        {
+            return !(lhs == rhs);
+        }
+    };
+
+    struct datapar_not_equivalent
+    {
+        template <typename T>
+        PIKA_FORCEINLINE auto operator()(T const& lhs, T const& rhs) const
+        {
+            return (lhs < rhs) || (rhs < lhs);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct datapar_equal_n
+    {
+        template <typename Iter1, typename Iter2, typename Token>
+        static void
+        call(Iter1 first1, Iter2 first2, std::size_t count, Token& tok)
+        {
+            using value_type = typename std::iterator_traits<Iter1>::value_type;
+
+            if (count == 0)
+            {
+                return;
+            }
+
+            if constexpr (std::is_integral_v<value_type>)
+            {
+                // integral values compare equal if and only if their object
+                // representations do, compare whole blocks of memory while
+                // checking for cancellation in between
+                constexpr std::size_t block_size = 4096 / sizeof(value_type);
+
+                value_type const* p1 = std::addressof(*first1);
+                value_type const* p2 = std::addressof(*first2);
+                while (count != 0)
+                {
+                    if (tok.was_cancelled())
+                    {
+                        return;
+                    }
+
+                    std::size_t const n = (std::min)(count, block_size);
+                    if (std::memcmp(p1, p2, n * sizeof(value_type)) != 0)
+                    {
+                        tok.cancel();
+                        return;
+                    }
+
+                    p1 += n;
+                    p2 += n;
+                    count -= n;
+                }
+            }
+            else
+            {
+                using V =
+                    typename traits::detail::vector_pack_type<value_type>::type;
+
+                constexpr std::size_t size =
+                    traits::detail::vector_pack_size<V>::value;
+
+                for (/* */; count >= size; count -= size)
+                {
+                    if (tok.was_cancelled())
+                    {
+                        return;
+                    }
+
+                    V const v1 =
+                        traits::detail::vector_pack_load<V,
+                            value_type>::unaligned(first1);
+                    V const v2 =
+                        traits::detail::vector_pack_load<V,
+                            value_type>::unaligned(first2);
+                    if (traits::detail::any_of(datapar_not_equal{}(v1, v2)))
+                    {
+                        tok.cancel();
+                        return;
+                    }
+
+                    std::advance(first1, size);
+                    std::advance(first2, size);
+                }
+
+                for (/* */; count != 0; (void) --count, ++first1, ++first2)
+                {
+                    if (datapar_not_equal{}(*first1, *first2))
+                    {
+                        tok.cancel();
+                        return;
+                    }
+                }
+            }
+        }
+    };
+
+    template <typename ExPolicy, typename Iter1, typename Iter2,
+        typename Token, typename F, typename Proj1, typename Proj2,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_compare_compatible<Iter1, Iter2, Proj1,
+                    Proj2>::value&& is_datapar_equal_to<Iter1, F>::value)>
+    inline void tag_invoke(sequential_equal_n_t<ExPolicy>, Iter1 first1,
+        Iter2 first2, std::size_t count, Token& tok, F&&, Proj1&&, Proj2&&)
+    {
+        datapar_equal_n::call(first1, first2, count, tok);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct datapar_mismatch_n
+    {
+        template <typename Iter1, typename Iter2, typename Token,
+            typename Mismatch>
+        static void call(std::size_t base_idx, Iter1 first1, Iter2 first2,
+            std::size_t count, Token& tok, Mismatch mismatch)
+        {
+            using value_type = typename std::iterator_traits<Iter1>::value_type;
+            using V =
+                typename traits::detail::vector_pack_type<value_type>::type;
+
+            constexpr std::size_t size =
+                traits::detail::vector_pack_size<V>::value;
+
+            for (/* */; count >= size; count -= size, base_idx += size)
+            {
+                if (tok.was_cancelled(base_idx))
+                {
+                    return;
+                }
+
+                V const v1 =
+                    traits::detail::vector_pack_load<V, value_type>::unaligned(
+                        first1);
+                V const v2 =
+                    traits::detail::vector_pack_load<V, value_type>::unaligned(
+                        first2);
+                int const offset =
+                    traits::detail::find_first_of(mismatch(v1, v2));
+                if (offset != -1)
+                {
+                    tok.cancel(base_idx + offset);
+                    return;
+                }
+
+                std::advance(first1, size);
+                std::advance(first2, size);
+            }
+
+            for (/* */; count != 0;
+                 (void) --count, ++first1, ++first2, ++base_idx)
+            {
+                if (tok.was_cancelled(base_idx))
+                {
+                    return;
+                }
+                if (mismatch(*first1, *first2))
+                {
+                    tok.cancel(base_idx);
+                    return;
+                }
+            }
+        }
+    };
+
+    template <typename ExPolicy, typename Iter1, typename Iter2,
+        typename Token, typename F, typename Proj1, typename Proj2,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_compare_compatible<Iter1, Iter2, Proj1,
+                    Proj2>::value&& is_datapar_equal_to<Iter1, F>::value)>
+    inline void tag_invoke(sequential_mismatch_n_t<ExPolicy>,
+        std::size_t base_idx, Iter1 first1, Iter2 first2, std::size_t count,
+        Token& tok, F&&, Proj1&&, Proj2&&)
+    {
+        datapar_mismatch_n::call(
+            base_idx, first1, first2, count, tok, datapar_not_equal{});
+    }
+
+    template <typename ExPolicy, typename Iter1, typename Iter2,
+        typename Token, typename Pred, typename Proj1, typename Proj2,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_compare_compatible<Iter1, Iter2, Proj1,
+                    Proj2>::value&& is_datapar_less<Iter1, Pred>::value)>
+    inline void tag_invoke(sequential_lexicographical_mismatch_n_t<ExPolicy>,
+        std::size_t base_idx, Iter1 first1, Iter2 first2, std::size_t count,
+        Token& tok, Pred&&, Proj1&&, Proj2&&)
+    {
+        datapar_mismatch_n::call(
+            base_idx, first1, first2, count, tok, datapar_not_equivalent{});
+    }
+}    // namespace pika::parallel::detail
+#endif
@@ -0,0 +1,251 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR)
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/invoke.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/detail/distance.hpp>
+#include <pika/parallel/algorithms/detail/replace.hpp>
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/util/projection_identity.hpp>
+#include <pika/parallel/util/result_types.hpp>
+#include <pika/parallel/util/vector_pack_all_any_none.hpp>
+#include <pika/parallel/util/vector_pack_conditionals.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename InIter, typename OutIter = InIter,
+        typename Enable = void>
+    struct is_datapar_replace_iterator_compatible : std::false_type
+    {
+    };
+
+    template <typename InIter, typename OutIter>
+    struct is_datapar_replace_iterator_compatible<InIter, OutIter,
+        std::enable_if_t<iterator_datapar_compatible<InIter>::value &&
+            iterator_datapar_compatible<OutIter>::value>>
+    {
+        using value_type = typename std::iterator_traits<InIter>::value_type;
+
+        static constexpr bool value = !std::is_same_v<value_type, bool> &&
+            std::is_same_v<value_type,
+                typename std::iterator_traits<OutIter>::value_type>;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The elements are compared to old_value after converting it to the
+    // value_type of the sequence, which is equivalent to the scalar comparison
+    // only if that comparison is performed in value_type as well.
+    template <typename Iter, typename T, typename Proj, typename Enable = void>
+    struct is_datapar_replace_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter, typename T, typename Proj>
+    struct is_datapar_replace_compatible<Iter, T, Proj,
+        std::enable_if_t<is_datapar_replace_iterator_compatible<Iter>::value &&
+            std::is_arithmetic_v<T>>>
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        static constexpr bool value =
+            std::is_same_v<std::common_type_t<T, value_type>, value_type> &&
+            std::is_same_v<std::decay_t<Proj>, projection_identity>;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Matches elements (or vector-packs of elements) equal to the given value
+    template <typename T>
+    struct datapar_equal_to_value
+    {
+        T value;
+
+        template <typename V>
+        PIKA_FORCEINLINE auto operator()(V const& v) const
+        {
+            return v == V(value);
+        }
+    };
+
+    // Matches elements (or vector-packs of elements) satisfying the predicate
+    template <typename F, typename Proj>
+    struct datapar_replace_predicate
+    {
+        F& f;
+        Proj& proj;
+
+        template <typename V>
+        PIKA_FORCEINLINE auto operator()(V const& v) const
+        {
+            return PIKA_INVOKE(f, PIKA_INVOKE(proj, v));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct datapar_replace
+    {
+        // Vector-packs without any matching element are not written back,
+        // which avoids dirtying cache lines if replacements are rare.
+        template <typename Iter, typename Match, typename T>
+        static Iter call(Iter first, std::size_t count, Match match,
+            T const& new_value)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V =
+                typename traits::detail::vector_pack_type<value_type>::type;
+
+            constexpr std::size_t size =
+                traits::detail::vector_pack_size<V>::value;
+
+            V const new_v(static_cast<value_type>(new_value));
+            for (/* */; count >= size; count -= size)
+            {
+                V v = traits::detail::vector_pack_load<V,
+                    value_type>::unaligned(first);
+                auto const msk = match(v);
+                if (traits::detail::any_of(msk))
+                {
+                    traits::detail::mask_assign(msk, v, new_v);
+                    traits::detail::vector_pack_store<V,
+                        value_type>::unaligned(v, first);
+                }
+                std::advance(first, size);
+            }
+
+            for (/* */; count != 0; (void) --count, ++first)
+            {
+                if (match(*first))
+                {
+                    *first = new_value;
+                }
+            }
+            return first;
+        }
+    };
+
+    struct datapar_replace_copy
+    {
+        template <typename InIter, typename OutIter, typename Match,
+            typename T>
+        static in_out_result<InIter, OutIter> call(InIter first,
+            std::size_t count, OutIter dest, Match match, T const& new_value)
+        {
+            using value_type = typename std::iterator_traits<InIter>::value_type;
+            using V =
+                typename traits::detail::vector_pack_type<value_type>::type;
+
+            constexpr std::size_t size =
+                traits::detail::vector_pack_size<V>::value;
+
+            V const new_v(static_cast<value_type>(new_value));
+            for (/* */; count >= size; count -= size)
+            {
+                V const v = traits::detail::vector_pack_load<V,
+                    value_type>::unaligned(first);
+                V result = traits::detail::choose(match(v), new_v, v);
+                traits::detail::vector_pack_store<V, value_type>::unaligned(
+                    result, dest);
+
+                std::advance(first, size);
+                std::advance(dest, size);
+            }
+
+            for (/* */; count != 0; (void) --count, ++first, ++dest)
+            {
+                if (match(*first))
+                {
+                    *dest = new_value;
+                }
+                else
+                {
+                    *dest = *first;
+                }
+            }
+            return in_out_result<InIter, OutIter>{first, dest};
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename Sent, typename T1,
+        typename T2, typename Proj,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_replace_compatible<Iter, T1, Proj>::value&&
+                    std::is_arithmetic_v<T2>)>
+    inline Iter tag_invoke(sequential_replace_t<ExPolicy>, Iter first,
+        Sent last, T1 const& old_value, T2 const& new_value, Proj&&)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        return datapar_replace::call(first, detail::distance(first, last),
+            datapar_equal_to_value<value_type>{
+                static_cast<value_type>(old_value)},
+            new_value);
+    }
+
+    template <typename ExPolicy, typename Iter, typename Sent, typename F,
+        typename T, typename Proj,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_replace_iterator_compatible<Iter>::value&&
+                    std::is_arithmetic_v<T>)>
+    inline Iter tag_invoke(sequential_replace_if_t<ExPolicy>, Iter first,
+        Sent last, F&& f, T const& new_value, Proj&& proj)
+    {
+        return datapar_replace::call(first, detail::distance(first, last),
+            datapar_replace_predicate<std::remove_reference_t<F>,
+                std::remove_reference_t<Proj>>{f, proj},
+            new_value);
+    }
+
+    template <typename ExPolicy, typename InIter, typename Sent,
+        typename OutIter, typename T, typename Proj,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_replace_iterator_compatible<InIter, OutIter>::value&&
+                    is_datapar_replace_compatible<InIter, T, Proj>::value)>
+    inline in_out_result<InIter, OutIter> tag_invoke(
+        sequential_replace_copy_t<ExPolicy>, InIter first, Sent last,
+        OutIter dest, T const& old_value, T const& new_value, Proj&&)
+    {
+        using value_type = typename std::iterator_traits<InIter>::value_type;
+        return datapar_replace_copy::call(first,
+            detail::distance(first, last), dest,
+            datapar_equal_to_value<value_type>{
+                static_cast<value_type>(old_value)},
+            new_value);
+    }
+
+    template <typename ExPolicy, typename InIter, typename Sent,
+        typename OutIter, typename F, typename T, typename Proj,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_replace_iterator_compatible<InIter, OutIter>::value&&
+                    std::is_arithmetic_v<T>)>
+    inline in_out_result<InIter, OutIter> tag_invoke(
+        sequential_replace_copy_if_t<ExPolicy>, InIter first, Sent last,
+        OutIter dest, F&& f, T const& new_value, Proj&& proj)
+    {
+        return datapar_replace_copy::call(first,
+            detail::distance(first, last), dest,
+            datapar_replace_predicate<std::remove_reference_t<F>,
+                std::remove_reference_t<Proj>>{f, proj},
+            new_value);
+    }
+}    // namespace pika::parallel::detail
+#endif
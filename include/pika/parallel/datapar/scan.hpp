@@ -0,0 +1,228 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR)
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/detail/scan.hpp>
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/util/vector_pack_alignment_size.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The vectorized scan kernels reorder the applications of the operation
+    // inside a vector-pack, which is only done for std::plus over arithmetic
+    // types where input, output, and accumulator types match.
+    template <typename InIter, typename OutIter, typename T, typename Op,
+        typename Enable = void>
+    struct is_datapar_scan_compatible : std::false_type
+    {
+    };
+
+    template <typename InIter, typename OutIter, typename T, typename Op>
+    struct is_datapar_scan_compatible<InIter, OutIter, T, Op,
+        std::enable_if_t<iterator_datapar_compatible<InIter>::value &&
+            iterator_datapar_compatible<OutIter>::value>>
+    {
+        using value_type = typename std::iterator_traits<InIter>::value_type;
+        using op_type = std::decay_t<Op>;
+
+        static constexpr bool value = std::is_same_v<value_type,
+                                          typename std::iterator_traits<
+                                              OutIter>::value_type> &&
+            std::is_same_v<value_type, std::decay_t<T>> &&
+            !std::is_same_v<value_type, bool> &&
+            (std::is_same_v<op_type, std::plus<>> ||
+                std::is_same_v<op_type, std::plus<value_type>>);
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // In-register prefix sum over a vector-pack using log2(size) shift-and-add
+    // steps. Lane shifts go through a zero-padded scratch buffer of twice the
+    // pack size, which keeps this independent of the vector-pack backend.
+    template <typename V>
+    struct datapar_prefix_sum
+    {
+        using value_type = typename V::value_type;
+
+        static constexpr std::size_t size =
+            traits::detail::vector_pack_size<V>::value;
+
+        // the lower half of the buffer must be zero-initialized
+        PIKA_FORCEINLINE static V
+        shift_up(V value, std::size_t shift, value_type* buffer)
+        {
+            traits::detail::vector_pack_store<V, value_type>::unaligned(
+                value, buffer + size);
+            return traits::detail::vector_pack_load<V, value_type>::unaligned(
+                buffer + size - shift);
+        }
+
+        PIKA_FORCEINLINE static V inclusive(V value, value_type* buffer)
+        {
+            for (std::size_t shift = 1; shift < size; shift *= 2)
+            {
+                value += shift_up(value, shift, buffer);
+            }
+            return value;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct datapar_inclusive_scan_n
+    {
+        template <typename InIter, typename OutIter, typename T>
+        static T call(InIter first, std::size_t count, OutIter dest, T init)
+        {
+            using V = typename traits::detail::vector_pack_type<T>::type;
+            using prefix_sum = datapar_prefix_sum<V>;
+
+            constexpr std::size_t size = prefix_sum::size;
+            T buffer[2 * size] = {};
+
+            V carry(init);
+            for (/* */; count >= size; count -= size)
+            {
+                V value = prefix_sum::inclusive(
+                              traits::detail::vector_pack_load<V,
+                                  T>::unaligned(first),
+                              buffer) +
+                    carry;
+                traits::detail::vector_pack_store<V, T>::unaligned(value, dest);
+                carry = V(T(value[size - 1]));
+
+                std::advance(first, size);
+                std::advance(dest, size);
+            }
+
+            init = T(carry[0]);
+            for (/* */; count-- != 0; (void) ++first, ++dest)
+            {
+                init = init + *first;
+                *dest = init;
+            }
+            return init;
+        }
+    };
+
+    template <typename ExPolicy, typename InIter, typename OutIter, typename T,
+        typename Op,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_scan_compatible<InIter, OutIter, T, Op>::value)>
+    inline T tag_invoke(sequential_inclusive_scan_n_t<ExPolicy>, InIter first,
+        std::size_t count, OutIter dest, T init, Op&&)
+    {
+        return datapar_inclusive_scan_n::call(
+            first, count, dest, PIKA_MOVE(init));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct datapar_exclusive_scan_n
+    {
+        template <typename InIter, typename OutIter, typename T>
+        static T call(InIter first, std::size_t count, OutIter dest, T init)
+        {
+            using V = typename traits::detail::vector_pack_type<T>::type;
+            using prefix_sum = datapar_prefix_sum<V>;
+
+            constexpr std::size_t size = prefix_sum::size;
+            T buffer[2 * size] = {};
+
+            V carry(init);
+            for (/* */; count >= size; count -= size)
+            {
+                V value = prefix_sum::inclusive(
+                    traits::detail::vector_pack_load<V, T>::unaligned(first),
+                    buffer);
+
+                // lane i receives the inclusive sum of lane i - 1
+                V result = prefix_sum::shift_up(value, 1, buffer) + carry;
+                traits::detail::vector_pack_store<V, T>::unaligned(
+                    result, dest);
+                carry = V(T(carry[0] + value[size - 1]));
+
+                std::advance(first, size);
+                std::advance(dest, size);
+            }
+
+            init = T(carry[0]);
+            T temp = init;
+            for (/* */; count-- != 0; (void) ++first, ++dest)
+            {
+                init = init + *first;
+                *dest = temp;
+                temp = init;
+            }
+            return init;
+        }
+    };
+
+    template <typename ExPolicy, typename InIter, typename OutIter, typename T,
+        typename Op,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_scan_compatible<InIter, OutIter, T, Op>::value)>
+    inline T tag_invoke(sequential_exclusive_scan_n_t<ExPolicy>, InIter first,
+        std::size_t count, OutIter dest, T init, Op&&)
+    {
+        return datapar_exclusive_scan_n::call(
+            first, count, dest, PIKA_MOVE(init));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct datapar_scan_offset_n
+    {
+        template <typename Iter, typename T>
+        static Iter call(Iter first, std::size_t count, T const& val)
+        {
+            using V = typename traits::detail::vector_pack_type<T>::type;
+
+            constexpr std::size_t size =
+                traits::detail::vector_pack_size<V>::value;
+
+            V const offset(val);
+            for (/* */; count >= size; count -= size)
+            {
+                V value = offset +
+                    traits::detail::vector_pack_load<V, T>::unaligned(first);
+                traits::detail::vector_pack_store<V, T>::unaligned(
+                    value, first);
+                std::advance(first, size);
+            }
+
+            for (/* */; count-- != 0; ++first)
+            {
+                *first = val + *first;
+            }
+            return first;
+        }
+    };
+
+    template <typename ExPolicy, typename Iter, typename T, typename Op,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_scan_compatible<Iter, Iter, T, Op>::value)>
+    inline Iter tag_invoke(sequential_scan_offset_n_t<ExPolicy>, Iter first,
+        std::size_t count, T const& val, Op&&)
+    {
+        return datapar_scan_offset_n::call(first, count, val);
+    }
+}    // namespace pika::parallel::detail
+#endif
@@ -0,0 +1,397 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR)
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/detail/invoke.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/type_support/pack.hpp>
+#include <pika/type_support/unused.hpp>
+
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/datapar/loop.hpp>
+#include <pika/parallel/datapar/zip_iterator.hpp>
+#include <pika/parallel/util/loop.hpp>
+#include <pika/parallel/util/soa_iterator.hpp>
+#include <pika/parallel/util/transform_loop.hpp>
+#include <pika/parallel/util/vector_pack_alignment_size.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The number of lanes of the native vector pack of the elements of a
+    // contiguous sequence
+    template <typename Iter>
+    struct datapar_lanes
+    {
+        static constexpr std::size_t value =
+            traits::detail::vector_pack_size<typename traits::detail::
+                    vector_pack_type<typename std::iterator_traits<
+                        Iter>::value_type>::type>::value;
+    };
+
+    template <typename... Ts>
+    struct datapar_lanes<pika::util::soa_iterator<Ts...>>
+    {
+        static constexpr std::size_t value =
+            datapar_lanes<std::tuple_element_t<0, std::tuple<Ts*...>>>::value;
+    };
+
+    // All columns have to be arithmetic and their native vector packs have
+    // to have the same number of lanes, which is the case for elements of
+    // the same size.
+    template <typename... Ts>
+    constexpr bool is_datapar_soa_compatible() noexcept
+    {
+        if constexpr ((std::is_arithmetic_v<std::remove_const_t<Ts>> && ...))
+        {
+            constexpr std::size_t lanes =
+                datapar_lanes<pika::util::soa_iterator<Ts...>>::value;
+            return ((datapar_lanes<Ts*>::value == lanes) && ...);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    template <typename... Ts>
+    struct iterator_datapar_compatible_impl<pika::util::soa_iterator<Ts...>>
+      : std::bool_constant<is_datapar_soa_compatible<Ts...>()>
+    {
+    };
+
+    template <typename... Ts, typename Iter>
+    struct iterators_datapar_compatible_impl<pika::util::soa_iterator<Ts...>,
+        Iter>
+    {
+        using type = std::bool_constant<
+            datapar_lanes<pika::util::soa_iterator<Ts...>>::value ==
+            datapar_lanes<Iter>::value>;
+    };
+
+    // the generic vectorized loops can't split the packs returned for a
+    // single input into columns, those loops fall back to scalar code
+    template <typename Iter, typename... Ts>
+    struct iterators_datapar_compatible_impl<Iter,
+        pika::util::soa_iterator<Ts...>>
+    {
+        using type = std::false_type;
+    };
+
+    template <typename... Ts, typename... Us>
+    struct iterators_datapar_compatible_impl<pika::util::soa_iterator<Ts...>,
+        pika::util::soa_iterator<Us...>>
+    {
+        using type = std::bool_constant<
+            datapar_lanes<pika::util::soa_iterator<Ts...>>::value ==
+            datapar_lanes<pika::util::soa_iterator<Us...>>::value>;
+    };
+
+    template <typename... Ts>
+    struct is_data_aligned_impl<pika::util::soa_iterator<Ts...>>
+    {
+        static PIKA_FORCEINLINE bool call(
+            pika::util::soa_iterator<Ts...> const& it)
+        {
+            return std::apply(
+                [](Ts*... columns) {
+                    return (is_data_aligned(columns) && ...);
+                },
+                it.get_iterator_tuple());
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Each column is loaded into (and stored from) a vector pack of its own
+    // using unaligned loads and stores. The columns are usually not aligned
+    // relative to each other, waiting for all of them to be aligned (as the
+    // generic loops do) would mostly end up not vectorizing at all.
+    template <typename... Ts>
+    struct datapar_soa_loop_step
+    {
+        using iterator_type = pika::util::soa_iterator<Ts...>;
+
+        template <std::size_t N>
+        using pack_type = std::tuple<typename traits::detail::vector_pack_type<
+            std::remove_const_t<Ts>, N>::type...>;
+
+        using V = pack_type<0>;
+        using V1 = pack_type<1>;
+
+        static constexpr std::size_t size = datapar_lanes<iterator_type>::value;
+
+        template <typename Pack, std::size_t... Is>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static Pack load(
+            iterator_type const& it, pika::util::detail::index_pack<Is...>)
+        {
+            auto const& columns = it.get_iterator_tuple();
+            return Pack(traits::detail::vector_pack_load<
+                std::tuple_element_t<Is, Pack>,
+                std::remove_const_t<Ts>>::unaligned(std::get<Is>(columns))...);
+        }
+
+        template <typename Pack>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static Pack load(
+            iterator_type const& it)
+        {
+            return load<Pack>(
+                it, pika::util::detail::make_index_pack_t<sizeof...(Ts)>());
+        }
+
+        // the read-only columns are not written back
+        template <typename T, typename Vector>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static void store_column(
+            Vector& value, T* column)
+        {
+            if constexpr (!std::is_const_v<T>)
+            {
+                traits::detail::vector_pack_store<Vector, T>::unaligned(
+                    value, column);
+            }
+            else
+            {
+                PIKA_UNUSED(value);
+                PIKA_UNUSED(column);
+            }
+        }
+
+        template <typename Pack, std::size_t... Is>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static void store(Pack& value,
+            iterator_type const& it, pika::util::detail::index_pack<Is...>)
+        {
+            auto const& columns = it.get_iterator_tuple();
+            (store_column(std::get<Is>(value), std::get<Is>(columns)), ...);
+        }
+
+        template <typename Pack>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static void store(
+            Pack& value, iterator_type const& it)
+        {
+            store(value, it,
+                pika::util::detail::make_index_pack_t<sizeof...(Ts)>());
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // f is invoked with a pointer to the packs (loop_n), or with the
+        // packs themselves (loop_n_ind), and may modify them
+        template <std::size_t Lanes, typename Pack, typename F>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static void call(
+            F&& f, iterator_type& it)
+        {
+            Pack tmp = load<Pack>(it);
+            PIKA_INVOKE(f, &tmp);
+            store(tmp, it);
+            it += Lanes;
+        }
+
+        template <std::size_t Lanes, typename Pack, typename F>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static void call_ind(
+            F&& f, iterator_type& it)
+        {
+            Pack tmp = load<Pack>(it);
+            PIKA_INVOKE(f, tmp);
+            store(tmp, it);
+            it += Lanes;
+        }
+
+        // the pack returned by f is stored to dest
+        template <std::size_t Lanes, typename Pack, typename F,
+            typename OutIter>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static void transform(
+            F&& f, iterator_type& it, OutIter& dest)
+        {
+            Pack tmp = load<Pack>(it);
+            auto ret = PIKA_INVOKE(f, &tmp);
+            traits::detail::vector_pack_store<decltype(ret),
+                typename std::iterator_traits<OutIter>::value_type>::
+                unaligned(ret, dest);
+            it += Lanes;
+            std::advance(dest, Lanes);
+        }
+
+        template <std::size_t Lanes, typename Pack, typename F,
+            typename OutIter>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static void transform_ind(
+            F&& f, iterator_type& it, OutIter& dest)
+        {
+            Pack tmp = load<Pack>(it);
+            auto ret = PIKA_INVOKE(f, tmp);
+            traits::detail::vector_pack_store<decltype(ret),
+                typename std::iterator_traits<OutIter>::value_type>::
+                unaligned(ret, dest);
+            it += Lanes;
+            std::advance(dest, Lanes);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename... Ts, typename F,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_soa_compatible<Ts...>())>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE pika::util::soa_iterator<Ts...>
+    tag_invoke(loop_n_t<ExPolicy>, pika::util::soa_iterator<Ts...> it,
+        std::size_t count, F&& f)
+    {
+        using step = datapar_soa_loop_step<Ts...>;
+        using V = typename step::V;
+        using V1 = typename step::V1;
+
+        for (/* */; count >= step::size; count -= step::size)
+        {
+            step::template call<step::size, V>(f, it);
+        }
+        for (/* */; count != 0; --count)
+        {
+            step::template call<1, V1>(f, it);
+        }
+        return it;
+    }
+
+    template <typename ExPolicy, typename... Ts, typename F,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_soa_compatible<Ts...>())>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE pika::util::soa_iterator<Ts...>
+    tag_invoke(loop_n_ind_t<ExPolicy>, pika::util::soa_iterator<Ts...> it,
+        std::size_t count, F&& f)
+    {
+        using step = datapar_soa_loop_step<Ts...>;
+        using V = typename step::V;
+        using V1 = typename step::V1;
+
+        for (/* */; count >= step::size; count -= step::size)
+        {
+            step::template call_ind<step::size, V>(f, it);
+        }
+        for (/* */; count != 0; --count)
+        {
+            step::template call_ind<1, V1>(f, it);
+        }
+        return it;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutIter, typename... Ts>
+    inline constexpr bool is_datapar_soa_transform_compatible_v =
+        std::conjunction_v<
+            std::bool_constant<is_datapar_soa_compatible<Ts...>()>,
+            iterator_datapar_compatible<OutIter>,
+            iterators_datapar_compatible<pika::util::soa_iterator<Ts...>,
+                OutIter>>;
+
+    template <typename ExPolicy, typename... Ts, typename OutIter, typename F,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_soa_transform_compatible_v<OutIter, Ts...>)>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE
+        std::pair<pika::util::soa_iterator<Ts...>, OutIter>
+        tag_invoke(transform_loop_n_t<ExPolicy>,
+            pika::util::soa_iterator<Ts...> it, std::size_t count,
+            OutIter dest, F&& f)
+    {
+        using step = datapar_soa_loop_step<Ts...>;
+        using V = typename step::V;
+        using V1 = typename step::V1;
+
+        for (/* */; count >= step::size; count -= step::size)
+        {
+            step::template transform<step::size, V>(f, it, dest);
+        }
+        for (/* */; count != 0; --count)
+        {
+            step::template transform<1, V1>(f, it, dest);
+        }
+        return std::make_pair(PIKA_MOVE(it), PIKA_MOVE(dest));
+    }
+
+    template <typename ExPolicy, typename... Ts, typename OutIter, typename F,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_soa_transform_compatible_v<OutIter, Ts...>)>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE
+        std::pair<pika::util::soa_iterator<Ts...>, OutIter>
+        tag_invoke(transform_loop_n_ind_t<ExPolicy>,
+            pika::util::soa_iterator<Ts...> it, std::size_t count,
+            OutIter dest, F&& f)
+    {
+        using step = datapar_soa_loop_step<Ts...>;
+        using V = typename step::V;
+        using V1 = typename step::V1;
+
+        for (/* */; count >= step::size; count -= step::size)
+        {
+            step::template transform_ind<step::size, V>(f, it, dest);
+        }
+        for (/* */; count != 0; --count)
+        {
+            step::template transform_ind<1, V1>(f, it, dest);
+        }
+        return std::make_pair(PIKA_MOVE(it), PIKA_MOVE(dest));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // conv maps the packs of all columns to a pack of results, which are
+    // combined lane-wise by r. The lanes are reduced into init at the end
+    // (accumulate_values), the remaining rows are handled one at a time.
+    template <typename ExPolicy, typename... Ts, typename T, typename Reduce,
+        typename Convert,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_soa_compatible<Ts...>())>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE T tag_invoke(
+        transform_reduce_n_t<ExPolicy>, pika::util::soa_iterator<Ts...> it,
+        std::size_t count, T init, Reduce&& r, Convert&& conv)
+    {
+        using step = datapar_soa_loop_step<Ts...>;
+        using V = typename step::V;
+        using V1 = typename step::V1;
+
+        typename traits::detail::vector_pack_type<T, 1>::type result(init);
+        if (count >= step::size)
+        {
+            auto part_sum = PIKA_INVOKE(conv, step::template load<V>(it));
+            it += step::size;
+            count -= step::size;
+
+            for (/* */; count >= step::size; count -= step::size)
+            {
+                part_sum = PIKA_INVOKE(
+                    r, part_sum, PIKA_INVOKE(conv, step::template load<V>(it)));
+                it += step::size;
+            }
+
+            result = accumulate_values<ExPolicy>(
+                [&r](T const& sum, T&& val) -> T {
+                    return PIKA_INVOKE(r, sum, val);
+                },
+                part_sum, PIKA_MOVE(init));
+        }
+
+        for (/* */; count != 0; --count)
+        {
+            result = PIKA_INVOKE(
+                r, result, PIKA_INVOKE(conv, step::template load<V1>(it)));
+            ++it;
+        }
+
+        return extract_value<ExPolicy>(result);
+    }
+}    // namespace pika::parallel::detail
+#endif
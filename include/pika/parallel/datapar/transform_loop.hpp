@@ -9,6 +9,7 @@
 #include <pika/config.hpp>
 
 #if defined(PIKA_ALGORITHMS_HAVE_DATAPAR)
+#include <pika/concepts/concepts.hpp>
 #include <pika/execution/traits/is_execution_policy.hpp>
 #include <pika/executors/datapar/execution_policy.hpp>
 #include <pika/executors/execution_policy.hpp>
@@ -18,10 +19,12 @@
 #include <pika/parallel/datapar/iterator_helpers.hpp>
 #include <pika/parallel/util/cancellation_token.hpp>
 #include <pika/parallel/util/transform_loop.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+#include <pika/type_support/pack.hpp>
 
 #include <algorithm>
 #include <cstddef>
-#include <cstdint>
 #include <iterator>
 #include <tuple>
 #include <type_traits>
@@ -56,8 +59,7 @@ namespace pika::parallel::detail {
             static constexpr std::size_t size =
                 traits::detail::vector_pack_size<V>::value;
 
-            for (std::int64_t len_v = std::int64_t(len - (size + 1)); len_v > 0;
-                 len_v -= size, len -= size)
+            for (/* */; len >= size; len -= size)
             {
                 datapar_transform_loop_step::callv(f, first, dest);
             }
@@ -122,8 +124,7 @@ namespace pika::parallel::detail {
             static constexpr std::size_t size =
                 traits::detail::vector_pack_size<V>::value;
 
-            for (std::int64_t len_v = std::int64_t(len - (size + 1)); len_v > 0;
-                 len_v -= size, len -= size)
+            for (/* */; len >= size; len -= size)
             {
                 datapar_transform_loop_step_ind::callv(f, first, dest);
             }
@@ -144,7 +145,7 @@ namespace pika::parallel::detail {
             std::pair<InIter, OutIter>>::type
         call(InIter first, std::size_t count, OutIter dest, F&& f)
         {
-            return transform_loop_n_ind_impl<pika::execution::sequenced_policy>(
+            return transform_loop_n_ind<pika::execution::sequenced_policy>(
                 first, count, dest, PIKA_FORWARD(F, f));
         }
     };
@@ -241,7 +242,7 @@ namespace pika::parallel::detail {
             std::pair<InIter, OutIter>>::type
         call(InIter first, InIter last, OutIter dest, F&& f)
         {
-            return transform_loop_n_ind_impl<pika::execution::simd_policy>(
+            return transform_loop_n_ind<pika::execution::simd_policy>(
                 first, std::distance(first, last), dest, PIKA_FORWARD(F, f));
         }
 
@@ -319,8 +320,7 @@ namespace pika::parallel::detail {
             static constexpr std::size_t size =
                 traits::detail::vector_pack_size<V>::value;
 
-            for (std::int64_t len_v = std::int64_t(len - (size + 1)); len_v > 0;
-                 len_v -= size, len -= size)
+            for (/* */; len >= size; len -= size)
             {
                 datapar_transform_loop_step::callv(f, first1, first2, dest);
             }
@@ -520,8 +520,7 @@ namespace pika::parallel::detail {
             static constexpr std::size_t size =
                 traits::detail::vector_pack_size<V>::value;
 
-            for (std::int64_t len_v = std::int64_t(len - (size + 1)); len_v > 0;
-                 len_v -= size, len -= size)
+            for (/* */; len >= size; len -= size)
             {
                 datapar_transform_loop_step_ind::callv(f, first1, first2, dest);
             }
@@ -683,5 +682,179 @@ namespace pika::parallel::detail {
         return datapar_transform_binary_loop_ind<InIter1, InIter2>::call(
             first1, last1, first2, last2, dest, PIKA_FORWARD(F, f));
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The outputs of transform_n_out are written a vector pack at a time if
+    // the input and all outputs are sequences of arithmetic elements of the
+    // same size, which gives all of their packs the same number of lanes. The
+    // function object is invoked with a pack of input elements and has to
+    // return a tuple of packs of the element types of the outputs.
+    template <typename Iter, typename... OutIter>
+    struct is_datapar_transform_n_out_compatible
+      : std::integral_constant<bool,
+            iterator_datapar_compatible<Iter>::value &&
+                (iterator_datapar_compatible<OutIter>::value && ...) &&
+                ((sizeof(typename std::iterator_traits<OutIter>::value_type) ==
+                     sizeof(typename std::iterator_traits<Iter>::value_type)) &&
+                    ...)>
+    {
+    };
+
+    template <typename Iter, typename... OutIter>
+    struct datapar_transform_n_out_loop_n
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        template <std::size_t N, typename F, std::size_t... Is>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static void step(Iter& it,
+            std::tuple<OutIter...>& dests, F& f,
+            pika::util::detail::index_pack<Is...>)
+        {
+            using V =
+                typename traits::detail::vector_pack_type<value_type, N>::type;
+            constexpr std::size_t size =
+                traits::detail::vector_pack_size<V>::value;
+
+            auto&& values = PIKA_INVOKE(f,
+                traits::detail::vector_pack_load<V, value_type>::unaligned(it));
+
+            (store<N>(std::get<Is>(values), std::get<Is>(dests)), ...);
+            std::advance(it, size);
+        }
+
+        template <std::size_t N, typename Pack, typename Out>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static void store(
+            Pack const& pack, Out& dest)
+        {
+            using out_type = typename std::iterator_traits<Out>::value_type;
+            using V =
+                typename traits::detail::vector_pack_type<out_type, N>::type;
+
+            V value = pack;
+            traits::detail::vector_pack_store<V, out_type>::unaligned(
+                value, dest);
+            std::advance(dest, traits::detail::vector_pack_size<V>::value);
+        }
+
+        template <typename F>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static std::pair<Iter,
+            std::tuple<OutIter...>>
+        call(Iter it, std::size_t count, std::tuple<OutIter...> dests, F&& f)
+        {
+            using V =
+                typename traits::detail::vector_pack_type<value_type>::type;
+            using indices_type =
+                pika::util::detail::make_index_pack_t<sizeof...(OutIter)>;
+
+            constexpr std::size_t size =
+                traits::detail::vector_pack_size<V>::value;
+
+            for (/* */; count >= size; count -= size)
+            {
+                step<0>(it, dests, f, indices_type());
+            }
+
+            for (/* */; count != 0; --count)
+            {
+                step<1>(it, dests, f, indices_type());
+            }
+
+            return std::make_pair(PIKA_MOVE(it), PIKA_MOVE(dests));
+        }
+    };
+
+    template <typename ExPolicy, typename Iter, typename... OutIter,
+        typename F,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_transform_n_out_compatible<Iter,
+                    OutIter...>::value)>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE std::pair<Iter, std::tuple<OutIter...>>
+    tag_invoke(transform_n_out_loop_n_t<ExPolicy>, Iter it, std::size_t count,
+        std::tuple<OutIter...> dests, F&& f)
+    {
+        return datapar_transform_n_out_loop_n<Iter, OutIter...>::call(
+            it, count, PIKA_MOVE(dests), PIKA_FORWARD(F, f));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The neighborhoods a stencil function is invoked with by the vectorized
+    // loop, subscripting it with an offset k loads the pack of elements k
+    // positions away from the current ones.
+    template <typename Iter, typename V>
+    struct datapar_stencil_neighborhood
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE V operator[](std::ptrdiff_t k) const
+        {
+            return traits::detail::vector_pack_load<V, value_type>::unaligned(
+                std::next(it, k));
+        }
+
+        Iter it;
+    };
+
+    template <typename Iter, typename OutIter>
+    struct datapar_stencil_transform_loop_n
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using out_type = typename std::iterator_traits<OutIter>::value_type;
+
+        template <std::size_t N, typename F>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static void step(
+            Iter& it, OutIter& dest, F& f)
+        {
+            using V =
+                typename traits::detail::vector_pack_type<value_type, N>::type;
+            using V_out =
+                typename traits::detail::vector_pack_type<out_type, N>::type;
+
+            V_out value =
+                PIKA_INVOKE(f, datapar_stencil_neighborhood<Iter, V>{it});
+            traits::detail::vector_pack_store<V_out, out_type>::unaligned(
+                value, dest);
+
+            std::advance(it, traits::detail::vector_pack_size<V>::value);
+            std::advance(dest, traits::detail::vector_pack_size<V>::value);
+        }
+
+        template <typename F>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static std::pair<Iter, OutIter>
+        call(Iter it, std::size_t count, OutIter dest, F&& f)
+        {
+            using V =
+                typename traits::detail::vector_pack_type<value_type>::type;
+
+            constexpr std::size_t size =
+                traits::detail::vector_pack_size<V>::value;
+
+            for (/* */; count >= size; count -= size)
+            {
+                step<0>(it, dest, f);
+            }
+
+            for (/* */; count != 0; --count)
+            {
+                step<1>(it, dest, f);
+            }
+
+            return std::make_pair(PIKA_MOVE(it), PIKA_MOVE(dest));
+        }
+    };
+
+    // The stencil is vectorized under the same conditions as transform_n_out
+    // with a single output.
+    template <typename ExPolicy, typename Iter, typename OutIter, typename F,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_transform_n_out_compatible<Iter, OutIter>::value)>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE std::pair<Iter, OutIter> tag_invoke(
+        stencil_transform_loop_n_t<ExPolicy>, Iter it, std::size_t count,
+        OutIter dest, F&& f)
+    {
+        return datapar_stencil_transform_loop_n<Iter, OutIter>::call(
+            it, count, dest, PIKA_FORWARD(F, f));
+    }
 }    // namespace pika::parallel::detail
 #endif
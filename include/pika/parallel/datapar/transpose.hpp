@@ -0,0 +1,117 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR)
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/functional/tag_invoke.hpp>
+#include <pika/parallel/algorithms/detail/transpose.hpp>
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#include <pika/parallel/util/vector_pack_load_store.hpp>
+#include <pika/parallel/util/vector_pack_transpose.hpp>
+#include <pika/parallel/util/vector_pack_type.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename RandIter1, typename RandIter2, typename Enable = void>
+    struct is_datapar_transpose_compatible : std::false_type
+    {
+    };
+
+    // Only vector packs whose lanes can be permuted in registers are used,
+    // the block is transposed element by element otherwise.
+    template <typename RandIter1, typename RandIter2>
+    struct is_datapar_transpose_compatible<RandIter1, RandIter2,
+        std::enable_if_t<iterator_datapar_compatible<RandIter1>::value &&
+            iterator_datapar_compatible<RandIter2>::value>>
+    {
+        using value_type = typename std::iterator_traits<RandIter1>::value_type;
+        using V = typename traits::detail::vector_pack_type<value_type>::type;
+
+        static constexpr bool value =
+            std::is_same_v<value_type,
+                typename std::iterator_traits<RandIter2>::value_type> &&
+            traits::detail::vector_pack_transpose<V>::value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The block is transposed in square tiles of as many elements per side
+    // as a vector pack has lanes: the rows of a tile are loaded as vector
+    // packs, transposed in registers by log2(size) rounds of interleaving
+    // shuffles and stored as the rows of the transposed tile. Rows and
+    // columns not covering a whole tile are transposed element by element.
+    struct datapar_transpose_block
+    {
+        template <typename RandIter1, typename RandIter2>
+        static void call(RandIter1 src, std::size_t src_stride,
+            std::size_t rows, std::size_t cols, RandIter2 dest,
+            std::size_t dest_stride)
+        {
+            using value_type =
+                typename std::iterator_traits<RandIter1>::value_type;
+            using V =
+                typename traits::detail::vector_pack_type<value_type>::type;
+
+            constexpr std::size_t size =
+                traits::detail::vector_pack_size<V>::value;
+
+            std::size_t const tiled_rows = rows - rows % size;
+            std::size_t const tiled_cols = cols - cols % size;
+
+            for (std::size_t i0 = 0; i0 != tiled_rows; i0 += size)
+            {
+                for (std::size_t j0 = 0; j0 != tiled_cols; j0 += size)
+                {
+                    V tile[size];
+                    for (std::size_t i = 0; i != size; ++i)
+                    {
+                        tile[i] = traits::detail::vector_pack_load<V,
+                            value_type>::unaligned(
+                            src + (i0 + i) * src_stride + j0);
+                    }
+
+                    traits::detail::vector_pack_transpose<V>::call(tile);
+
+                    for (std::size_t j = 0; j != size; ++j)
+                    {
+                        traits::detail::vector_pack_store<V,
+                            value_type>::unaligned(tile[j],
+                            dest + (j0 + j) * dest_stride + i0);
+                    }
+                }
+
+                transpose_block_loop(src + i0 * src_stride + tiled_cols,
+                    src_stride, size, cols - tiled_cols,
+                    dest + tiled_cols * dest_stride + i0, dest_stride);
+            }
+
+            transpose_block_loop(src + tiled_rows * src_stride, src_stride,
+                rows - tiled_rows, cols, dest + tiled_rows, dest_stride);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename RandIter1, typename RandIter2,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_transpose_compatible<RandIter1, RandIter2>::value)>
+    inline void tag_invoke(sequential_transpose_block_t<ExPolicy>,
+        RandIter1 src, std::size_t src_stride, std::size_t rows,
+        std::size_t cols, RandIter2 dest, std::size_t dest_stride)
+    {
+        datapar_transpose_block::call(
+            src, src_stride, rows, cols, dest, dest_stride);
+    }
+}    // namespace pika::parallel::detail
+#endif
@@ -61,25 +61,34 @@ namespace pika::parallel::detail {
 }    // namespace pika::parallel::detail
 
 namespace pika::parallel::traits::detail {
-    template <typename Tuple, typename... Iter, std::size_t... Is>
-    Tuple aligned_pack(pika::util::zip_iterator<Iter...> const& iter,
-        pika::util::detail::index_pack<Is...>)
+    // The packs are loaded from (and stored to) the iterators returned by
+    // get_iterator_tuple(), which are provided by zip_iterator and
+    // soa_iterator alike.
+    template <typename Tuple, typename ZipIter, std::size_t... Is>
+    Tuple aligned_pack(
+        ZipIter const& iter, pika::util::detail::index_pack<Is...>)
     {
+        using iterator_tuple_type = typename ZipIter::iterator_tuple_type;
+
         auto const& t = iter.get_iterator_tuple();
         return std::make_tuple(
             vector_pack_load<typename std::tuple_element<Is, Tuple>::type,
-                typename std::iterator_traits<Iter>::value_type>::
+                typename std::iterator_traits<typename std::tuple_element<Is,
+                    iterator_tuple_type>::type>::value_type>::
                 aligned(std::get<Is>(t))...);
     }
 
-    template <typename Tuple, typename... Iter, std::size_t... Is>
-    Tuple unaligned_pack(pika::util::zip_iterator<Iter...> const& iter,
-        pika::util::detail::index_pack<Is...>)
+    template <typename Tuple, typename ZipIter, std::size_t... Is>
+    Tuple unaligned_pack(
+        ZipIter const& iter, pika::util::detail::index_pack<Is...>)
     {
+        using iterator_tuple_type = typename ZipIter::iterator_tuple_type;
+
         auto const& t = iter.get_iterator_tuple();
         return std::make_tuple(
             vector_pack_load<typename std::tuple_element<Is, Tuple>::type,
-                typename std::iterator_traits<Iter>::value_type>::
+                typename std::iterator_traits<typename std::tuple_element<Is,
+                    iterator_tuple_type>::type>::value_type>::
                 unaligned(std::get<Is>(t))...);
     }
 
@@ -88,67 +97,78 @@ namespace pika::parallel::traits::detail {
     {
         using value_type = std::tuple<Vector...>;
 
-        template <typename... Iter>
-        static value_type aligned(pika::util::zip_iterator<Iter...> const& iter)
+        template <typename ZipIter>
+        static value_type aligned(ZipIter const& iter)
         {
-            return traits::detail::aligned_pack<value_type>(
-                iter, pika::util::detail::make_index_pack_t<sizeof...(Iter)>());
+            return traits::detail::aligned_pack<value_type>(iter,
+                pika::util::detail::make_index_pack_t<sizeof...(Vector)>());
         }
 
-        template <typename... Iter>
-        static value_type
-        unaligned(pika::util::zip_iterator<Iter...> const& iter)
+        template <typename ZipIter>
+        static value_type unaligned(ZipIter const& iter)
         {
-            return traits::detail::unaligned_pack<value_type>(
-                iter, pika::util::detail::make_index_pack<sizeof...(Iter)>());
+            return traits::detail::unaligned_pack<value_type>(iter,
+                pika::util::detail::make_index_pack_t<sizeof...(Vector)>());
         }
     };
 
-    template <typename Tuple, typename... Iter, std::size_t... Is>
-    void
-    aligned_pack(Tuple& value, pika::util::zip_iterator<Iter...> const& iter,
+    // elements referenced through iterators to const (the read-only columns
+    // of a soa_iterator, for instance) are not written back
+    template <typename Vector, typename Iter>
+    void aligned_pack_element(Vector& value, Iter const& it)
+    {
+        using reference = typename std::iterator_traits<Iter>::reference;
+        if constexpr (!std::is_const_v<std::remove_reference_t<reference>>)
+        {
+            vector_pack_store<Vector,
+                typename std::iterator_traits<Iter>::value_type>::
+                aligned(value, it);
+        }
+    }
+
+    template <typename Vector, typename Iter>
+    void unaligned_pack_element(Vector& value, Iter const& it)
+    {
+        using reference = typename std::iterator_traits<Iter>::reference;
+        if constexpr (!std::is_const_v<std::remove_reference_t<reference>>)
+        {
+            vector_pack_store<Vector,
+                typename std::iterator_traits<Iter>::value_type>::
+                unaligned(value, it);
+        }
+    }
+
+    template <typename Tuple, typename ZipIter, std::size_t... Is>
+    void aligned_pack(Tuple& value, ZipIter const& iter,
         pika::util::detail::index_pack<Is...>)
     {
         auto const& t = iter.get_iterator_tuple();
-        int const sequencer[] = {0,
-            (vector_pack_store<typename std::tuple_element<Is, Tuple>::type,
-                 typename std::iterator_traits<Iter>::value_type>::
-                    aligned(std::get<Is>(value), std::get<Is>(t)),
-                0)...};
-        (void) sequencer;
+        (aligned_pack_element(std::get<Is>(value), std::get<Is>(t)), ...);
     }
 
-    template <typename Tuple, typename... Iter, std::size_t... Is>
-    void
-    unaligned_pack(Tuple& value, pika::util::zip_iterator<Iter...> const& iter,
+    template <typename Tuple, typename ZipIter, std::size_t... Is>
+    void unaligned_pack(Tuple& value, ZipIter const& iter,
         pika::util::detail::index_pack<Is...>)
     {
         auto const& t = iter.get_iterator_tuple();
-        int const sequencer[] = {0,
-            (vector_pack_store<typename std::tuple_element<Is, Tuple>::type,
-                 typename std::iterator_traits<Iter>::value_type>::
-                    unaligned(std::get<Is>(value), std::get<Is>(t)),
-                0)...};
-        (void) sequencer;
+        (unaligned_pack_element(std::get<Is>(value), std::get<Is>(t)), ...);
     }
 
     template <typename... Vector, typename ValueType>
     struct vector_pack_store<std::tuple<Vector...>, ValueType>
     {
-        template <typename V, typename... Iter>
-        static void
-        aligned(V& value, pika::util::zip_iterator<Iter...> const& iter)
+        template <typename V, typename ZipIter>
+        static void aligned(V& value, ZipIter const& iter)
         {
             traits::detail::aligned_pack(value, iter,
-                pika::util::detail::make_index_pack_t<sizeof...(Iter)>());
+                pika::util::detail::make_index_pack_t<sizeof...(Vector)>());
         }
 
-        template <typename V, typename... Iter>
-        static void
-        unaligned(V& value, pika::util::zip_iterator<Iter...> const& iter)
+        template <typename V, typename ZipIter>
+        static void unaligned(V& value, ZipIter const& iter)
         {
             traits::detail::unaligned_pack(value, iter,
-                pika::util::detail::make_index_pack<sizeof...(Iter)>());
+                pika::util::detail::make_index_pack_t<sizeof...(Vector)>());
         }
     };
 }    // namespace pika::parallel::traits::detail
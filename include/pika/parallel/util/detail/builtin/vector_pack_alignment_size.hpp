@@ -0,0 +1,57 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_BUILTIN_SIMD)
+#include <pika/parallel/util/detail/builtin/vector_pack_type.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace pika::parallel::traits::detail {
+    template <typename T, std::size_t N>
+    struct is_vector_pack<builtin_simd<T, N>> : std::bool_constant<N != 1>
+    {
+    };
+
+    template <typename T, std::size_t N>
+    struct is_scalar_vector_pack<builtin_simd<T, N>>
+      : std::bool_constant<N == 1>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Enable>
+    struct vector_pack_alignment
+    {
+        static std::size_t const value =
+            builtin_simd<T, builtin_simd_native_size<T>>::memory_alignment();
+    };
+
+    template <typename T, std::size_t N>
+    struct vector_pack_alignment<builtin_simd<T, N>>
+    {
+        static std::size_t const value = builtin_simd<T, N>::memory_alignment();
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Enable>
+    struct vector_pack_size
+    {
+        static std::size_t const value = builtin_simd_native_size<T>;
+    };
+
+    template <typename T, std::size_t N>
+    struct vector_pack_size<builtin_simd<T, N>>
+    {
+        static std::size_t const value = N;
+    };
+}    // namespace pika::parallel::traits::detail
+
+#endif
@@ -0,0 +1,43 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_BUILTIN_SIMD)
+#include <pika/parallel/util/detail/builtin/vector_pack_type.hpp>
+
+#include <cstddef>
+
+namespace pika::parallel::traits::detail {
+    // returns the lanes of v_true where msk is set and the lanes of v_false
+    // everywhere else
+    template <typename T, std::size_t N>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE builtin_simd<T, N> choose(
+        builtin_simd_mask<T, N> const& msk, builtin_simd<T, N> const& v_true,
+        builtin_simd<T, N> const& v_false)
+    {
+        using mask_storage = typename builtin_simd_mask<T, N>::storage_type;
+        using storage = typename builtin_simd<T, N>::storage_type;
+
+        // the lanes of the mask are all ones or all zeros, blend bitwise
+        mask_storage const bits = (msk.data() & (mask_storage) v_true.data()) |
+            (~msk.data() & (mask_storage) v_false.data());
+        return builtin_simd<T, N>((storage) bits);
+    }
+
+    // assigns the lanes of val to v where msk is set
+    template <typename T, std::size_t N>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE void mask_assign(
+        builtin_simd_mask<T, N> const& msk, builtin_simd<T, N>& v,
+        builtin_simd<T, N> const& val)
+    {
+        v = choose(msk, val, v);
+    }
+}    // namespace pika::parallel::traits::detail
+
+#endif
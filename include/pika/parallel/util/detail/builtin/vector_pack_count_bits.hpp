@@ -0,0 +1,25 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_BUILTIN_SIMD)
+#include <pika/parallel/util/detail/builtin/vector_pack_type.hpp>
+
+#include <cstddef>
+
+namespace pika::parallel::traits::detail {
+    template <typename T, std::size_t N>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE std::size_t
+    count_bits(builtin_simd_mask<T, N> const& mask)
+    {
+        return mask.count();
+    }
+}    // namespace pika::parallel::traits::detail
+
+#endif
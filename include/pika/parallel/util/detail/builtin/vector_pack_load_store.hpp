@@ -0,0 +1,52 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_BUILTIN_SIMD)
+#include <pika/parallel/util/detail/builtin/vector_pack_type.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace pika::parallel::traits::detail {
+    template <typename V, typename ValueType, typename Enable>
+    struct vector_pack_load
+    {
+        template <typename Iter>
+        static V aligned(Iter const& iter)
+        {
+            return V::load_aligned(std::addressof(*iter));
+        }
+
+        template <typename Iter>
+        static V unaligned(Iter const& iter)
+        {
+            return V::load(std::addressof(*iter));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename V, typename ValueType, typename Enable>
+    struct vector_pack_store
+    {
+        template <typename Iter>
+        static void aligned(V& value, Iter const& iter)
+        {
+            value.store_aligned(std::addressof(*iter));
+        }
+
+        template <typename Iter>
+        static void unaligned(V& value, Iter const& iter)
+        {
+            value.store(std::addressof(*iter));
+        }
+    };
+}    // namespace pika::parallel::traits::detail
+
+#endif
@@ -0,0 +1,78 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_BUILTIN_SIMD)
+#include <pika/parallel/util/detail/builtin/vector_pack_type.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace pika::parallel::traits::detail {
+    template <typename V>
+    struct vector_pack_transpose : std::false_type
+    {
+    };
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_shufflevector)
+    // Transposes the N x N tile whose rows are held by rows[0], ...,
+    // rows[N - 1]. Each of the log2(N) rounds interleaves the lower and the
+    // upper halves of the rows k and k + N / 2 into the rows 2k and 2k + 1.
+    template <typename T, std::size_t N>
+    struct vector_pack_transpose<builtin_simd<T, N>> : std::true_type
+    {
+        using simd_type = builtin_simd<T, N>;
+        using storage_type = typename simd_type::storage_type;
+
+        static PIKA_FORCEINLINE void call(simd_type (&rows)[N]) noexcept
+        {
+            for (std::size_t round = 1; round < N; round *= 2)
+            {
+                simd_type next[N];
+                for (std::size_t k = 0; k != N / 2; ++k)
+                {
+                    next[2 * k] = interleave_lower(rows[k], rows[k + N / 2],
+                        std::make_index_sequence<N>{});
+                    next[2 * k + 1] = interleave_upper(rows[k],
+                        rows[k + N / 2], std::make_index_sequence<N>{});
+                }
+                for (std::size_t k = 0; k != N; ++k)
+                {
+                    rows[k] = next[k];
+                }
+            }
+        }
+
+    private:
+        // the lanes [0, N / 2) of lhs and rhs, interleaved
+        template <std::size_t... Is>
+        static PIKA_FORCEINLINE simd_type interleave_lower(simd_type const& lhs,
+            simd_type const& rhs, std::index_sequence<Is...>) noexcept
+        {
+            return simd_type((storage_type) __builtin_shufflevector(lhs.data(),
+                rhs.data(), (Is % 2 == 0 ? Is / 2 : N + Is / 2)...));
+        }
+
+        // the lanes [N / 2, N) of lhs and rhs, interleaved
+        template <std::size_t... Is>
+        static PIKA_FORCEINLINE simd_type interleave_upper(simd_type const& lhs,
+            simd_type const& rhs, std::index_sequence<Is...>) noexcept
+        {
+            return simd_type((storage_type) __builtin_shufflevector(lhs.data(),
+                rhs.data(),
+                (Is % 2 == 0 ? N / 2 + Is / 2 : N + N / 2 + Is / 2)...));
+        }
+    };
+#endif
+#endif
+}    // namespace pika::parallel::traits::detail
+
+#endif
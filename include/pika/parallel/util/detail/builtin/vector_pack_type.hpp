@@ -0,0 +1,578 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_BUILTIN_SIMD)
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Width (in bytes) of the vector-packs generated by the built-in backend. It
+// defaults to the widest vector registers the compiler targets and may be
+// defined explicitly to generate code for a different instruction set.
+#if !defined(PIKA_ALGORITHMS_BUILTIN_SIMD_WIDTH)
+#if defined(__AVX512F__)
+#define PIKA_ALGORITHMS_BUILTIN_SIMD_WIDTH 64
+#elif defined(__AVX__)
+#define PIKA_ALGORITHMS_BUILTIN_SIMD_WIDTH 32
+#else
+#define PIKA_ALGORITHMS_BUILTIN_SIMD_WIDTH 16
+#endif
+#endif
+
+namespace pika::parallel::traits::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    template <std::size_t Size>
+    struct builtin_simd_lane_int;
+
+    template <>
+    struct builtin_simd_lane_int<1>
+    {
+        using type = std::int8_t;
+    };
+
+    template <>
+    struct builtin_simd_lane_int<2>
+    {
+        using type = std::int16_t;
+    };
+
+    template <>
+    struct builtin_simd_lane_int<4>
+    {
+        using type = std::int32_t;
+    };
+
+    template <>
+    struct builtin_simd_lane_int<8>
+    {
+        using type = std::int64_t;
+    };
+
+    template <typename T, std::size_t N>
+    class builtin_simd;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Each lane of a mask has the width of the corresponding element and is
+    // either all zeros or all ones, which allows reducing whole words at once.
+    template <typename T, std::size_t N>
+    class builtin_simd_mask
+    {
+        using lane_type = typename builtin_simd_lane_int<sizeof(T)>::type;
+
+    public:
+        using value_type = bool;
+        using simd_type = builtin_simd<T, N>;
+        typedef lane_type storage_type
+            __attribute__((vector_size(N * sizeof(T))));
+
+        static constexpr std::size_t size() noexcept
+        {
+            return N;
+        }
+
+        builtin_simd_mask() = default;
+
+        builtin_simd_mask(bool value) noexcept
+          : data_(storage_type{} + static_cast<lane_type>(value ? -1 : 0))
+        {
+        }
+
+        explicit builtin_simd_mask(storage_type data) noexcept
+          : data_(data)
+        {
+        }
+
+        bool operator[](std::size_t i) const noexcept
+        {
+            return data_[i] != 0;
+        }
+
+        storage_type const& data() const noexcept
+        {
+            return data_;
+        }
+
+        bool any() const noexcept
+        {
+            if constexpr (word_wise)
+            {
+                std::uint64_t result = 0;
+                for (std::size_t i = 0; i != num_words; ++i)
+                {
+                    result |= word(i);
+                }
+                return result != 0;
+            }
+            else
+            {
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    if (data_[i] != 0)
+                        return true;
+                }
+                return false;
+            }
+        }
+
+        bool all() const noexcept
+        {
+            if constexpr (word_wise)
+            {
+                std::uint64_t result = ~std::uint64_t(0);
+                for (std::size_t i = 0; i != num_words; ++i)
+                {
+                    result &= word(i);
+                }
+                return result == ~std::uint64_t(0);
+            }
+            else
+            {
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    if (data_[i] == 0)
+                        return false;
+                }
+                return true;
+            }
+        }
+
+        std::size_t count() const noexcept
+        {
+            if constexpr (word_wise)
+            {
+                std::size_t result = 0;
+                for (std::size_t i = 0; i != num_words; ++i)
+                {
+                    result += __builtin_popcountll(word(i));
+                }
+                return result / lane_bits;
+            }
+            else
+            {
+                std::size_t result = 0;
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    result += data_[i] != 0;
+                }
+                return result;
+            }
+        }
+
+        // returns the index of the first set lane, or -1 if none is set
+        int find_first_set() const noexcept
+        {
+            if constexpr (word_wise)
+            {
+                for (std::size_t i = 0; i != num_words; ++i)
+                {
+                    std::uint64_t const w = word(i);
+                    if (w != 0)
+                    {
+                        return static_cast<int>(i * lanes_per_word +
+                            __builtin_ctzll(w) / lane_bits);
+                    }
+                }
+                return -1;
+            }
+            else
+            {
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    if (data_[i] != 0)
+                        return static_cast<int>(i);
+                }
+                return -1;
+            }
+        }
+
+        friend builtin_simd_mask operator!(builtin_simd_mask const& m) noexcept
+        {
+            return builtin_simd_mask(storage_type(m.data_ == 0));
+        }
+
+        friend builtin_simd_mask operator&&(
+            builtin_simd_mask const& lhs, builtin_simd_mask const& rhs) noexcept
+        {
+            return builtin_simd_mask(lhs.data_ & rhs.data_);
+        }
+
+        friend builtin_simd_mask operator||(
+            builtin_simd_mask const& lhs, builtin_simd_mask const& rhs) noexcept
+        {
+            return builtin_simd_mask(lhs.data_ | rhs.data_);
+        }
+
+        friend builtin_simd_mask operator&(
+            builtin_simd_mask const& lhs, builtin_simd_mask const& rhs) noexcept
+        {
+            return builtin_simd_mask(lhs.data_ & rhs.data_);
+        }
+
+        friend builtin_simd_mask operator|(
+            builtin_simd_mask const& lhs, builtin_simd_mask const& rhs) noexcept
+        {
+            return builtin_simd_mask(lhs.data_ | rhs.data_);
+        }
+
+        friend builtin_simd_mask operator^(
+            builtin_simd_mask const& lhs, builtin_simd_mask const& rhs) noexcept
+        {
+            return builtin_simd_mask(lhs.data_ ^ rhs.data_);
+        }
+
+        friend builtin_simd_mask operator==(
+            builtin_simd_mask const& lhs, builtin_simd_mask const& rhs) noexcept
+        {
+            return builtin_simd_mask(storage_type(lhs.data_ == rhs.data_));
+        }
+
+        friend builtin_simd_mask operator!=(
+            builtin_simd_mask const& lhs, builtin_simd_mask const& rhs) noexcept
+        {
+            return builtin_simd_mask(storage_type(lhs.data_ != rhs.data_));
+        }
+
+    private:
+        static constexpr std::size_t num_words =
+            N * sizeof(T) / sizeof(std::uint64_t);
+        static constexpr std::size_t lane_bits = 8 * sizeof(T);
+        static constexpr std::size_t lanes_per_word =
+            sizeof(std::uint64_t) / sizeof(T);
+        static constexpr bool word_wise = num_words != 0 &&
+            __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+
+        std::uint64_t word(std::size_t i) const noexcept
+        {
+            std::uint64_t w;
+            __builtin_memcpy(&w,
+                reinterpret_cast<char const*>(&data_) +
+                    i * sizeof(std::uint64_t),
+                sizeof(std::uint64_t));
+            return w;
+        }
+
+        storage_type data_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Vector-pack based on the vector extensions of GCC and clang, the
+    // compiler lowers the operations to the instruction set it targets.
+    template <typename T, std::size_t N>
+    class builtin_simd
+    {
+        static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+            "builtin_simd requires a non-bool arithmetic element type");
+        static_assert(N != 0 && (N & (N - 1)) == 0,
+            "the size of a builtin_simd has to be a power of two");
+
+    public:
+        using value_type = T;
+        using mask_type = builtin_simd_mask<T, N>;
+        typedef T storage_type __attribute__((vector_size(N * sizeof(T))));
+
+        static constexpr std::size_t size() noexcept
+        {
+            return N;
+        }
+
+        static constexpr std::size_t memory_alignment() noexcept
+        {
+            return alignof(storage_type);
+        }
+
+        builtin_simd() = default;
+
+        // broadcasts the given value to all lanes
+        template <typename U,
+            typename Enable = std::enable_if_t<std::is_arithmetic_v<U>>>
+        builtin_simd(U value) noexcept
+          : data_(storage_type{} + static_cast<T>(value))
+        {
+        }
+
+        explicit builtin_simd(storage_type data) noexcept
+          : data_(data)
+        {
+        }
+
+        template <typename U>
+        static builtin_simd load(U const* p) noexcept
+        {
+            builtin_simd result;
+            if constexpr (std::is_same_v<U, T>)
+            {
+                __builtin_memcpy(&result.data_, p, sizeof(storage_type));
+            }
+            else
+            {
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    result.data_[i] = static_cast<T>(p[i]);
+                }
+            }
+            return result;
+        }
+
+        template <typename U>
+        static builtin_simd load_aligned(U const* p) noexcept
+        {
+            return load(static_cast<U const*>(
+                __builtin_assume_aligned(p, alignof(storage_type))));
+        }
+
+        template <typename U>
+        void store(U* p) const noexcept
+        {
+            if constexpr (std::is_same_v<U, T>)
+            {
+                __builtin_memcpy(p, &data_, sizeof(storage_type));
+            }
+            else
+            {
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    p[i] = static_cast<U>(data_[i]);
+                }
+            }
+        }
+
+        template <typename U>
+        void store_aligned(U* p) const noexcept
+        {
+            store(static_cast<U*>(
+                __builtin_assume_aligned(p, alignof(storage_type))));
+        }
+
+        // Elements of vector types can't be bound to references, lanes are
+        // set through this proxy instead.
+        class reference
+        {
+        public:
+            reference(storage_type& data, std::size_t i) noexcept
+              : data_(data)
+              , i_(i)
+            {
+            }
+
+            reference& operator=(T value) noexcept
+            {
+                data_[i_] = value;
+                return *this;
+            }
+
+            operator T() const noexcept
+            {
+                return data_[i_];
+            }
+
+        private:
+            storage_type& data_;
+            std::size_t i_;
+        };
+
+        T operator[](std::size_t i) const noexcept
+        {
+            return data_[i];
+        }
+
+        reference operator[](std::size_t i) noexcept
+        {
+            return reference(data_, i);
+        }
+
+        storage_type const& data() const noexcept
+        {
+            return data_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The operators are friends such that scalars on either side are
+        // broadcast implicitly, as for std::experimental::simd.
+        friend builtin_simd operator+(builtin_simd const& v) noexcept
+        {
+            return v;
+        }
+
+        friend builtin_simd operator-(builtin_simd const& v) noexcept
+        {
+            return builtin_simd(-v.data_);
+        }
+
+        friend builtin_simd operator~(builtin_simd const& v) noexcept
+        {
+            return builtin_simd(~v.data_);
+        }
+
+        friend builtin_simd operator+(
+            builtin_simd const& lhs, builtin_simd const& rhs) noexcept
+        {
+            return builtin_simd(lhs.data_ + rhs.data_);
+        }
+
+        friend builtin_simd operator-(
+            builtin_simd const& lhs, builtin_simd const& rhs) noexcept
+        {
+            return builtin_simd(lhs.data_ - rhs.data_);
+        }
+
+        friend builtin_simd operator*(
+            builtin_simd const& lhs, builtin_simd const& rhs) noexcept
+        {
+            return builtin_simd(lhs.data_ * rhs.data_);
+        }
+
+        friend builtin_simd operator/(
+            builtin_simd const& lhs, builtin_simd const& rhs) noexcept
+        {
+            return builtin_simd(lhs.data_ / rhs.data_);
+        }
+
+        friend builtin_simd operator%(
+            builtin_simd const& lhs, builtin_simd const& rhs) noexcept
+        {
+            return builtin_simd(lhs.data_ % rhs.data_);
+        }
+
+        friend builtin_simd operator&(
+            builtin_simd const& lhs, builtin_simd const& rhs) noexcept
+        {
+            return builtin_simd(lhs.data_ & rhs.data_);
+        }
+
+        friend builtin_simd operator|(
+            builtin_simd const& lhs, builtin_simd const& rhs) noexcept
+        {
+            return builtin_simd(lhs.data_ | rhs.data_);
+        }
+
+        friend builtin_simd operator^(
+            builtin_simd const& lhs, builtin_simd const& rhs) noexcept
+        {
+            return builtin_simd(lhs.data_ ^ rhs.data_);
+        }
+
+        friend builtin_simd operator<<(
+            builtin_simd const& lhs, builtin_simd const& rhs) noexcept
+        {
+            return builtin_simd(lhs.data_ << rhs.data_);
+        }
+
+        friend builtin_simd operator>>(
+            builtin_simd const& lhs, builtin_simd const& rhs) noexcept
+        {
+            return builtin_simd(lhs.data_ >> rhs.data_);
+        }
+
+        friend builtin_simd& operator+=(
+            builtin_simd& lhs, builtin_simd const& rhs) noexcept
+        {
+            lhs.data_ += rhs.data_;
+            return lhs;
+        }
+
+        friend builtin_simd& operator-=(
+            builtin_simd& lhs, builtin_simd const& rhs) noexcept
+        {
+            lhs.data_ -= rhs.data_;
+            return lhs;
+        }
+
+        friend builtin_simd& operator*=(
+            builtin_simd& lhs, builtin_simd const& rhs) noexcept
+        {
+            lhs.data_ *= rhs.data_;
+            return lhs;
+        }
+
+        friend builtin_simd& operator/=(
+            builtin_simd& lhs, builtin_simd const& rhs) noexcept
+        {
+            lhs.data_ /= rhs.data_;
+            return lhs;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        friend mask_type operator==(
+            builtin_simd const& lhs, builtin_simd const& rhs) noexcept
+        {
+            return make_mask(lhs.data_ == rhs.data_);
+        }
+
+        friend mask_type operator!=(
+            builtin_simd const& lhs, builtin_simd const& rhs) noexcept
+        {
+            return make_mask(lhs.data_ != rhs.data_);
+        }
+
+        friend mask_type operator<(
+            builtin_simd const& lhs, builtin_simd const& rhs) noexcept
+        {
+            return make_mask(lhs.data_ < rhs.data_);
+        }
+
+        friend mask_type operator<=(
+            builtin_simd const& lhs, builtin_simd const& rhs) noexcept
+        {
+            return make_mask(lhs.data_ <= rhs.data_);
+        }
+
+        friend mask_type operator>(
+            builtin_simd const& lhs, builtin_simd const& rhs) noexcept
+        {
+            return make_mask(lhs.data_ > rhs.data_);
+        }
+
+        friend mask_type operator>=(
+            builtin_simd const& lhs, builtin_simd const& rhs) noexcept
+        {
+            return make_mask(lhs.data_ >= rhs.data_);
+        }
+
+    private:
+        // the element type of comparison results differs between compilers,
+        // the conversion between vectors of the same size is a bit-cast
+        template <typename Result>
+        static mask_type make_mask(Result const& result) noexcept
+        {
+            return mask_type(
+                (typename mask_type::storage_type)(result));
+        }
+
+        storage_type data_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    inline constexpr std::size_t builtin_simd_native_size =
+        sizeof(T) < PIKA_ALGORITHMS_BUILTIN_SIMD_WIDTH ?
+        PIKA_ALGORITHMS_BUILTIN_SIMD_WIDTH / sizeof(T) :
+        1;
+
+    template <typename T, std::size_t N, typename Abi>
+    struct vector_pack_type_impl
+    {
+        using type = builtin_simd<T, N>;
+    };
+
+    // the built-in backend has a single ABI for every element type
+    template <typename T, typename Abi>
+    struct vector_pack_type_impl<T, 0, Abi>
+    {
+        using type = builtin_simd<T, builtin_simd_native_size<T>>;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N, typename Abi>
+    struct vector_pack_type : vector_pack_type_impl<T, N, Abi>
+    {
+    };
+}    // namespace pika::parallel::traits::detail
+
+#endif
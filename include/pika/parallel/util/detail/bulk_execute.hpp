@@ -0,0 +1,88 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/async_combinators/wait_all.hpp>
+#include <pika/concepts/concepts.hpp>
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/executors/execution_policy.hpp>
+#include <pika/iterator_support/counting_iterator.hpp>
+#include <pika/iterator_support/iterator_range.hpp>
+#include <pika/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Runs f(i) for all i in [0, n) on the given executor and returns once
+    // all of them are done, a single call is made on the calling thread.
+    // Exceptions thrown by f are handled as for ExPolicy once all calls are
+    // done.
+    template <typename ExPolicy, typename Exec, typename F>
+    void bulk_execute_n_impl(Exec&& exec, std::size_t n, F&& f)
+    {
+        if (n == 0)
+        {
+            return;
+        }
+
+        if (n == 1)
+        {
+            try
+            {
+                f(std::size_t(0));
+            }
+            catch (...)
+            {
+                handle_local_exceptions<ExPolicy>::call(
+                    std::current_exception());
+            }
+            return;
+        }
+
+        auto shape = pika::util::make_iterator_range(
+            pika::util::make_counting_iterator(std::size_t(0)),
+            pika::util::make_counting_iterator(n));
+
+        std::vector<pika::future<void>> workitems =
+            execution::bulk_async_execute(
+                PIKA_FORWARD(Exec, exec), PIKA_FORWARD(F, f), shape);
+
+        pika::wait_all_nothrow(workitems);
+
+        std::list<std::exception_ptr> errors;
+        handle_local_exceptions<ExPolicy>::call(workitems, errors);
+    }
+
+    // Runs f(i) for all i in [0, n) on the executor of the given policy
+    template <typename ExPolicy, typename F,
+        PIKA_CONCEPT_REQUIRES_(
+            pika::is_execution_policy_v<std::decay_t<ExPolicy>>)>
+    void bulk_execute_n(ExPolicy&& policy, std::size_t n, F&& f)
+    {
+        bulk_execute_n_impl<std::decay_t<ExPolicy>>(
+            policy.executor(), n, PIKA_FORWARD(F, f));
+    }
+
+    // Runs f(i) for all i in [0, n) on the given executor, the exceptions
+    // are handled as for the parallel policy
+    template <typename Exec, typename F,
+        PIKA_CONCEPT_REQUIRES_(
+            !pika::is_execution_policy_v<std::decay_t<Exec>>)>
+    void bulk_execute_n(Exec&& exec, std::size_t n, F&& f)
+    {
+        bulk_execute_n_impl<pika::execution::parallel_policy>(
+            PIKA_FORWARD(Exec, exec), n, PIKA_FORWARD(F, f));
+    }
+}    // namespace pika::parallel::detail
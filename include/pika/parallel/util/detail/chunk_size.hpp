@@ -11,14 +11,20 @@
 #include <pika/futures/future.hpp>
 #include <pika/iterator_support/iterator_range.hpp>
 
+#include <pika/concurrency/cache_line_data.hpp>
 #include <pika/execution/executors/execution_information.hpp>
 #include <pika/execution/executors/execution_parameters.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
 #include <pika/parallel/algorithms/detail/is_negative.hpp>
 #include <pika/parallel/algorithms/detail/predicates.hpp>
 #include <pika/parallel/util/detail/chunk_size_iterator.hpp>
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR)
+#include <pika/parallel/datapar/iterator_helpers.hpp>
+#endif
 
 #include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -111,6 +117,80 @@ namespace pika::parallel::detail {
         }
     }
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Number of elements the size of every chunk (but the last) has to be a
+    // multiple of.
+    template <typename ExPolicy, typename FwdIter, typename Enable = void>
+    struct chunk_size_granularity
+    {
+        static constexpr std::size_t call() noexcept
+        {
+            return 1;
+        }
+    };
+
+#if defined(PIKA_ALGORITHMS_HAVE_DATAPAR)
+    template <typename FwdIter, typename Enable = void>
+    struct is_chunk_alignment_compatible : std::false_type
+    {
+    };
+
+    template <typename FwdIter>
+    struct is_chunk_alignment_compatible<FwdIter,
+        std::enable_if_t<iterator_datapar_compatible<FwdIter>::value>>
+      : std::is_arithmetic<typename std::iterator_traits<FwdIter>::value_type>
+    {
+    };
+
+    // Datapar loops peel a scalar prologue up to the first vector-aligned
+    // element of each chunk and a scalar epilogue after its last full
+    // vector-pack. Chunks spanning whole cache lines all share the alignment
+    // of the first chunk (aligned for aligned input) and never write to the
+    // same cache line, so peeling happens at most once per chunk.
+    template <typename ExPolicy, typename FwdIter>
+    struct chunk_size_granularity<ExPolicy, FwdIter,
+        std::enable_if_t<pika::is_vectorpack_execution_policy<
+                             std::decay_t<ExPolicy>>::value &&
+            is_chunk_alignment_compatible<FwdIter>::value>>
+    {
+        static std::size_t call() noexcept
+        {
+            using value_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+
+            // different versions of clang-format do different things
+            // clang-format off
+            std::size_t const bytes = (std::max) (
+                pika::concurrency::detail::get_cache_line_size(),
+                std::size_t(traits::detail::vector_pack_alignment<
+                    value_type>::value));
+            return (std::max) (bytes / sizeof(value_type), std::size_t(1));
+            // clang-format on
+        }
+    };
+#endif
+
+    template <typename ExPolicy, typename FwdIter, typename Stride>
+    std::size_t get_chunk_size_granularity(Stride stride)
+    {
+        if (stride != 1)
+        {
+            return std::size_t(stride);
+        }
+        return chunk_size_granularity<ExPolicy, FwdIter>::call();
+    }
+
+    // rounds the chunk size up to the next multiple of the given granularity
+    inline constexpr std::size_t round_up_chunk_size(
+        std::size_t chunk_size, std::size_t granularity) noexcept
+    {
+        // different versions of clang-format do different things
+        // clang-format off
+        return (std::max) (granularity,
+            ((chunk_size + granularity - 1) / granularity) * granularity);
+        // clang-format on
+    }
+
     template <typename ExPolicy, typename Future, typename F1, typename FwdIter,
         typename Stride>
     // requires traits::is_future<Future>
@@ -126,20 +206,22 @@ namespace pika::parallel::detail {
             policy.parameters(), policy.executor(), cores, count);
 
         FwdIter last = parallel::detail::next(begin, count);
-        Stride stride = parallel::detail::abs(s);
+        std::size_t const granularity =
+            get_chunk_size_granularity<ExPolicy, FwdIter>(
+                parallel::detail::abs(s));
 
         auto test_function = [&](std::size_t test_chunk_size) -> std::size_t {
             if (test_chunk_size == 0)
                 return 0;
 
-            if (stride != 1)
+            if (granularity != 1)
             {
                 // different versions of clang-format do different things
                 // clang-format off
 
                 // rounding up
-                test_chunk_size = (std::max) (std::size_t(stride),
-                    ((test_chunk_size + stride - 1) / stride) * stride);
+                test_chunk_size = (std::min) (count,
+                    round_up_chunk_size(test_chunk_size, granularity));
                 // clang-format on
             }
 
@@ -158,13 +240,9 @@ namespace pika::parallel::detail {
         // make sure, chunk size and max_chunks are consistent
         adjust_chunk_size_and_max_chunks(cores, count, max_chunks, chunk_size);
 
-        if (stride != 1)
+        if (granularity != 1)
         {
-            // different versions of clang-format do different things
-            // clang-format off
-            chunk_size = (std::max) (std::size_t(stride),
-                ((chunk_size + stride - 1) / stride) * stride);
-            // clang-format on
+            chunk_size = round_up_chunk_size(chunk_size, granularity);
         }
 
         using iterator = chunk_size_iterator<FwdIter>;
@@ -193,7 +271,9 @@ namespace pika::parallel::detail {
         PIKA_ASSERT(0 != max_chunks);
 
         std::vector<tuple_type> shape;
-        Stride stride = parallel::detail::abs(s);
+        std::size_t const granularity =
+            get_chunk_size_granularity<ExPolicy, FwdIter>(
+                parallel::detail::abs(s));
 
         // different versions of clang-format do different things
         // clang-format off
@@ -214,10 +294,9 @@ namespace pika::parallel::detail {
             adjust_chunk_size_and_max_chunks(
                 cores, count, max_chunks, chunk_size, true);
 
-            if (stride != 1)
+            if (granularity != 1)
             {
-                chunk_size = (std::max) (std::size_t(stride),
-                    ((chunk_size + stride - 1) / stride) * stride);
+                chunk_size = round_up_chunk_size(chunk_size, granularity);
             }
 
             // in last chunk, consider only remaining number of elements
@@ -276,18 +355,22 @@ namespace pika::parallel::detail {
 
         FwdIter last = parallel::detail::next(begin, count);
 
-        Stride stride = parallel::detail::abs(s);
+        std::size_t const granularity =
+            get_chunk_size_granularity<ExPolicy, FwdIter>(
+                parallel::detail::abs(s));
         std::size_t base_idx = 0;
         auto test_function = [&](std::size_t test_chunk_size) -> std::size_t {
             if (test_chunk_size == 0)
                 return 0;
 
-            if (stride != 1)
+            if (granularity != 1)
             {
                 // different versions of clang-format do different things
                 // clang-format off
-                test_chunk_size = (std::max)(std::size_t(stride),
-                    ((test_chunk_size + stride - 1) / stride) * stride);
+
+                // rounding up
+                test_chunk_size = (std::min) (count,
+                    round_up_chunk_size(test_chunk_size, granularity));
                 // clang-format on
             }
 
@@ -309,13 +392,9 @@ namespace pika::parallel::detail {
         // make sure, chunk size and max_chunks are consistent
         adjust_chunk_size_and_max_chunks(cores, count, max_chunks, chunk_size);
 
-        if (stride != 1)
+        if (granularity != 1)
         {
-            // different versions of clang-format do different things
-            // clang-format off
-            chunk_size = (std::max) (std::size_t(stride),
-                ((chunk_size + stride - 1) / stride) * stride);
-            // clang-format on
+            chunk_size = round_up_chunk_size(chunk_size, granularity);
         }
 
         using iterator = chunk_size_idx_iterator<FwdIter>;
@@ -343,7 +422,9 @@ namespace pika::parallel::detail {
             policy.parameters(), policy.executor(), cores, count);
 
         std::vector<tuple_type> shape;
-        Stride stride = parallel::detail::abs(s);
+        std::size_t const granularity =
+            get_chunk_size_granularity<ExPolicy, FwdIter>(
+                parallel::detail::abs(s));
         std::size_t base_idx = 0;
 
         // different versions of clang-format do different things
@@ -365,10 +446,9 @@ namespace pika::parallel::detail {
             adjust_chunk_size_and_max_chunks(
                 cores, count, max_chunks, chunk_size, true);
 
-            if (stride != 1)
+            if (granularity != 1)
             {
-                chunk_size = (std::max) (std::size_t(stride),
-                    ((chunk_size + stride - 1) / stride) * stride);
+                chunk_size = round_up_chunk_size(chunk_size, granularity);
             }
 
             // in last chunk, consider only remaining number of elements
@@ -0,0 +1,39 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_STD_EXPERIMENTAL_SIMD)
+#include <experimental/simd>
+
+namespace pika::parallel::traits::detail {
+    // returns the lanes of v_true where msk is set and the lanes of v_false
+    // everywhere else
+    template <typename T, typename Abi>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE std::experimental::simd<T, Abi>
+    choose(std::experimental::simd_mask<T, Abi> const& msk,
+        std::experimental::simd<T, Abi> const& v_true,
+        std::experimental::simd<T, Abi> const& v_false)
+    {
+        std::experimental::simd<T, Abi> v = v_false;
+        std::experimental::where(msk, v) = v_true;
+        return v;
+    }
+
+    // assigns the lanes of val to v where msk is set
+    template <typename T, typename Abi>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE void
+    mask_assign(std::experimental::simd_mask<T, Abi> const& msk,
+        std::experimental::simd<T, Abi>& v,
+        std::experimental::simd<T, Abi> const& val)
+    {
+        std::experimental::where(msk, v) = val;
+    }
+}    // namespace pika::parallel::traits::detail
+
+#endif
@@ -0,0 +1,23 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#if defined(PIKA_ALGORITHMS_HAVE_STD_EXPERIMENTAL_SIMD)
+#include <type_traits>
+
+namespace pika::parallel::traits::detail {
+    // std::experimental::simd has no permutations of the lanes, tiles of
+    // its vector packs are not transposed in registers.
+    template <typename V>
+    struct vector_pack_transpose : std::false_type
+    {
+    };
+}    // namespace pika::parallel::traits::detail
+
+#endif
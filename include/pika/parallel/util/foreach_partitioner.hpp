@@ -24,6 +24,7 @@
 #include <pika/parallel/util/detail/partitioner_iteration.hpp>
 #include <pika/parallel/util/detail/scoped_executor_parameters.hpp>
 #include <pika/parallel/util/detail/select_partitioner.hpp>
+#include <pika/parallel/util/numa_affinity.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -54,9 +55,8 @@ namespace pika::parallel::detail {
             PIKA_FORWARD(ExPolicy, policy), inititems, f, first, count, 1);
 
         std::vector<pika::future<Result>> workitems =
-            execution::bulk_async_execute(policy.executor(),
-                partitioner_iteration<Result, F>{PIKA_FORWARD(F, f)},
-                PIKA_MOVE(shape));
+            bulk_async_execute_partitions<Result>(
+                policy, PIKA_FORWARD(F, f), PIKA_MOVE(shape), 0, count);
         return std::make_pair(PIKA_MOVE(inititems), PIKA_MOVE(workitems));
     }
 
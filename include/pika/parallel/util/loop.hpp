@@ -1183,6 +1183,41 @@ namespace pika::parallel::detail {
             it, count, PIKA_MOVE(init), PIKA_FORWARD(Pred, f));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Reduces the converted elements of [it, it + count) into init.
+    template <typename ExPolicy>
+    struct transform_reduce_n_t final
+      : pika::functional::detail::tag_fallback<transform_reduce_n_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename T, typename Reduce, typename Conv>
+        friend PIKA_HOST_DEVICE PIKA_FORCEINLINE T tag_fallback_invoke(
+            transform_reduce_n_t<ExPolicy>, Iter it, std::size_t count, T init,
+            Reduce&& r, Conv&& conv)
+        {
+            for (/**/; count != 0; (void) --count, ++it)
+            {
+                init = PIKA_INVOKE(r, init, PIKA_INVOKE(conv, *it));
+            }
+            return init;
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr transform_reduce_n_t<ExPolicy> transform_reduce_n =
+        transform_reduce_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce,
+        typename Conv>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE T transform_reduce_n(
+        Iter it, std::size_t count, T init, Reduce&& r, Conv&& conv)
+    {
+        return transform_reduce_n_t<ExPolicy>{}(it, count, PIKA_MOVE(init),
+            PIKA_FORWARD(Reduce, r), PIKA_FORWARD(Conv, conv));
+    }
+#endif
+
     template <typename T, typename Iter, typename Reduce,
         typename Conv = projection_identity>
     PIKA_FORCEINLINE T accumulate(
@@ -0,0 +1,246 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+#include <pika/coroutines/thread_enums.hpp>
+#include <pika/futures/future.hpp>
+#include <pika/topology/topology.hpp>
+#include <pika/type_support/unused.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/scheduling_properties.hpp>
+#include <pika/execution/traits/is_executor_parameters.hpp>
+#include <pika/parallel/util/detail/partitioner_iteration.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pika::parallel::detail {
+    // The number of NUMA domains of the system, at least one.
+    inline std::size_t numa_domains_count()
+    {
+        static std::size_t const count = (std::max)(
+            pika::threads::detail::create_topology().get_number_of_numa_nodes(),
+            std::size_t(1));
+        return count;
+    }
+}    // namespace pika::parallel::detail
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type which runs the partitions of parallel
+    /// algorithms on the NUMA domain owning the elements they work on.
+    ///
+    /// A sequence of \a count elements is divided into as many consecutive
+    /// blocks of equal size as there are domains, block \a d being assigned
+    /// to domain \a d. Each partition is scheduled on the domain owning its
+    /// middle element. As the assignment depends only on the position of
+    /// the elements, every algorithm invoked with this parameter over the
+    /// same sequence (or sequences of the same size) touches each element
+    /// from the same domain, independently of how it divides the sequence
+    /// into partitions.
+    ///
+    /// Memory pages are usually placed on the domain first writing to them.
+    /// Initializing a sequence with \a fill or \a uninitialized_value_construct
+    /// using this parameter places its pages on the domains the following
+    /// algorithms using it run their partitions on, see
+    /// \a first_touch_allocator.
+    ///
+    /// \note The partitions are scheduled using NUMA scheduling hints, which
+    ///       executors not supporting them ignore. The partitions stay on
+    ///       their domain only if work stealing across domains is disabled
+    ///       (pika.numa_sensitive=2).
+    ///
+    struct numa_affinity
+    {
+        /// Distribute the partitions over all NUMA domains of the system.
+        numa_affinity()
+          : domains_(parallel::detail::numa_domains_count())
+        {
+        }
+
+        /// Distribute the partitions over the given number of domains.
+        explicit constexpr numa_affinity(std::size_t domains) noexcept
+          : domains_((std::max)(domains, std::size_t(1)))
+        {
+        }
+
+        /// The number of domains the partitions are distributed over.
+        constexpr std::size_t domains() const noexcept
+        {
+            return domains_;
+        }
+
+        /// The domain the element at position \a index of a sequence of
+        /// \a count elements is assigned to.
+        constexpr std::size_t domain(
+            std::size_t index, std::size_t count) const noexcept
+        {
+            PIKA_ASSERT(index < count);
+            return index / ((count + domains_ - 1) / domains_);
+        }
+
+    private:
+        std::size_t domains_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Allocator which default-initializes the elements it constructs
+    /// without arguments, leaving trivial elements uninitialized. Memory
+    /// allocated through it is not written to by containers like
+    /// std::vector on construction or resizing, which leaves its placement
+    /// to the algorithm initializing it.
+    ///
+    /// \code
+    /// auto policy = pika::execution::par.with(numa_affinity());
+    /// std::vector<double, first_touch_allocator<double>> v(size);
+    /// pika::fill(policy, v.begin(), v.end(), 0.0);
+    /// \endcode
+    ///
+    template <typename T>
+    struct first_touch_allocator : std::allocator<T>
+    {
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = first_touch_allocator<U>;
+        };
+
+        first_touch_allocator() = default;
+
+        template <typename U>
+        constexpr first_touch_allocator(
+            first_touch_allocator<U> const&) noexcept
+        {
+        }
+
+        template <typename U>
+        void construct(U* p) noexcept(
+            std::is_nothrow_default_constructible_v<U>)
+        {
+            ::new (static_cast<void*>(p)) U;
+        }
+
+        template <typename U, typename... Ts>
+        void construct(U* p, Ts&&... ts)
+        {
+            ::new (static_cast<void*>(p)) U(PIKA_FORWARD(Ts, ts)...);
+        }
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::numa_affinity>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Runs f for every chunk of the shape, which covers the elements starting
+    // at position offset of a sequence of count elements (chunks carrying a
+    // base index are located by it instead). With the numa_affinity
+    // parameter the chunks are scheduled on the domains owning them, the
+    // returned futures are in the order of the chunks either way.
+    template <typename Result, typename ExPolicy, typename F, typename Shape>
+    std::vector<pika::future<Result>> bulk_async_execute_partitions(
+        ExPolicy&& policy, F&& f, Shape&& shape, std::size_t offset,
+        std::size_t count)
+    {
+        using parameters_type =
+            typename std::decay_t<ExPolicy>::executor_parameters_type;
+
+        if constexpr (std::is_base_of_v<pika::execution::numa_affinity,
+                          parameters_type>)
+        {
+            auto const& params =
+                static_cast<pika::execution::numa_affinity const&>(
+                    policy.parameters());
+
+            std::size_t const domains = params.domains();
+            if (domains > 1)
+            {
+                using element_type = std::decay_t<decltype(*shape.begin())>;
+
+                // distribute the chunks over the domains, remembering the
+                // domain of each of them
+                std::vector<std::vector<element_type>> shapes(domains);
+                std::vector<std::size_t> chunk_domains;
+                for (auto&& elem : shape)
+                {
+                    // chunks created with an index carry their position
+                    if constexpr (std::tuple_size_v<element_type> == 3)
+                    {
+                        offset = std::get<2>(elem);
+                    }
+
+                    std::size_t const size = std::get<1>(elem);
+                    std::size_t const domain =
+                        params.domain(offset + size / 2, count);
+
+                    shapes[domain].push_back(elem);
+                    chunk_domains.push_back(domain);
+                    offset += size;
+                }
+
+                partitioner_iteration<Result, F> iteration{PIKA_FORWARD(F, f)};
+
+                std::vector<std::vector<pika::future<Result>>> items(domains);
+                for (std::size_t d = 0; d != domains; ++d)
+                {
+                    if (shapes[d].empty())
+                    {
+                        continue;
+                    }
+
+                    auto exec = pika::execution::experimental::with_hint(
+                        policy.executor(),
+                        pika::execution::thread_schedule_hint(
+                            pika::execution::thread_schedule_hint_mode::numa,
+                            static_cast<std::int16_t>(d)));
+
+                    items[d] = execution::bulk_async_execute(
+                        exec, iteration, PIKA_MOVE(shapes[d]));
+                }
+
+                std::vector<pika::future<Result>> workitems;
+                workitems.reserve(chunk_domains.size());
+
+                std::vector<std::size_t> positions(domains, 0);
+                for (std::size_t d : chunk_domains)
+                {
+                    workitems.push_back(PIKA_MOVE(items[d][positions[d]++]));
+                }
+                return workitems;
+            }
+        }
+        else
+        {
+            PIKA_UNUSED(offset);
+            PIKA_UNUSED(count);
+        }
+
+        return execution::bulk_async_execute(policy.executor(),
+            partitioner_iteration<Result, F>{PIKA_FORWARD(F, f)},
+            PIKA_FORWARD(Shape, shape));
+    }
+}    // namespace pika::parallel::detail
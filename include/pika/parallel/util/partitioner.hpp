@@ -25,6 +25,7 @@
 #include <pika/parallel/util/detail/partitioner_iteration.hpp>
 #include <pika/parallel/util/detail/scoped_executor_parameters.hpp>
 #include <pika/parallel/util/detail/select_partitioner.hpp>
+#include <pika/parallel/util/numa_affinity.hpp>
 
 #include <cstddef>
 #include <exception>
@@ -48,14 +49,15 @@ namespace pika::parallel::detail {
             typename execution::extract_has_variable_chunk_size<
                 parameters_type>::type;
 
+        std::size_t const size = count;
+
         std::vector<pika::future<Result>> inititems;
         auto shape = get_bulk_iteration_shape(has_variable_chunk_size{},
             PIKA_FORWARD(ExPolicy, policy), inititems, f, first, count, 1);
 
         std::vector<pika::future<Result>> workitems =
-            execution::bulk_async_execute(policy.executor(),
-                partitioner_iteration<Result, F>{PIKA_FORWARD(F, f)},
-                PIKA_MOVE(shape));
+            bulk_async_execute_partitions<Result>(policy, PIKA_FORWARD(F, f),
+                PIKA_MOVE(shape), size - count, size);
 
         if (inititems.empty())
             return workitems;
@@ -84,9 +86,8 @@ namespace pika::parallel::detail {
             PIKA_FORWARD(ExPolicy, policy), inititems, f, first, count, stride);
 
         std::vector<pika::future<Result>> workitems =
-            execution::bulk_async_execute(policy.executor(),
-                partitioner_iteration<Result, F>{PIKA_FORWARD(F, f)},
-                PIKA_MOVE(shape));
+            bulk_async_execute_partitions<Result>(
+                policy, PIKA_FORWARD(F, f), PIKA_MOVE(shape), 0, count);
 
         if (inititems.empty())
             return workitems;
@@ -10,7 +10,10 @@
 #include <pika/concurrency/cache_line_data.hpp>
 #include <pika/iterator_support/traits/is_iterator.hpp>
 #include <pika/iterator_support/traits/is_range.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
 #include <pika/parallel/util/loop.hpp>
+#include <pika/parallel/util/result_types.hpp>
 #include <pika/type_support/pack.hpp>
 
 #include <algorithm>
@@ -53,18 +56,20 @@ namespace pika::parallel::detail {
             std::size_t chunk_size_;
             std::size_t range_size_;
             std::size_t idx_;
+            std::size_t distance_;
 
         public:
             // different versions of clang-format do different things
             // clang-format off
             explicit prefetching_iterator(std::size_t idx, base_iterator base,
                 std::size_t chunk_size, std::size_t range_size,
-                ranges_type const& rngs)
+                ranges_type const& rngs, std::size_t distance = 0)
               : rngs_(rngs)
               , base_(base)
               , chunk_size_(chunk_size)
               , range_size_(range_size)
               , idx_((std::min) (idx, range_size))
+              , distance_(distance)
             {
             }
             // clang-format on
@@ -91,6 +96,13 @@ namespace pika::parallel::detail {
                 return idx_;
             }
 
+            // The number of elements the indices are read ahead in indirect
+            // mode, zero in direct mode.
+            std::size_t prefetch_distance() const
+            {
+                return distance_;
+            }
+
             inline prefetching_iterator& operator+=(difference_type rhs)
             {
                 // different versions of clang-format do different things
@@ -214,34 +226,37 @@ namespace pika::parallel::detail {
             ranges_type rngs_;
             std::size_t chunk_size_;
             std::size_t range_size_;
+            std::size_t distance_;
 
             static constexpr std::size_t sizeof_first_value_type =
                 sizeof(typename std::tuple_element<0, ranges_type>::type::type);
 
         public:
             prefetcher_context(Itr begin, Itr end, ranges_type const& rngs,
-                std::size_t p_factor = 1)
+                std::size_t p_factor = 1, std::size_t distance = 0)
               : it_begin_(begin)
               , it_end_(end)
               , rngs_(rngs)
-              , chunk_size_(
+              , chunk_size_((std::max)(
                     (p_factor *
                         pika::concurrency::detail::get_cache_line_size()) /
-                    sizeof_first_value_type)
+                        sizeof_first_value_type,
+                    std::size_t(1)))
               , range_size_(std::distance(begin, end))
+              , distance_(distance)
             {
             }
 
             prefetching_iterator<Itr, Ts...> begin()
             {
-                return prefetching_iterator<Itr, Ts...>(
-                    0ull, it_begin_, chunk_size_, range_size_, rngs_);
+                return prefetching_iterator<Itr, Ts...>(0ull, it_begin_,
+                    chunk_size_, range_size_, rngs_, distance_);
             }
 
             prefetching_iterator<Itr, Ts...> end()
             {
-                return prefetching_iterator<Itr, Ts...>(
-                    range_size_, it_end_, chunk_size_, range_size_, rngs_);
+                return prefetching_iterator<Itr, Ts...>(range_size_, it_end_,
+                    chunk_size_, range_size_, rngs_, distance_);
             }
         };
 
@@ -264,6 +279,15 @@ namespace pika::parallel::detail {
         {
             prefetch_addresses((std::get<Is>(t).get())[idx]...);
         }
+#elif defined(PIKA_GCC_VERSION) || defined(PIKA_CLANG_VERSION)
+        template <typename... Ts, std::size_t... Is>
+        PIKA_FORCEINLINE void prefetch_containers(std::tuple<Ts...> const& t,
+            pika::util::detail::index_pack<Is...>, std::size_t idx)
+        {
+            int const sequencer[] = {
+                (__builtin_prefetch(&(std::get<Is>(t).get())[idx]), 0)..., 0};
+            (void) sequencer;
+        }
 #else
         template <typename... Ts, std::size_t... Is>
         PIKA_FORCEINLINE void prefetch_containers(std::tuple<Ts...> const& t,
@@ -275,39 +299,99 @@ namespace pika::parallel::detail {
 #endif
 
         ///////////////////////////////////////////////////////////////////////
-        struct loop_n_helper
+        // Invokes f with the base iterator of each element of the count chunks
+        // starting at it. In direct mode the elements of the ranges at the
+        // positions of the next chunk are prefetched after each chunk. In
+        // indirect mode the elements of the ranges referenced by the index
+        // prefetch_distance() positions ahead are prefetched before each
+        // element. The iteration stops before a chunk if cancelled() returns
+        // true.
+        template <typename Itr, typename... Ts, typename F, typename Cancelled>
+        PIKA_FORCEINLINE prefetching_iterator<Itr, Ts...> prefetching_loop_n(
+            prefetching_iterator<Itr, Ts...> it, std::size_t count, F&& f,
+            Cancelled&& cancelled)
         {
-            template <typename Itr, typename... Ts, typename F, typename Pred>
-            static constexpr prefetching_iterator<Itr, Ts...>
-            call(prefetching_iterator<Itr, Ts...> it, std::size_t count, F&& f,
-                Pred)
+            using index_pack_type =
+                typename pika::util::detail::make_index_pack<sizeof...(
+                    Ts)>::type;
+            using difference_type =
+                typename std::iterator_traits<Itr>::difference_type;
+
+            std::size_t const distance = it.prefetch_distance();
+            std::size_t const range_size = it.range_size();
+
+            // the elements of the first chunks of this sequence of chunks
+            // have not been prefetched by preceding iterations
+            if (distance != 0 && count != 0)
             {
-                using index_pack_type =
-                    typename pika::util::detail::make_index_pack<sizeof...(
-                        Ts)>::type;
+                Itr base = it.base();
+
+                // different versions of clang-format do different things
+                // clang-format off
+                std::size_t last = (std::min) (it.index() + distance,
+                    range_size);
+                // clang-format on
 
-                for (/**/; count != 0; (void) --count, ++it)
+                for (std::size_t j = it.index(); j != last; (void) ++j, ++base)
                 {
-                    Itr base = it.base();
-                    std::size_t j = it.index();
+                    prefetch_containers(it.ranges(), index_pack_type(),
+                        static_cast<std::size_t>(*base));
+                }
+            }
+
+            for (/**/; count != 0; (void) --count, ++it)
+            {
+                if (cancelled())
+                    break;
 
-                    // different versions of clang-format do different things
-                    // clang-format off
-                    std::size_t last = (std::min) (it.index() + it.chunk_size(),
-                        it.range_size());
-                    // clang-format on
+                Itr base = it.base();
+                std::size_t j = it.index();
+
+                // different versions of clang-format do different things
+                // clang-format off
+                std::size_t last = (std::min) (it.index() + it.chunk_size(),
+                    range_size);
+                // clang-format on
 
+                if (distance == 0)
+                {
                     for (/**/; j != last; (void) ++j, ++base)
                     {
                         f(base);
                     }
 
-                    if (j != it.range_size())
+                    if (j != range_size)
                     {
                         prefetch_containers(it.ranges(), index_pack_type(), j);
                     }
                 }
-                return it;
+                else
+                {
+                    for (/**/; j != last; (void) ++j, ++base)
+                    {
+                        if (j + distance < range_size)
+                        {
+                            prefetch_containers(it.ranges(), index_pack_type(),
+                                static_cast<std::size_t>(base[static_cast<
+                                    difference_type>(distance)]));
+                        }
+                        f(base);
+                    }
+                }
+            }
+            return it;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct loop_n_helper
+        {
+            template <typename Itr, typename... Ts, typename F, typename Pred>
+            static constexpr prefetching_iterator<Itr, Ts...>
+            call(prefetching_iterator<Itr, Ts...> it, std::size_t count, F&& f,
+                Pred)
+            {
+                return prefetching_loop_n(
+                    it, count, f, []() constexpr { return false; });
             }
 
             template <typename Itr, typename... Ts, typename CancelToken,
@@ -316,35 +400,8 @@ namespace pika::parallel::detail {
             call(prefetching_iterator<Itr, Ts...> it, std::size_t count,
                 CancelToken& tok, F&& f, Pred)
             {
-                using index_pack_type =
-                    typename pika::util::detail::make_index_pack<sizeof...(
-                        Ts)>::type;
-
-                for (/**/; count != 0; (void) --count, ++it)
-                {
-                    if (tok.was_cancelled())
-                        break;
-
-                    Itr base = it.base();
-                    std::size_t j = it.index();
-
-                    // different versions of clang-format do different things
-                    // clang-format off
-                    std::size_t last = (std::min) (it.index() + it.chunk_size(),
-                        it.range_size());
-                    // clang-format on
-
-                    for (/**/; j != last; (void) ++j, ++base)
-                    {
-                        f(base);
-                    }
-
-                    if (j != it.range_size())
-                    {
-                        prefetch_containers(it.ranges(), index_pack_type(), j);
-                    }
-                }
-                return it;
+                return prefetching_loop_n(
+                    it, count, f, [&tok]() { return tok.was_cancelled(); });
             }
         };
 
@@ -367,32 +424,9 @@ namespace pika::parallel::detail {
             call(prefetching_iterator<Itr, Ts...> it, std::size_t count, F&& f,
                 Pred)
             {
-                using index_pack_type =
-                    typename pika::util::detail::make_index_pack<sizeof...(
-                        Ts)>::type;
-
-                for (/**/; count != 0; (void) --count, ++it)
-                {
-                    Itr base = it.base();
-                    std::size_t j = it.index();
-
-                    // different versions of clang-format do different things
-                    // clang-format off
-                    std::size_t last = (std::min) (it.index() + it.chunk_size(),
-                        it.range_size());
-                    // clang-format on
-
-                    for (/**/; j != last; (void) ++j, ++base)
-                    {
-                        f(*base);
-                    }
-
-                    if (j != it.range_size())
-                    {
-                        prefetch_containers(it.ranges(), index_pack_type(), j);
-                    }
-                }
-                return it;
+                return prefetching_loop_n(
+                    it, count, [&f](Itr base) { f(*base); },
+                    []() constexpr { return false; });
             }
 
             template <typename Itr, typename... Ts, typename CancelToken,
@@ -401,35 +435,9 @@ namespace pika::parallel::detail {
             call(prefetching_iterator<Itr, Ts...> it, std::size_t count,
                 CancelToken& tok, F&& f, Pred)
             {
-                using index_pack_type =
-                    typename pika::util::detail::make_index_pack<sizeof...(
-                        Ts)>::type;
-
-                for (/**/; count != 0; (void) --count, ++it)
-                {
-                    if (tok.was_cancelled())
-                        break;
-
-                    Itr base = it.base();
-                    std::size_t j = it.index();
-
-                    // different versions of clang-format do different things
-                    // clang-format off
-                    std::size_t last = (std::min) (it.index() + it.chunk_size(),
-                        it.range_size());
-                    // clang-format on
-
-                    for (/**/; j != last; (void) ++j, ++base)
-                    {
-                        f(*base);
-                    }
-
-                    if (j != it.range_size())
-                    {
-                        prefetch_containers(it.ranges(), index_pack_type(), j);
-                    }
-                }
-                return it;
+                return prefetching_loop_n(
+                    it, count, [&f](Itr base) { f(*base); },
+                    [&tok]() { return tok.was_cancelled(); });
             }
         };
 
@@ -445,6 +453,14 @@ namespace pika::parallel::detail {
         }
     }    // namespace prefetching
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter>
+    inline constexpr bool is_prefetching_iterator_v = false;
+
+    template <typename Itr, typename... Ts>
+    inline constexpr bool is_prefetching_iterator_v<
+        prefetching::prefetching_iterator<Itr, Ts...>> = true;
+
     ///////////////////////////////////////////////////////////////////////////
     // function to create a prefetcher_context
     template <typename Itr, typename... Ts>
@@ -464,63 +480,52 @@ namespace pika::parallel::detail {
             base_begin, base_end, PIKA_MOVE(ranges), p_factor);
     }
 
+    // function to create a prefetcher_context for gathers: the iterators
+    // refer to indices into the ranges, the elements of the ranges referenced
+    // by the index distance positions ahead of the current one are
+    // prefetched
+    template <typename Itr, typename... Ts>
+    prefetching::prefetcher_context<Itr, Ts const...>
+    make_indirect_prefetcher_context(Itr index_begin, Itr index_end,
+        std::size_t distance, Ts const&... rngs)
+    {
+        static_assert(pika::traits::is_random_access_iterator<Itr>::value,
+            "Iterators have to be of random access iterator category");
+        static_assert(
+            std::is_integral_v<typename std::iterator_traits<Itr>::value_type>,
+            "Iterators have to refer to indices");
+        static_assert(
+            pika::util::detail::all_of_v<pika::traits::is_range<Ts>...>,
+            "All variadic parameters have to represent ranges");
+
+        using ranges_type = std::tuple<std::reference_wrapper<Ts const>...>;
+
+        auto&& ranges = ranges_type(std::cref(rngs)...);
+        return prefetching::prefetcher_context<Itr, Ts const...>(index_begin,
+            index_end, PIKA_MOVE(ranges), 1,
+            (std::max)(distance, std::size_t(1)));
+    }
+
     ///////////////////////////////////////////////////////////////////////
     template <typename Itr, typename... Ts>
     struct loop_impl<prefetching::prefetching_iterator<Itr, Ts...>>
     {
         using iterator_type = prefetching::prefetching_iterator<Itr, Ts...>;
         using type = typename iterator_type::base_iterator;
-        using index_pack_type =
-            typename pika::util::detail::make_index_pack<sizeof...(Ts)>::type;
 
         template <typename End, typename F>
         static iterator_type call(iterator_type it, End end, F&& f)
         {
-            for (/**/; it != end; ++it)
-            {
-                Itr base = it.base();
-                std::size_t j = it.index();
-
-                // different versions of clang-format do different things
-                // clang-format off
-                    std::size_t last = (std::min) (it.index() + it.chunk_size(),
-                        it.range_size());
-                // clang-format on
-
-                for (/**/; j != last; (void) ++j, ++base)
-                    f(base);
-
-                if (j != it.range_size())
-                    prefetch_containers(it.ranges(), index_pack_type(), j);
-            }
-            return it;
+            return prefetching::prefetching_loop_n(
+                it, end - it, f, []() constexpr { return false; });
         }
 
         template <typename End, typename CancelToken, typename F>
         static iterator_type
         call(iterator_type it, End end, CancelToken& tok, F&& f)
         {
-            for (/**/; it != end; ++it)
-            {
-                if (tok.was_cancelled())
-                    break;
-
-                Itr base = it.base();
-                std::size_t j = it.index();
-
-                // different versions of clang-format do different things
-                // clang-format off
-                    std::size_t last = (std::min) (it.index() + it.chunk_size(),
-                        it.range_size());
-                // clang-format on
-
-                for (/**/; j != last; (void) ++j, ++base)
-                    f(base);
-
-                if (j != it.range_size())
-                    prefetch_containers(it.ranges(), index_pack_type(), j);
-            }
-            return it;
+            return prefetching::prefetching_loop_n(
+                it, end - it, f, [&tok]() { return tok.was_cancelled(); });
         }
     };
 
@@ -530,57 +535,128 @@ namespace pika::parallel::detail {
     {
         using iterator_type = prefetching::prefetching_iterator<Itr, Ts...>;
         using type = typename iterator_type::base_iterator;
-        using index_pack_type =
-            typename pika::util::detail::make_index_pack<sizeof...(Ts)>::type;
 
         template <typename End, typename F>
         static iterator_type call(iterator_type it, End end, F&& f)
         {
-            for (/**/; it != end; ++it)
-            {
-                Itr base = it.base();
-                std::size_t j = it.index();
-
-                // different versions of clang-format do different things
-                // clang-format off
-                    std::size_t last = (std::min) (it.index() + it.chunk_size(),
-                        it.range_size());
-                // clang-format on
-
-                for (/**/; j != last; (void) ++j, ++base)
-                    f(*base);
-
-                if (j != it.range_size())
-                    prefetch_containers(it.ranges(), index_pack_type(), j);
-            }
-            return it;
+            return prefetching::prefetching_loop_n(
+                it, end - it, [&f](Itr base) { f(*base); },
+                []() constexpr { return false; });
         }
 
         template <typename End, typename CancelToken, typename F>
         static iterator_type
         call(iterator_type it, End end, CancelToken& tok, F&& f)
         {
-            for (/**/; it != end; ++it)
-            {
-                if (tok.was_cancelled())
-                    break;
+            return prefetching::prefetching_loop_n(
+                it, end - it, [&f](Itr base) { f(*base); },
+                [&tok]() { return tok.was_cancelled(); });
+        }
+    };
 
-                Itr base = it.base();
-                std::size_t j = it.index();
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers for the algorithms accepting prefetching iterators: f is
+    // invoked with the base iterator of each element of [first, last),
+    // sequentially or in parallel.
+    template <typename Itr, typename... Ts, typename F>
+    prefetching::prefetching_iterator<Itr, Ts...> prefetching_loop(
+        prefetching::prefetching_iterator<Itr, Ts...> first,
+        prefetching::prefetching_iterator<Itr, Ts...> last, F&& f)
+    {
+        return prefetching::prefetching_loop_n(
+            first, last - first, f, []() constexpr { return false; });
+    }
 
-                // different versions of clang-format do different things
-                // clang-format off
-                    std::size_t last = (std::min) (it.index() + it.chunk_size(),
-                        it.range_size());
-                // clang-format on
+    template <typename ExPolicy, typename Itr, typename... Ts, typename F>
+    algorithm_result_t<ExPolicy, prefetching::prefetching_iterator<Itr, Ts...>>
+    prefetching_for_each(ExPolicy&& policy,
+        prefetching::prefetching_iterator<Itr, Ts...> first,
+        prefetching::prefetching_iterator<Itr, Ts...> last, F&& f)
+    {
+        using iterator_type = prefetching::prefetching_iterator<Itr, Ts...>;
 
-                for (/**/; j != last; (void) ++j, ++base)
-                    f(*base);
+        if (first == last)
+        {
+            return algorithm_result<ExPolicy, iterator_type>::get(
+                PIKA_MOVE(last));
+        }
 
-                if (j != it.range_size())
-                    prefetch_containers(it.ranges(), index_pack_type(), j);
-            }
-            return it;
+        return foreach_partitioner<ExPolicy>::call(
+            PIKA_FORWARD(ExPolicy, policy), first, last - first,
+            [f = PIKA_FORWARD(F, f)](iterator_type part_begin,
+                std::size_t part_size, std::size_t) mutable {
+                prefetching::prefetching_loop_n(part_begin, part_size, f,
+                    []() constexpr { return false; });
+            },
+            [](iterator_type&& last) -> iterator_type {
+                return PIKA_MOVE(last);
+            });
+    }
+
+    // Writes the values f returns for the base iterators of the elements of
+    // [first, last) to the sequence starting at dest.
+    template <typename Itr, typename... Ts, typename OutIter, typename F>
+    in_out_result<prefetching::prefetching_iterator<Itr, Ts...>, OutIter>
+    prefetching_transform_loop(
+        prefetching::prefetching_iterator<Itr, Ts...> first,
+        prefetching::prefetching_iterator<Itr, Ts...> last, OutIter dest,
+        F&& f)
+    {
+        first = prefetching_loop(first, last, [&](Itr curr) {
+            *dest = f(curr);
+            ++dest;
+        });
+        return in_out_result<prefetching::prefetching_iterator<Itr, Ts...>,
+            OutIter>{PIKA_MOVE(first), PIKA_MOVE(dest)};
+    }
+
+    template <typename ExPolicy, typename Itr, typename... Ts,
+        typename OutIter, typename F>
+    algorithm_result_t<ExPolicy,
+        in_out_result<prefetching::prefetching_iterator<Itr, Ts...>, OutIter>>
+    prefetching_transform(ExPolicy&& policy,
+        prefetching::prefetching_iterator<Itr, Ts...> first,
+        prefetching::prefetching_iterator<Itr, Ts...> last, OutIter dest,
+        F&& f)
+    {
+        static_assert(pika::traits::is_forward_iterator_v<OutIter>,
+            "Requires at least forward iterator.");
+
+        using iterator_type = prefetching::prefetching_iterator<Itr, Ts...>;
+        using result_type = in_out_result<iterator_type, OutIter>;
+
+        if (first == last)
+        {
+            return algorithm_result<ExPolicy, result_type>::get(
+                result_type{PIKA_MOVE(last), PIKA_MOVE(dest)});
         }
-    };
+
+        std::size_t const first_index = first.index();
+        std::size_t const count = last.index() - first_index;
+
+        // each partition writes to the part of the output starting at the
+        // offset of its first element, the output is advanced with ++ only
+        return convert_to_result(
+            foreach_partitioner<ExPolicy>::call(
+                PIKA_FORWARD(ExPolicy, policy), first, last - first,
+                [first_index, dest, f = PIKA_FORWARD(F, f)](
+                    iterator_type part_begin, std::size_t part_size,
+                    std::size_t) mutable {
+                    OutIter part_dest =
+                        std::next(dest, part_begin.index() - first_index);
+                    prefetching::prefetching_loop_n(
+                        part_begin, part_size,
+                        [&](Itr curr) {
+                            *part_dest = f(curr);
+                            ++part_dest;
+                        },
+                        []() constexpr { return false; });
+                },
+                [](iterator_type&& last) -> iterator_type {
+                    return PIKA_MOVE(last);
+                }),
+            [dest, count](iterator_type&& last) -> result_type {
+                return result_type{PIKA_MOVE(last), std::next(dest, count)};
+            });
+    }
 }    // namespace pika::parallel::detail
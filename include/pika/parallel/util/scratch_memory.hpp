@@ -0,0 +1,381 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/assert.hpp>
+#include <pika/iterator_support/irange.hpp>
+#include <pika/type_support/unused.hpp>
+
+#include <pika/execution/executors/execution.hpp>
+#include <pika/execution/executors/execution_information.hpp>
+#include <pika/execution/traits/is_execution_policy.hpp>
+#include <pika/execution/traits/is_executor_parameters.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+// The number of bytes of scratch memory each thread keeps for reuse at most.
+#if !defined(PIKA_ALGORITHMS_SCRATCH_CACHE_SIZE)
+#define PIKA_ALGORITHMS_SCRATCH_CACHE_SIZE (std::size_t(64) << 20)
+#endif
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Interface of the memory resources parallel algorithms obtain their
+    /// temporary buffers from, see \a scratch_memory. Memory may be
+    /// allocated and deallocated on different threads.
+    struct scratch_resource
+    {
+        virtual ~scratch_resource() = default;
+
+        /// Allocate at least \a bytes bytes aligned to \a alignment, throws
+        /// on failure.
+        virtual void* allocate(std::size_t bytes, std::size_t alignment) = 0;
+
+        /// Return the memory \a p allocated from this resource with the same
+        /// \a bytes and \a alignment.
+        virtual void deallocate(
+            void* p, std::size_t bytes, std::size_t alignment) noexcept = 0;
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Requests of at least this size are served with blocks aligned to (and
+    // advised to be backed by) transparent huge pages, their pages are
+    // touched in parallel.
+    inline constexpr std::size_t scratch_huge_page_size = std::size_t(2) << 20;
+
+    // The scratch memory resource used by default. Blocks are rounded up to
+    // powers of two and returned to a small cache of the deallocating thread
+    // (replacing the least recently cached blocks), from which later requests
+    // of the same size class on that thread are served. Reused blocks have
+    // their pages mapped already.
+    class scratch_arena final : public pika::execution::scratch_resource
+    {
+        struct block
+        {
+            void* ptr = nullptr;
+            std::size_t size = 0;
+            std::size_t alignment = 0;
+        };
+
+        struct block_cache
+        {
+            static constexpr std::size_t max_blocks = 4;
+
+            ~block_cache()
+            {
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    release(blocks[i]);
+                }
+            }
+
+            std::array<block, max_blocks> blocks;
+            std::size_t count = 0;
+            std::size_t bytes = 0;
+        };
+
+        static block_cache& cache() noexcept
+        {
+            static thread_local block_cache c;
+            return c;
+        }
+
+        // The size class and alignment of the blocks serving a request.
+        static block size_class(
+            std::size_t bytes, std::size_t alignment) noexcept
+        {
+            std::size_t size = 4096;
+            while (size < bytes)
+            {
+                size *= 2;
+            }
+
+            std::size_t const min_alignment =
+                size >= scratch_huge_page_size ? scratch_huge_page_size : 64;
+            alignment = (std::max)(alignment, min_alignment);
+
+            return block{nullptr, (std::max)(size, alignment), alignment};
+        }
+
+        static void release(block const& b) noexcept
+        {
+            ::operator delete(b.ptr, b.size, std::align_val_t(b.alignment));
+        }
+
+    public:
+        void* allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            block b = size_class(bytes, alignment);
+
+            block_cache& c = cache();
+            for (std::size_t i = 0; i != c.count; ++i)
+            {
+                if (c.blocks[i].size == b.size &&
+                    c.blocks[i].alignment == b.alignment)
+                {
+                    void* p = c.blocks[i].ptr;
+                    c.bytes -= b.size;
+                    std::move(c.blocks.begin() + i + 1,
+                        c.blocks.begin() + c.count, c.blocks.begin() + i);
+                    --c.count;
+                    return p;
+                }
+            }
+
+            b.ptr = ::operator new(b.size, std::align_val_t(b.alignment));
+#if defined(MADV_HUGEPAGE)
+            if (b.size >= scratch_huge_page_size)
+            {
+                // this is only a hint, failures are irrelevant
+                ::madvise(b.ptr, b.size, MADV_HUGEPAGE);
+            }
+#endif
+            return b.ptr;
+        }
+
+        void deallocate(void* p, std::size_t bytes,
+            std::size_t alignment) noexcept override
+        {
+            block b = size_class(bytes, alignment);
+            b.ptr = p;
+
+            if (b.size > PIKA_ALGORITHMS_SCRATCH_CACHE_SIZE)
+            {
+                release(b);
+                return;
+            }
+
+            // make room by releasing the least recently cached blocks
+            block_cache& c = cache();
+            while (c.count == block_cache::max_blocks ||
+                c.bytes + b.size > PIKA_ALGORITHMS_SCRATCH_CACHE_SIZE)
+            {
+                release(c.blocks[0]);
+                c.bytes -= c.blocks[0].size;
+                std::move(c.blocks.begin() + 1, c.blocks.begin() + c.count,
+                    c.blocks.begin());
+                --c.count;
+            }
+
+            c.blocks[c.count++] = b;
+            c.bytes += b.size;
+        }
+    };
+
+    inline pika::execution::scratch_resource& default_scratch_resource()
+    {
+        static scratch_arena arena;
+        return arena;
+    }
+}    // namespace pika::parallel::detail
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type selecting the memory resource the parallel
+    /// algorithms allocate their temporary buffers from (the flags of
+    /// \a copy_if, \a remove_if, \a unique, \a unique_copy and
+    /// \a partition_copy, the intermediate results of the set operations,
+    /// the copy of the input sorted by \a partial_sort_copy and the buffers
+    /// of \a stable_sort and \a stable_partition).
+    ///
+    /// By default the buffers are allocated from an arena keeping recently
+    /// released blocks in thread local caches, which makes repeated
+    /// invocations reuse memory whose pages are mapped already. Large
+    /// buffers are backed by transparent huge pages where available. The
+    /// pages of large buffers are touched first by the threads working on
+    /// the corresponding parts of the input, which places them close to
+    /// these on NUMA systems.
+    ///
+    struct scratch_memory
+    {
+        /// Allocate the buffers from the default arena.
+        scratch_memory()
+          : resource_(&parallel::detail::default_scratch_resource())
+        {
+        }
+
+        /// Allocate the buffers from \a resource, which has to outlive the
+        /// algorithms using it.
+        explicit constexpr scratch_memory(scratch_resource& resource) noexcept
+          : resource_(&resource)
+        {
+        }
+
+        /// The memory resource the buffers are allocated from.
+        constexpr scratch_resource& resource() const noexcept
+        {
+            return *resource_;
+        }
+
+    private:
+        scratch_resource* resource_;
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::scratch_memory>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct scratch_array_deleter
+    {
+        void operator()(T* data) const noexcept
+        {
+            std::destroy_n(data, count);
+            resource->deallocate(data, count * sizeof(T), alignof(T));
+        }
+
+        pika::execution::scratch_resource* resource;
+        std::size_t count;
+    };
+
+    // The memory resource selected by the scratch_memory parameter of the
+    // policy, or the default arena.
+    template <typename ExPolicy>
+    pika::execution::scratch_resource& get_scratch_resource(ExPolicy&& policy)
+    {
+        using parameters_type =
+            typename std::decay_t<ExPolicy>::executor_parameters_type;
+
+        if constexpr (std::is_base_of_v<pika::execution::scratch_memory,
+                          parameters_type>)
+        {
+            return static_cast<pika::execution::scratch_memory const&>(
+                policy.parameters())
+                .resource();
+        }
+        else
+        {
+            PIKA_UNUSED(policy);
+            return default_scratch_resource();
+        }
+    }
+
+    // Allocates an array of count default-initialized elements of type T as
+    // temporary storage of a parallel algorithm, using the memory resource
+    // selected by the scratch_memory parameter of the policy (or the default
+    // arena). The pages of large arrays are touched in parallel, one chunk
+    // per core.
+    template <typename T, typename ExPolicy>
+    std::shared_ptr<T[]> make_scratch_array(
+        ExPolicy&& policy, std::size_t count)
+    {
+        pika::execution::scratch_resource* resource =
+            &get_scratch_resource(policy);
+
+        std::size_t const bytes = count * sizeof(T);
+        T* data = static_cast<T*>(resource->allocate(bytes, alignof(T)));
+
+        constexpr bool construct_in_parallel =
+            std::is_nothrow_default_constructible_v<T> &&
+            !pika::is_sequenced_execution_policy_v<ExPolicy>;
+
+        if (construct_in_parallel && bytes >= scratch_huge_page_size)
+        {
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor());
+            std::size_t const chunk = (count + cores - 1) / cores;
+
+            // each core touches (and constructs) the elements of one chunk
+            // first, this places the pages close to the threads working on
+            // the corresponding part of the input
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [data, count, chunk](std::size_t i) {
+                    std::size_t const first = (std::min)(i * chunk, count);
+                    std::size_t const last = (std::min)(first + chunk, count);
+
+                    if constexpr (std::is_trivially_default_constructible_v<T>)
+                    {
+                        constexpr std::size_t page_size = 4096;
+
+                        char* p = reinterpret_cast<char*>(data + first);
+                        char* const end = reinterpret_cast<char*>(data + last);
+                        for (/**/; p < end; p += page_size)
+                        {
+                            *p = 0;
+                        }
+                    }
+                    else
+                    {
+                        for (std::size_t j = first; j != last; ++j)
+                        {
+                            ::new (static_cast<void*>(data + j)) T;
+                        }
+                    }
+                },
+                pika::detail::irange(std::size_t(0), cores));
+        }
+        else
+        {
+            try
+            {
+                std::uninitialized_default_construct_n(data, count);
+            }
+            catch (...)
+            {
+                resource->deallocate(data, bytes, alignof(T));
+                throw;
+            }
+        }
+
+        return std::shared_ptr<T[]>(
+            data, scratch_array_deleter<T>{resource, count});
+    }
+
+    // Allocates an array holding copies of the count elements starting at
+    // first from the memory resource selected by the policy, see
+    // make_scratch_array.
+    template <typename ExPolicy, typename FwdIter>
+    std::shared_ptr<typename std::iterator_traits<FwdIter>::value_type[]>
+    make_scratch_array_copy(ExPolicy&& policy, FwdIter first, std::size_t count)
+    {
+        using value_type = typename std::iterator_traits<FwdIter>::value_type;
+
+        pika::execution::scratch_resource* resource =
+            &get_scratch_resource(policy);
+
+        std::size_t const bytes = count * sizeof(value_type);
+        value_type* data = static_cast<value_type*>(
+            resource->allocate(bytes, alignof(value_type)));
+
+        try
+        {
+            std::uninitialized_copy_n(first, count, data);
+        }
+        catch (...)
+        {
+            resource->deallocate(data, bytes, alignof(value_type));
+            throw;
+        }
+
+        return std::shared_ptr<value_type[]>(
+            data, scratch_array_deleter<value_type>{resource, count});
+    }
+}    // namespace pika::parallel::detail
@@ -0,0 +1,124 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/iterator_support/iterator_facade.hpp>
+#include <pika/iterator_support/iterator_range.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+
+namespace pika::util {
+    ///////////////////////////////////////////////////////////////////////////
+    /// A random access iterator traversing the columns of a structure of
+    /// arrays in lock step. Each column is a contiguous sequence of elements
+    /// of one of the types Ts, columns of const types are read-only.
+    /// Dereferencing the iterator yields a tuple of references to the
+    /// elements of the current row, just like a \a zip_iterator over the
+    /// column pointers would. The loops of the vectorizing execution
+    /// policies however load (and store) whole vector packs of each column
+    /// directly, independently of the alignment of the other columns, and
+    /// invoke the given function with a tuple of those packs.
+    template <typename... Ts>
+    class soa_iterator
+      : public iterator_facade<soa_iterator<Ts...>,
+            std::tuple<std::remove_const_t<Ts>...>,
+            std::random_access_iterator_tag, std::tuple<Ts&...>>
+    {
+        static_assert(sizeof...(Ts) != 0, "soa_iterator requires a column");
+
+        using base_type = iterator_facade<soa_iterator<Ts...>,
+            std::tuple<std::remove_const_t<Ts>...>,
+            std::random_access_iterator_tag, std::tuple<Ts&...>>;
+
+    public:
+        using iterator_tuple_type = std::tuple<Ts*...>;
+
+        soa_iterator() = default;
+
+        PIKA_HOST_DEVICE explicit soa_iterator(Ts*... columns) noexcept
+          : columns_(columns...)
+        {
+        }
+
+        PIKA_HOST_DEVICE explicit soa_iterator(
+            iterator_tuple_type const& columns) noexcept
+          : columns_(columns)
+        {
+        }
+
+        // the current positions in each of the columns
+        PIKA_HOST_DEVICE constexpr iterator_tuple_type const&
+        get_iterator_tuple() const noexcept
+        {
+            return columns_;
+        }
+
+    private:
+        friend class pika::util::iterator_core_access;
+
+        PIKA_HOST_DEVICE bool equal(soa_iterator const& rhs) const noexcept
+        {
+            return columns_ == rhs.columns_;
+        }
+
+        PIKA_HOST_DEVICE typename base_type::reference dereference() const
+        {
+            return std::apply(
+                [](Ts*... columns) {
+                    return typename base_type::reference(*columns...);
+                },
+                columns_);
+        }
+
+        PIKA_HOST_DEVICE void increment() noexcept
+        {
+            std::apply([](Ts*&... columns) { (++columns, ...); }, columns_);
+        }
+
+        PIKA_HOST_DEVICE void decrement() noexcept
+        {
+            std::apply([](Ts*&... columns) { (--columns, ...); }, columns_);
+        }
+
+        PIKA_HOST_DEVICE void advance(std::ptrdiff_t n) noexcept
+        {
+            std::apply(
+                [n](Ts*&... columns) { ((columns += n), ...); }, columns_);
+        }
+
+        PIKA_HOST_DEVICE std::ptrdiff_t distance_to(
+            soa_iterator const& rhs) const noexcept
+        {
+            return std::get<0>(rhs.columns_) - std::get<0>(columns_);
+        }
+
+    private:
+        iterator_tuple_type columns_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename... Ts>
+    PIKA_HOST_DEVICE soa_iterator<Ts...> make_soa_iterator(
+        Ts*... columns) noexcept
+    {
+        return soa_iterator<Ts...>(columns...);
+    }
+
+    // the range of the first count rows of the given columns
+    template <typename... Ts>
+    iterator_range<soa_iterator<Ts...>> make_soa_range(
+        std::size_t count, Ts*... columns)
+    {
+        soa_iterator<Ts...> first(columns...);
+        return make_iterator_range(
+            first, first + static_cast<std::ptrdiff_t>(count));
+    }
+}    // namespace pika::util
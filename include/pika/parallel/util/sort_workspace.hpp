@@ -0,0 +1,154 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace pika {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Memory reused by the sorting algorithms across calls. Passing the same
+    /// workspace to repeated calls of \a stable_sort keeps the auxiliary
+    /// element buffer and the bookkeeping of the parallel sort alive, sorts
+    /// no larger than the ones seen before then do not allocate any of it.
+    ///
+    /// \tparam T   The value type of the sequences sorted with this workspace.
+    ///
+    /// \note A workspace must not be used by more than one sort at a time.
+    ///
+    template <typename T>
+    class sort_workspace
+    {
+    public:
+        /// Creates an empty workspace using the default oversampling.
+        sort_workspace() = default;
+
+        /// Creates an empty workspace.
+        ///
+        /// \param oversampling The number of intervals each thread's part of
+        ///                     the sequence is split into by the parallel
+        ///                     sort, zero selects the default.
+        explicit sort_workspace(std::uint32_t oversampling) noexcept
+          : oversampling_(oversampling)
+        {
+        }
+
+        sort_workspace(sort_workspace const&) = delete;
+        sort_workspace& operator=(sort_workspace const&) = delete;
+
+        sort_workspace(sort_workspace&& rhs) noexcept
+          : buffer_(std::exchange(rhs.buffer_, nullptr))
+          , capacity_(std::exchange(rhs.capacity_, 0))
+          , oversampling_(rhs.oversampling_)
+          , scratch_(PIKA_MOVE(rhs.scratch_))
+        {
+        }
+
+        sort_workspace& operator=(sort_workspace&& rhs) noexcept
+        {
+            std::swap(buffer_, rhs.buffer_);
+            std::swap(capacity_, rhs.capacity_);
+            oversampling_ = rhs.oversampling_;
+            std::swap(scratch_, rhs.scratch_);
+            return *this;
+        }
+
+        ~sort_workspace()
+        {
+            std::free(buffer_);
+        }
+
+        /// Makes sure sorting up to \a count elements does not have to grow
+        /// the auxiliary element buffer.
+        void reserve(std::size_t count)
+        {
+            buffer((count + 1) >> 1);
+        }
+
+        /// Returns the number of elements the auxiliary buffer can hold.
+        std::size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        /// Returns the oversampling used by the parallel sort, zero stands
+        /// for the default.
+        std::uint32_t oversampling() const noexcept
+        {
+            return oversampling_;
+        }
+
+        /// Changes the oversampling used by the parallel sort.
+        void oversampling(std::uint32_t value) noexcept
+        {
+            oversampling_ = value;
+        }
+
+        /// \cond NOINTERNAL
+        // Uninitialized storage for at least size elements.
+        T* buffer(std::size_t size)
+        {
+            if (size > capacity_)
+            {
+                T* ptr = static_cast<T*>(std::malloc(sizeof(T) * size));
+                if (ptr == nullptr)
+                {
+                    throw std::bad_alloc();
+                }
+                std::free(buffer_);
+                buffer_ = ptr;
+                capacity_ = size;
+            }
+            return buffer_;
+        }
+
+        // The bookkeeping of the sort algorithm using the workspace, it is
+        // replaced whenever the workspace is used with a different iterator
+        // type.
+        template <typename Scratch>
+        Scratch& scratch()
+        {
+            if (!scratch_ || scratch_->tag() != &scratch_holder<Scratch>::id)
+            {
+                scratch_ = std::make_unique<scratch_holder<Scratch>>();
+            }
+            return static_cast<scratch_holder<Scratch>&>(*scratch_).data;
+        }
+        /// \endcond
+
+    private:
+        struct scratch_base
+        {
+            virtual ~scratch_base() = default;
+            virtual void const* tag() const noexcept = 0;
+        };
+
+        template <typename Scratch>
+        struct scratch_holder final : scratch_base
+        {
+            static constexpr char id = 0;
+
+            void const* tag() const noexcept override
+            {
+                return &id;
+            }
+
+            Scratch data;
+        };
+
+        T* buffer_ = nullptr;
+        std::size_t capacity_ = 0;
+        std::uint32_t oversampling_ = 0;
+        std::unique_ptr<scratch_base> scratch_;
+    };
+}    // namespace pika
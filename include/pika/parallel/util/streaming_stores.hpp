@@ -0,0 +1,322 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <pika/config.hpp>
+#include <pika/algorithms/traits/pointer_category.hpp>
+#include <pika/execution/traits/is_executor_parameters.hpp>
+#include <pika/iterator_support/traits/is_iterator.hpp>
+#include <pika/parallel/util/detail/algorithm_result.hpp>
+#include <pika/parallel/util/foreach_partitioner.hpp>
+#include <pika/parallel/util/result_types.hpp>
+#include <pika/parallel/util/transfer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#if defined(PIKA_ALGORITHMS_HAVE_MM_STREAM)
+#if defined(PIKA_MSVC)
+#include <intrin.h>
+#endif
+#if defined(PIKA_GCC_VERSION)
+#include <emmintrin.h>
+#endif
+#endif
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+#if !defined(PIKA_ALGORITHMS_LAST_LEVEL_CACHE_SIZE)
+#define PIKA_ALGORITHMS_LAST_LEVEL_CACHE_SIZE (std::size_t(32) << 20)
+#endif
+
+namespace pika::parallel::detail {
+    // The size of the last level cache in bytes, as reported by the system
+    // or PIKA_ALGORITHMS_LAST_LEVEL_CACHE_SIZE if it is not known.
+    inline std::size_t last_level_cache_size() noexcept
+    {
+        static std::size_t const size = []() -> std::size_t {
+#if defined(_SC_LEVEL3_CACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+            for (int name : {_SC_LEVEL3_CACHE_SIZE, _SC_LEVEL2_CACHE_SIZE})
+            {
+                long const result = ::sysconf(name);
+                if (result > 0)
+                {
+                    return static_cast<std::size_t>(result);
+                }
+            }
+#endif
+            return PIKA_ALGORITHMS_LAST_LEVEL_CACHE_SIZE;
+        }();
+        return size;
+    }
+}    // namespace pika::parallel::detail
+
+namespace pika::execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Executor parameters type which makes \a copy, \a copy_n, \a move,
+    /// \a fill, \a fill_n, \a uninitialized_fill, \a uninitialized_fill_n,
+    /// \a transform, \a generate and \a generate_n write their output with
+    /// non-temporal (streaming) stores, bypassing the caches. This avoids
+    /// reading the destination into the caches before overwriting it and
+    /// keeps large outputs which are not read again soon from evicting
+    /// other data.
+    ///
+    /// Streaming stores are used for outputs of at least a given number of
+    /// bytes, which by default is the size of the last level cache. Each
+    /// partition fences its stores before it completes. Outputs which are
+    /// not contiguous or whose elements are not trivially copyable are
+    /// written as usual.
+    ///
+    /// \note This parameter has an effect only on platforms providing
+    ///       streaming store instructions (SSE2).
+    ///
+    struct streaming_stores
+    {
+        /// Use streaming stores for outputs larger than the last level
+        /// cache.
+        streaming_stores() noexcept
+          : min_bytes_(parallel::detail::last_level_cache_size())
+        {
+        }
+
+        /// Use streaming stores for outputs of at least \a min_bytes bytes,
+        /// zero enables them for all outputs.
+        explicit constexpr streaming_stores(std::size_t min_bytes) noexcept
+          : min_bytes_(min_bytes)
+        {
+        }
+
+        /// The number of bytes an output has to consist of at least for
+        /// streaming stores to be used.
+        constexpr std::size_t min_bytes() const noexcept
+        {
+            return min_bytes_;
+        }
+
+    private:
+        std::size_t min_bytes_;
+    };
+}    // namespace pika::execution
+
+namespace pika::parallel::execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<pika::execution::streaming_stores>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace pika::parallel::execution
+
+namespace pika::parallel::detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Streaming stores write whole cache lines, the elements written through
+    // them must not straddle cache line boundaries.
+    inline constexpr std::size_t streaming_store_line_size = 64;
+
+    template <typename Iter, typename T, typename Enable = void>
+    struct supports_streaming_stores : std::false_type
+    {
+    };
+
+    template <typename Iter, typename T>
+    struct supports_streaming_stores<Iter, T,
+        std::enable_if_t<pika::traits::is_contiguous_iterator_v<Iter>>>
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+#if defined(PIKA_ALGORITHMS_HAVE_MM_STREAM)
+        static constexpr bool value =
+            std::is_trivially_copyable_v<value_type> &&
+            std::is_convertible_v<T, value_type> &&
+            streaming_store_line_size % sizeof(value_type) == 0;
+#else
+        static constexpr bool value = false;
+#endif
+    };
+
+    // Values of type T can be written to the sequence referenced by the
+    // iterator Iter with streaming stores.
+    template <typename Iter, typename T>
+    inline constexpr bool supports_streaming_stores_v =
+        supports_streaming_stores<Iter, T>::value;
+
+    // The sequence referenced by the iterator InIter can be copied to the one
+    // referenced by OutIter with streaming stores.
+    template <typename InIter, typename OutIter>
+    inline constexpr bool supports_streaming_copy_v =
+#if defined(PIKA_ALGORITHMS_HAVE_MM_STREAM)
+        std::is_same_v<pika::detail::pointer_copy_category_t<
+                           std::decay_t<InIter>, std::decay_t<OutIter>>,
+            pika::detail::trivially_copyable_pointer_tag>;
+#else
+        false;
+#endif
+
+    // Decides whether an algorithm writes its count elements of output to
+    // the sequence referenced by Iter with streaming stores.
+    template <typename Iter, typename ExPolicy>
+    bool use_streaming_stores(ExPolicy const& policy, std::size_t count)
+    {
+        using parameters_type =
+            typename std::decay_t<ExPolicy>::executor_parameters_type;
+
+        if constexpr (std::is_base_of_v<pika::execution::streaming_stores,
+                          parameters_type>)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            auto const& params =
+                static_cast<pika::execution::streaming_stores const&>(
+                    policy.parameters());
+            return count * sizeof(value_type) >= params.min_bytes();
+        }
+        else
+        {
+            PIKA_UNUSED(policy);
+            PIKA_UNUSED(count);
+            return false;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Copies count elements with streaming stores, the stores are fenced
+    // before returning.
+    template <typename InIter, typename OutIter>
+    in_out_result<InIter, OutIter>
+    streaming_copy_n(InIter first, std::size_t count, OutIter dest)
+    {
+        using value_type = typename std::iterator_traits<InIter>::value_type;
+
+        std::size_t const bytes = count * sizeof(value_type);
+        char const* src = to_const_ptr(first);
+        char* dst = to_ptr(dest);
+
+        std::size_t i = 0;
+#if defined(PIKA_ALGORITHMS_HAVE_MM_STREAM)
+        // copy up to the first 16 byte boundary of the destination
+        auto const address = reinterpret_cast<std::uintptr_t>(dst);
+        i = (std::min)(
+            static_cast<std::size_t>((16 - address % 16) % 16), bytes);
+        std::memcpy(dst, src, i);
+
+        for (/* */; bytes - i >= 64; i += 64)
+        {
+            __m128i const v0 = _mm_loadu_si128((__m128i const*) (src + i));
+            __m128i const v1 = _mm_loadu_si128((__m128i const*) (src + i + 16));
+            __m128i const v2 = _mm_loadu_si128((__m128i const*) (src + i + 32));
+            __m128i const v3 = _mm_loadu_si128((__m128i const*) (src + i + 48));
+            _mm_stream_si128((__m128i*) (dst + i), v0);
+            _mm_stream_si128((__m128i*) (dst + i + 16), v1);
+            _mm_stream_si128((__m128i*) (dst + i + 32), v2);
+            _mm_stream_si128((__m128i*) (dst + i + 48), v3);
+        }
+        for (/* */; bytes - i >= 16; i += 16)
+        {
+            _mm_stream_si128((__m128i*) (dst + i),
+                _mm_loadu_si128((__m128i const*) (src + i)));
+        }
+#endif
+        std::memcpy(dst + i, src + i, bytes - i);
+#if defined(PIKA_ALGORITHMS_HAVE_MM_STREAM)
+        _mm_sfence();
+#endif
+
+        std::advance(first, count);
+        std::advance(dest, count);
+        return in_out_result<InIter, OutIter>{
+            PIKA_MOVE(first), PIKA_MOVE(dest)};
+    }
+
+    // Writes the values returned by count successive invocations of f with
+    // streaming stores, the stores are fenced before returning. The elements
+    // are created by copying the bytes of the values, the destination may be
+    // uninitialized storage.
+    template <typename Iter, typename F>
+    Iter streaming_store_n(Iter dest, std::size_t count, F&& f)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        constexpr std::size_t size = sizeof(value_type);
+
+        auto store = [&f](char* ptr) {
+            value_type const value = f();
+            std::memcpy(ptr, &value, size);
+        };
+
+        char* dst = to_ptr(dest);
+        std::size_t i = 0;
+
+#if defined(PIKA_ALGORITHMS_HAVE_MM_STREAM)
+        constexpr std::size_t line_size = streaming_store_line_size;
+        constexpr std::size_t per_line = line_size / size;
+
+        // only elements aligned to their size fill whole cache lines
+        auto const address = reinterpret_cast<std::uintptr_t>(dst);
+        if (address % size == 0)
+        {
+            // store up to the first cache line boundary as usual
+            std::size_t const head = (std::min)(
+                static_cast<std::size_t>(
+                    (line_size - address % line_size) % line_size / size),
+                count);
+            for (/* */; i != head; ++i)
+            {
+                store(dst + i * size);
+            }
+
+            // assemble every cache line before writing it in one go
+            for (/* */; count - i >= per_line; i += per_line)
+            {
+                alignas(16) char line[line_size];
+                for (std::size_t j = 0; j != per_line; ++j)
+                {
+                    store(line + j * size);
+                }
+
+                char* ptr = dst + i * size;
+                for (std::size_t j = 0; j != line_size; j += 16)
+                {
+                    _mm_stream_si128((__m128i*) (ptr + j),
+                        _mm_load_si128((__m128i const*) (line + j)));
+                }
+            }
+        }
+#endif
+        for (/* */; i != count; ++i)
+        {
+            store(dst + i * size);
+        }
+#if defined(PIKA_ALGORITHMS_HAVE_MM_STREAM)
+        _mm_sfence();
+#endif
+
+        std::advance(dest, count);
+        return dest;
+    }
+
+    // Writes the values returned by count invocations of f to the sequence
+    // starting at dest in parallel, each partition using streaming stores.
+    template <typename ExPolicy, typename Iter, typename F>
+    typename algorithm_result<ExPolicy, Iter>::type streaming_generate_n(
+        ExPolicy&& policy, Iter dest, std::size_t count, F&& f)
+    {
+        return foreach_partitioner<ExPolicy>::call(
+            PIKA_FORWARD(ExPolicy, policy), dest, count,
+            [f = PIKA_FORWARD(F, f)](Iter part_begin, std::size_t part_size,
+                std::size_t) mutable {
+                streaming_store_n(part_begin, part_size, f);
+            },
+            [](Iter&& last) -> Iter { return PIKA_MOVE(last); });
+    }
+}    // namespace pika::parallel::detail
@@ -11,6 +11,7 @@
 #include <pika/functional/detail/invoke.hpp>
 #include <pika/parallel/util/cancellation_token.hpp>
 #include <pika/parallel/util/result_types.hpp>
+#include <pika/type_support/pack.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -645,4 +646,148 @@ namespace pika::parallel::detail {
             first1, count, first2, dest, PIKA_FORWARD(F, f));
     }
 #endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Invokes f with each of the count elements starting at it and writes the
+    // elements of the tuple it returns to the corresponding output iterators,
+    // returns the end of the input and the ends of the outputs.
+    template <typename Iter, typename... OutIter>
+    struct transform_n_out_loop_n_impl
+    {
+        template <typename F, std::size_t... Is>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static constexpr std::pair<Iter,
+            std::tuple<OutIter...>>
+        call(Iter it, std::size_t count, std::tuple<OutIter...> dests, F&& f,
+            pika::util::detail::index_pack<Is...>)
+        {
+            for (/**/; count != 0; (void) --count, ++it)
+            {
+                auto&& values = PIKA_INVOKE(f, *it);
+                ((*std::get<Is>(dests) = std::get<Is>(
+                      PIKA_FORWARD(decltype(values), values)),
+                     ++std::get<Is>(dests)),
+                    ...);
+            }
+
+            return std::make_pair(PIKA_MOVE(it), PIKA_MOVE(dests));
+        }
+
+        // Same as above for the elements in [it, last), the input is read in
+        // a single pass.
+        template <typename Sent, typename F, std::size_t... Is>
+        PIKA_HOST_DEVICE PIKA_FORCEINLINE static constexpr std::pair<Iter,
+            std::tuple<OutIter...>>
+        call_sentinel(Iter it, Sent last, std::tuple<OutIter...> dests, F&& f,
+            pika::util::detail::index_pack<Is...>)
+        {
+            for (/**/; it != last; ++it)
+            {
+                auto&& values = PIKA_INVOKE(f, *it);
+                ((*std::get<Is>(dests) = std::get<Is>(
+                      PIKA_FORWARD(decltype(values), values)),
+                     ++std::get<Is>(dests)),
+                    ...);
+            }
+
+            return std::make_pair(PIKA_MOVE(it), PIKA_MOVE(dests));
+        }
+    };
+
+    template <typename ExPolicy>
+    struct transform_n_out_loop_n_t final
+      : pika::functional::detail::tag_fallback<
+            transform_n_out_loop_n_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename... OutIter, typename F>
+        friend PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr std::pair<Iter,
+            std::tuple<OutIter...>>
+        tag_fallback_invoke(transform_n_out_loop_n_t<ExPolicy>, Iter it,
+            std::size_t count, std::tuple<OutIter...> dests, F&& f)
+        {
+            return transform_n_out_loop_n_impl<Iter, OutIter...>::call(it,
+                count, PIKA_MOVE(dests), PIKA_FORWARD(F, f),
+                pika::util::detail::make_index_pack_t<sizeof...(OutIter)>());
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr transform_n_out_loop_n_t<ExPolicy>
+        transform_n_out_loop_n = transform_n_out_loop_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename... OutIter,
+        typename F>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr std::pair<Iter,
+        std::tuple<OutIter...>>
+    transform_n_out_loop_n(
+        Iter it, std::size_t count, std::tuple<OutIter...> dests, F&& f)
+    {
+        return transform_n_out_loop_n_t<ExPolicy>{}(
+            it, count, PIKA_MOVE(dests), PIKA_FORWARD(F, f));
+    }
+#endif
+
+    template <typename Iter, typename Sent, typename... OutIter, typename F>
+    constexpr std::pair<Iter, std::tuple<OutIter...>> transform_n_out_loop(
+        Iter it, Sent last, std::tuple<OutIter...> dests, F&& f)
+    {
+        return transform_n_out_loop_n_impl<Iter, OutIter...>::call_sentinel(
+            it, last, PIKA_MOVE(dests), PIKA_FORWARD(F, f),
+            pika::util::detail::make_index_pack_t<sizeof...(OutIter)>());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The neighborhood a stencil function is invoked with, subscripting it
+    // with an offset k yields the element k positions away from the current
+    // one.
+    template <typename Iter>
+    struct stencil_neighborhood
+    {
+        PIKA_HOST_DEVICE constexpr decltype(auto) operator[](
+            std::ptrdiff_t k) const
+        {
+            return *std::next(it, k);
+        }
+
+        Iter it;
+    };
+
+    // Invokes f with the neighborhoods of each of the count elements starting
+    // at it and writes the results to dest, returns the end of the input and
+    // the end of the output. The caller makes sure that all neighbors f
+    // accesses are valid.
+    template <typename ExPolicy>
+    struct stencil_transform_loop_n_t final
+      : pika::functional::detail::tag_fallback<
+            stencil_transform_loop_n_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename OutIter, typename F>
+        friend PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr std::pair<Iter,
+            OutIter>
+        tag_fallback_invoke(stencil_transform_loop_n_t<ExPolicy>, Iter it,
+            std::size_t count, OutIter dest, F&& f)
+        {
+            for (/**/; count != 0; (void) --count, ++it, ++dest)
+            {
+                *dest = PIKA_INVOKE(f, stencil_neighborhood<Iter>{it});
+            }
+            return std::make_pair(PIKA_MOVE(it), PIKA_MOVE(dest));
+        }
+    };
+
+#if !defined(PIKA_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr stencil_transform_loop_n_t<ExPolicy>
+        stencil_transform_loop_n = stencil_transform_loop_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename OutIter, typename F>
+    PIKA_HOST_DEVICE PIKA_FORCEINLINE constexpr std::pair<Iter, OutIter>
+    stencil_transform_loop_n(Iter it, std::size_t count, OutIter dest, F&& f)
+    {
+        return stencil_transform_loop_n_t<ExPolicy>{}(
+            it, count, dest, PIKA_FORWARD(F, f));
+    }
+#endif
 }    // namespace pika::parallel::detail
@@ -21,7 +21,11 @@ namespace pika::parallel::traits::detail {
 #if defined(PIKA_ALGORITHMS_HAVE_DATAPAR)
 
 #if !defined(__CUDACC__)
+#if defined(PIKA_ALGORITHMS_HAVE_BUILTIN_SIMD)
+#include <pika/parallel/util/detail/builtin/vector_pack_count_bits.hpp>
+#else
 #include <pika/parallel/util/detail/simd/vector_pack_count_bits.hpp>
 #endif
+#endif
 
 #endif
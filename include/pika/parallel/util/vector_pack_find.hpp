@@ -11,7 +11,11 @@
 #if defined(PIKA_ALGORITHMS_HAVE_DATAPAR)
 
 #if !defined(__CUDACC__)
+#if defined(PIKA_ALGORITHMS_HAVE_BUILTIN_SIMD)
+#include <pika/parallel/util/detail/builtin/vector_pack_find.hpp>
+#else
 #include <pika/parallel/util/detail/simd/vector_pack_find.hpp>
 #endif
+#endif
 
 #endif
@@ -32,7 +32,11 @@ namespace pika::parallel::traits::detail {
 }    // namespace pika::parallel::traits::detail
 
 #if !defined(__CUDACC__)
+#if defined(PIKA_ALGORITHMS_HAVE_BUILTIN_SIMD)
+#include <pika/parallel/util/detail/builtin/vector_pack_type.hpp>
+#else
 #include <pika/parallel/util/detail/simd/vector_pack_type.hpp>
 #endif
+#endif
 
 #endif
@@ -317,8 +317,10 @@ std::vector<std::vector<std::chrono::duration<double>>>
 run_benchmark(std::size_t warmup_iterations, std::size_t iterations,
     std::size_t size, Policy&& policy)
 {
-    // Allocate our data
-    using vector_type = std::vector<STREAM_TYPE>;
+    // Allocate our data, leaving the placement of the pages to the parallel
+    // initialization below
+    using vector_type = std::vector<STREAM_TYPE,
+        pika::execution::first_touch_allocator<STREAM_TYPE>>;
 
     vector_type a(size);
     vector_type b(size);
@@ -454,6 +456,35 @@ run_benchmark(std::size_t warmup_iterations, std::size_t iterations,
     return timing;
 }
 
+// Runs the benchmark writing all outputs larger than the last level cache
+// with non-temporal stores and running each part of the arrays on the NUMA
+// domain it was placed on, if requested.
+template <typename Policy>
+std::vector<std::vector<std::chrono::duration<double>>>
+run_benchmark(std::size_t warmup_iterations, std::size_t iterations,
+    std::size_t size, Policy&& policy, bool streaming_stores,
+    bool numa_affinity)
+{
+    if (streaming_stores && numa_affinity)
+    {
+        return run_benchmark(warmup_iterations, iterations, size,
+            policy.with(pika::execution::streaming_stores(),
+                pika::execution::numa_affinity()));
+    }
+    if (streaming_stores)
+    {
+        return run_benchmark(warmup_iterations, iterations, size,
+            policy.with(pika::execution::streaming_stores()));
+    }
+    if (numa_affinity)
+    {
+        return run_benchmark(warmup_iterations, iterations, size,
+            policy.with(pika::execution::numa_affinity()));
+    }
+    return run_benchmark(
+        warmup_iterations, iterations, size, PIKA_FORWARD(Policy, policy));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int pika_main(pika::program_options::variables_map& vm)
 {
@@ -463,6 +494,8 @@ int pika_main(pika::program_options::variables_map& vm)
     std::size_t warmup_iterations = vm["warmup_iterations"].as<std::size_t>();
     std::size_t chunk_size = vm["chunk_size"].as<std::size_t>();
     std::size_t executor = vm["executor"].as<std::size_t>();
+    bool streaming_stores = vm.count("streaming_stores") > 0;
+    bool numa_affinity = vm.count("numa_affinity") > 0;
     csv = vm.count("csv") > 0;
     header = vm.count("header") > 0;
 
@@ -508,6 +541,8 @@ int pika_main(pika::program_options::variables_map& vm)
                 << pika::get_os_thread_count() << "\n"
             << "Chunking policy requested: " << chunker << "\n"
             << "Executor requested: " << executor << "\n"
+            << "Streaming stores: " << (streaming_stores ? "yes" : "no") << "\n"
+            << "NUMA affinity: " << (numa_affinity ? "yes" : "no") << "\n"
             << "-------------------------------------------------------------\n"
             ;
     }
@@ -520,8 +555,8 @@ int pika_main(pika::program_options::variables_map& vm)
     if (executor == 0)
     {
         // Default parallel policy with serial allocator.
-        timing = run_benchmark<>(
-            warmup_iterations, iterations, vector_size, pika::execution::par);
+        timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
+            pika::execution::par, streaming_stores, numa_affinity);
     }
     else if (executor == 1)
     {
@@ -530,8 +565,8 @@ int pika_main(pika::program_options::variables_map& vm)
 
         executor_type exec;
         auto policy = pika::execution::par.on(exec);
-        timing = run_benchmark<>(
-            warmup_iterations, iterations, vector_size, std::move(policy));
+        timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
+            std::move(policy), streaming_stores, numa_affinity);
     }
     else if (executor == 2)
     {
@@ -541,8 +576,8 @@ int pika_main(pika::program_options::variables_map& vm)
 
         executor_type exec;
         auto policy = pika::execution::par.on(exec);
-        timing = run_benchmark<>(
-            warmup_iterations, iterations, vector_size, std::move(policy));
+        timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
+            std::move(policy), streaming_stores, numa_affinity);
     }
     else
     {
@@ -679,6 +714,12 @@ int main(int argc, char* argv[])
         (   "executor",
             pika::program_options::value<std::size_t>()->default_value(2),
             "executor to use (0-2) (default: 0, parallel_executor)")
+        (   "streaming_stores",
+            "write outputs larger than the last level cache using "
+            "non-temporal stores")
+        (   "numa_affinity",
+            "run each part of the arrays on the NUMA domain it was placed on "
+            "when initializing them")
         ;
     // clang-format on
 
@@ -161,6 +161,56 @@ void test_for_loop_reduction_bit_or_idx(ExPolicy&& policy)
     PIKA_TEST_EQ(bits, bits2);
 }
 
+// accumulates per-bin sums into an array, for few and for many bins
+template <typename ExPolicy>
+void test_for_loop_reduction_span_idx(ExPolicy&& policy, std::size_t nbins)
+{
+    static_assert(pika::is_execution_policy<ExPolicy>::value,
+        "pika::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> c(100007);
+    std::iota(std::begin(c), std::end(c), gen());
+
+    std::vector<std::size_t> sums(nbins, 1);
+    pika::for_loop(std::forward<ExPolicy>(policy), 0, c.size(),
+        pika::reduction_span(sums, std::size_t(0), std::plus<std::size_t>()),
+        [&c, nbins](std::size_t i, std::size_t* sums) {
+            sums[c[i] % nbins] += c[i];
+        });
+
+    // verify values
+    std::vector<std::size_t> sums2(nbins, 1);
+    for (std::size_t v : c)
+    {
+        sums2[v % nbins] += v;
+    }
+    PIKA_TEST(sums == sums2);
+}
+
+template <typename ExPolicy>
+void test_for_loop_reduction_span_idx_async(
+    ExPolicy&& policy, std::size_t nbins)
+{
+    std::vector<std::size_t> c(100007);
+    std::iota(std::begin(c), std::end(c), gen());
+
+    std::vector<std::size_t> sums(nbins, 1);
+    auto f = pika::for_loop(std::forward<ExPolicy>(policy), 0, c.size(),
+        pika::reduction_span(sums, std::size_t(0), std::plus<std::size_t>()),
+        [&c, nbins](std::size_t i, std::size_t* sums) {
+            sums[c[i] % nbins] += c[i];
+        });
+    f.wait();
+
+    // verify values
+    std::vector<std::size_t> sums2(nbins, 1);
+    for (std::size_t v : c)
+    {
+        sums2[v % nbins] += v;
+    }
+    PIKA_TEST(sums == sums2);
+}
+
 void for_loop_reduction_test_idx()
 {
     using namespace pika::execution;
@@ -172,6 +222,18 @@ void for_loop_reduction_test_idx()
     test_for_loop_reduction_bit_or_idx(seq);
     test_for_loop_reduction_bit_or_idx(par);
     test_for_loop_reduction_bit_or_idx(par_unseq);
+
+    for (std::size_t nbins : {1, 17, 100003})
+    {
+        test_for_loop_reduction_span_idx(seq, nbins);
+        test_for_loop_reduction_span_idx(par, nbins);
+        test_for_loop_reduction_span_idx(par_unseq, nbins);
+        test_for_loop_reduction_span_idx(
+            par.with(static_chunk_size(1000)), nbins);
+
+        test_for_loop_reduction_span_idx_async(seq(task), nbins);
+        test_for_loop_reduction_span_idx_async(par(task), nbins);
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
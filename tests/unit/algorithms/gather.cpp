@@ -0,0 +1,247 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/gather.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+auto const is_odd = [](int v) { return v % 2 != 0; };
+
+template <typename ExPolicy>
+void test_gather(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<int> src(size + 10);
+    std::iota(src.begin(), src.end(), int(gen() % 1000));
+
+    // the indices may repeat
+    std::vector<std::size_t> map(size);
+    for (std::size_t& i : map)
+    {
+        i = gen() % src.size();
+    }
+
+    std::vector<int> stencil(size);
+    for (int& s : stencil)
+    {
+        s = int(gen() % 2);
+    }
+
+    {
+        std::vector<int> d(size);
+        auto result = pika::gather(
+            policy, map.begin(), map.end(), src.begin(), d.begin());
+        PIKA_TEST(result == d.end());
+
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            PIKA_TEST_EQ(d[i], src[map[i]]);
+        }
+    }
+    {
+        std::vector<int> d(size, -1);
+        auto result = pika::gather_if(policy, map.begin(), map.end(),
+            stencil.begin(), src.begin(), d.begin(), is_odd);
+        PIKA_TEST(result == d.end());
+
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            PIKA_TEST_EQ(d[i], stencil[i] != 0 ? src[map[i]] : -1);
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_scatter(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<int> c(size);
+    std::iota(c.begin(), c.end(), int(gen() % 1000));
+
+    // the indices are unique, the output is larger than the input
+    std::vector<std::size_t> map(4 * size);
+    std::iota(map.begin(), map.end(), 0);
+    std::shuffle(map.begin(), map.end(), gen);
+    map.resize(size);
+
+    std::vector<int> stencil(size);
+    for (int& s : stencil)
+    {
+        s = int(gen() % 2);
+    }
+
+    {
+        std::vector<int> d(4 * size, -1);
+        auto result =
+            pika::scatter(policy, c.begin(), c.end(), map.begin(), d.begin());
+        PIKA_TEST(result == c.end());
+
+        std::vector<int> expected(4 * size, -1);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            expected[map[i]] = c[i];
+        }
+        PIKA_TEST(d == expected);
+    }
+    {
+        std::vector<int> d(4 * size, -1);
+        auto result = pika::scatter_if(policy, c.begin(), c.end(), map.begin(),
+            stencil.begin(), d.begin(), is_odd);
+        PIKA_TEST(result == c.end());
+
+        std::vector<int> expected(4 * size, -1);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            if (stencil[i] != 0)
+            {
+                expected[map[i]] = c[i];
+            }
+        }
+        PIKA_TEST(d == expected);
+    }
+}
+
+template <typename ExPolicy>
+void test_gather_scatter_async(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<double> src(size);
+    std::iota(src.begin(), src.end(), 0.0);
+
+    std::vector<std::size_t> map(size);
+    std::iota(map.begin(), map.end(), 0);
+    std::shuffle(map.begin(), map.end(), gen);
+
+    std::vector<double> d(size);
+    auto f =
+        pika::gather(policy, map.begin(), map.end(), src.begin(), d.begin());
+    PIKA_TEST(f.get() == d.end());
+
+    // scattering the gathered elements to the same indices restores them
+    std::vector<double> e(size);
+    auto g = pika::scatter(policy, d.begin(), d.end(), map.begin(), e.begin());
+    PIKA_TEST(g.get() == d.end());
+    PIKA_TEST(e == src);
+}
+
+// sequences which are not random access and the elements of a page being
+// written to in order of their positions with blocked_scatter
+void test_gather_scatter_forward()
+{
+    using namespace pika::execution;
+
+    std::size_t const size = 10007;
+
+    std::list<std::size_t> map;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        map.push_back(gen() % 100);
+    }
+
+    std::vector<int> src(100);
+    std::iota(src.begin(), src.end(), 0);
+
+    std::list<int> d(size);
+    auto result =
+        pika::gather(par, map.begin(), map.end(), src.begin(), d.begin());
+    PIKA_TEST(result == d.end());
+    PIKA_TEST(std::equal(d.begin(), d.end(), map.begin(), map.end(),
+        [](int v, std::size_t i) { return std::size_t(v) == i; }));
+
+    std::vector<int> c(size);
+    std::iota(c.begin(), c.end(), 0);
+    std::vector<std::size_t> dup(map.begin(), map.end());
+
+    std::vector<int> e(100, -1);
+    pika::scatter(seq.with(blocked_scatter(64)), c.begin(), c.end(),
+        dup.begin(), e.begin());
+
+    std::vector<int> expected(100, -1);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        expected[dup[i]] = c[i];
+    }
+    PIKA_TEST(e == expected);
+}
+
+void test_gather_scatter()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {1, 7, 1000, 100007})
+    {
+        test_gather(seq, size);
+        test_gather(par, size);
+        test_gather(par_unseq, size);
+
+        test_scatter(seq, size);
+        test_scatter(par, size);
+        test_scatter(par_unseq, size);
+
+        // the pages the writes are grouped by do not need to match those of
+        // the system
+        for (std::size_t page_size : {1, 64, 4096})
+        {
+            test_scatter(seq.with(blocked_scatter(page_size)), size);
+            test_scatter(par.with(blocked_scatter(page_size)), size);
+        }
+        test_scatter(par.with(blocked_scatter()), size);
+
+        test_gather_scatter_async(par(task), size);
+        test_gather_scatter_async(par(task).with(blocked_scatter()), size);
+    }
+
+    test_gather_scatter_forward();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_gather_scatter();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,208 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/histogram.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+// The keys are drawn from a range exceeding the bins on both sides, keys
+// outside of the bins must not be counted.
+template <typename ExPolicy>
+void test_histogram(ExPolicy&& policy, std::size_t size, std::size_t nbins)
+{
+    std::uniform_int_distribution<int> dist(-3, int(nbins) + 3);
+
+    std::vector<int> c(size);
+    std::vector<std::size_t> expected(nbins, 0);
+    for (int& v : c)
+    {
+        v = dist(gen);
+        if (v >= 0 && std::size_t(v) < nbins)
+        {
+            ++expected[v];
+        }
+    }
+
+    std::vector<std::size_t> bins(nbins, 42);
+    auto result =
+        pika::histogram(policy, c.begin(), c.end(), bins.begin(), bins.end());
+
+    PIKA_TEST(result == bins.end());
+    PIKA_TEST(bins == expected);
+}
+
+template <typename ExPolicy>
+void test_histogram(ExPolicy&& policy)
+{
+    // small numbers of bins are counted per worker, large numbers of bins
+    // are collected sparsely
+    for (std::size_t size : {0, 1, 1007, 100007})
+    {
+        for (std::size_t nbins : {1, 17, 10007, 1000007})
+        {
+            test_histogram(policy, size, nbins);
+        }
+    }
+}
+
+// Unsigned 8 and 16 bit keys are counted into interleaved sub-histograms,
+// check them for sizes which are not a multiple of the number of
+// sub-histograms and for fewer as well as more bins than there are keys.
+template <typename T, typename ExPolicy>
+void test_histogram_small_keys(ExPolicy&& policy)
+{
+    for (std::size_t size : {7, 1003, 300007})
+    {
+        for (std::size_t nbins : {1, 256, 65536, 70000})
+        {
+            std::vector<T> c(size);
+            std::vector<std::size_t> expected(nbins, 0);
+            for (T& v : c)
+            {
+                v = T(gen());
+                if (v < nbins)
+                {
+                    ++expected[v];
+                }
+            }
+
+            std::vector<std::size_t> bins(nbins, 42);
+            auto result = pika::histogram(
+                policy, c.begin(), c.end(), bins.begin(), bins.end());
+
+            PIKA_TEST(result == bins.end());
+            PIKA_TEST(bins == expected);
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_histogram_key_fn(ExPolicy&& policy)
+{
+    std::size_t const size = 10007;
+
+    std::vector<std::string> c(size);
+    std::vector<long> expected(8, 0);
+    for (std::string& s : c)
+    {
+        s = std::string(gen() % 10, 'x');
+        if (s.size() < expected.size())
+        {
+            ++expected[s.size()];
+        }
+    }
+
+    // the bins do not have to be random access
+    std::list<long> bins(expected.size(), -1);
+    auto result = pika::histogram(policy, c.begin(), c.end(), bins.begin(),
+        bins.end(), [](std::string const& s) { return s.size(); });
+
+    PIKA_TEST(result == bins.end());
+    PIKA_TEST(std::vector<long>(bins.begin(), bins.end()) == expected);
+}
+
+template <typename ExPolicy>
+void test_histogram_async(ExPolicy&& policy)
+{
+    std::size_t const size = 10007;
+
+    std::vector<int> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = int(i % 7);
+    }
+
+    std::vector<std::size_t> bins(7);
+    auto f =
+        pika::histogram(policy, c.begin(), c.end(), bins.begin(), bins.end());
+    PIKA_TEST(f.get() == bins.end());
+
+    for (std::size_t i = 0; i != bins.size(); ++i)
+    {
+        PIKA_TEST_EQ(bins[i], size / 7 + (i < size % 7 ? 1 : 0));
+    }
+}
+
+void test_histogram()
+{
+    using namespace pika::execution;
+
+    {
+        std::vector<int> c = {0, 1, 1, 3, 3, 3, 7};
+        std::vector<int> bins(4);
+        auto result = pika::histogram(c.begin(), c.end(), bins.begin(),
+            bins.end(), [](int v) { return v; });
+        PIKA_TEST(result == bins.end());
+        PIKA_TEST(bins == std::vector<int>({1, 2, 0, 3}));
+    }
+
+    test_histogram(seq);
+    test_histogram(par);
+    test_histogram(par_unseq);
+
+    test_histogram_small_keys<std::uint8_t>(seq);
+    test_histogram_small_keys<std::uint8_t>(par);
+    test_histogram_small_keys<std::uint16_t>(seq);
+    test_histogram_small_keys<std::uint16_t>(par);
+
+    test_histogram_key_fn(seq);
+    test_histogram_key_fn(par);
+
+    test_histogram_async(seq(task));
+    test_histogram_async(par(task));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_histogram();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
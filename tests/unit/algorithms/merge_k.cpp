@@ -0,0 +1,223 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/iterator_support/iterator_range.hpp>
+#include <pika/parallel/algorithms/merge_k.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+struct element
+{
+    int key;
+    std::size_t run;
+    std::size_t pos;
+};
+
+// Creates nruns sorted runs of random length, the keys are drawn from
+// [0, nkeys), which for small nkeys creates many equivalent elements within
+// and across the runs.
+std::vector<std::vector<element>> make_runs(
+    std::size_t nruns, std::size_t max_size, int nkeys)
+{
+    std::uniform_int_distribution<int> dist(0, nkeys - 1);
+
+    std::vector<std::vector<element>> runs(nruns);
+    for (std::size_t r = 0; r != nruns; ++r)
+    {
+        std::size_t const size = gen() % (max_size + 1);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            runs[r].push_back(element{dist(gen), r, 0});
+        }
+        std::stable_sort(runs[r].begin(), runs[r].end(),
+            [](element const& lhs, element const& rhs) {
+                return lhs.key < rhs.key;
+            });
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            runs[r][i].pos = i;
+        }
+    }
+    return runs;
+}
+
+// The merge has to be stable: equivalent elements are ordered by their run
+// and then by their position in it.
+void verify_merged(std::vector<element> const& merged)
+{
+    bool sorted = std::is_sorted(merged.begin(), merged.end(),
+        [](element const& lhs, element const& rhs) {
+            if (lhs.key != rhs.key)
+            {
+                return lhs.key < rhs.key;
+            }
+            if (lhs.run != rhs.run)
+            {
+                return lhs.run < rhs.run;
+            }
+            return lhs.pos < rhs.pos;
+        });
+    PIKA_TEST(sorted);
+}
+
+template <typename ExPolicy>
+void test_merge_k(
+    ExPolicy&& policy, std::size_t nruns, std::size_t max_size, int nkeys)
+{
+    std::vector<std::vector<element>> runs = make_runs(nruns, max_size, nkeys);
+
+    std::size_t count = 0;
+    for (auto const& run : runs)
+    {
+        count += run.size();
+    }
+
+    std::vector<element> merged(count);
+    auto result = pika::merge_k(policy, runs.begin(), runs.end(),
+        merged.begin(), std::less<int>(),
+        [](element const& e) { return e.key; });
+
+    PIKA_TEST(result == merged.end());
+    verify_merged(merged);
+}
+
+template <typename ExPolicy>
+void test_merge_k(ExPolicy&& policy)
+{
+    for (std::size_t nruns : {0, 1, 2, 7, 64, 1024})
+    {
+        for (int nkeys : {1, 100, 1000000})
+        {
+            test_merge_k(policy, nruns, 2000000 / (nruns + 1), nkeys);
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_merge_k_ranges(ExPolicy&& policy)
+{
+    // the runs may be any ranges, here parts of one sequence
+    std::vector<int> c(100007);
+    for (int& v : c)
+    {
+        v = int(gen() % 1000);
+    }
+
+    std::vector<pika::util::iterator_range<std::vector<int>::iterator>> runs;
+    for (std::size_t first = 0; first != c.size();)
+    {
+        std::size_t const last = (std::min)(c.size(), first + gen() % 4096);
+        std::sort(c.begin() + first, c.begin() + last, std::greater<int>());
+        runs.push_back(pika::util::make_iterator_range(
+            c.begin() + first, c.begin() + last));
+        first = last;
+    }
+
+    std::list<decltype(runs)::value_type> run_list(runs.begin(), runs.end());
+
+    std::vector<int> merged(c.size());
+    auto result = pika::merge_k(policy, run_list.begin(), run_list.end(),
+        merged.begin(), std::greater<int>());
+
+    std::sort(c.begin(), c.end(), std::greater<int>());
+    PIKA_TEST(result == merged.end());
+    PIKA_TEST(merged == c);
+}
+
+template <typename ExPolicy>
+void test_merge_k_async(ExPolicy&& policy)
+{
+    std::vector<std::vector<element>> runs = make_runs(64, 10000, 100);
+
+    std::size_t count = 0;
+    for (auto const& run : runs)
+    {
+        count += run.size();
+    }
+
+    std::vector<element> merged(count);
+    auto f = pika::merge_k(policy, runs.begin(), runs.end(), merged.begin(),
+        std::less<int>(), [](element const& e) { return e.key; });
+    PIKA_TEST(f.get() == merged.end());
+
+    verify_merged(merged);
+}
+
+void test_merge_k()
+{
+    using namespace pika::execution;
+
+    {
+        std::vector<std::vector<int>> runs = {{1, 4, 9}, {}, {2, 3, 10}, {0}};
+        std::vector<int> merged(7);
+        auto result = pika::merge_k(runs.begin(), runs.end(), merged.begin());
+        PIKA_TEST(result == merged.end());
+        PIKA_TEST(merged == std::vector<int>({0, 1, 2, 3, 4, 9, 10}));
+    }
+
+    test_merge_k(seq);
+    test_merge_k(par);
+    test_merge_k(par_unseq);
+
+    test_merge_k_ranges(seq);
+    test_merge_k_ranges(par);
+
+    test_merge_k_async(seq(task));
+    test_merge_k_async(par(task));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_merge_k();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/copy.hpp>
+#include <pika/parallel/algorithms/fill.hpp>
+#include <pika/parallel/algorithms/for_loop.hpp>
+#include <pika/parallel/algorithms/reduce.hpp>
+#include <pika/parallel/algorithms/transform.hpp>
+#include <pika/parallel/algorithms/uninitialized_value_construct.hpp>
+#include <pika/parallel/util/numa_affinity.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+template <typename T>
+using vector_type =
+    std::vector<T, pika::execution::first_touch_allocator<T>>;
+
+template <typename ExPolicy>
+void test_numa_affinity(ExPolicy&& policy, std::size_t size)
+{
+    vector_type<double> a(size);
+    vector_type<double> b(size);
+
+    pika::uninitialized_value_construct(policy, a.begin(), a.end());
+    PIKA_TEST_EQ(std::accumulate(a.begin(), a.end(), 0.0), 0.0);
+
+    pika::fill(policy, b.begin(), b.end(), 1.0);
+    pika::for_loop(policy, std::size_t(0), size,
+        [&](std::size_t i) { a[i] = double(i); });
+
+    auto result = pika::transform(policy, a.begin(), a.end(), b.begin(),
+        b.begin(), [](double x, double y) { return x + y; });
+    PIKA_TEST(result == b.end());
+
+    result = pika::copy(policy, b.begin(), b.end(), a.begin());
+    PIKA_TEST(result == a.end());
+
+    double sum = pika::reduce(policy, a.begin(), a.end(), 0.0);
+    PIKA_TEST_EQ(sum, double(size) * double(size + 1) / 2);
+}
+
+template <typename ExPolicy>
+void test_numa_affinity_async(ExPolicy&& policy, std::size_t size)
+{
+    vector_type<int> c(size);
+
+    auto f = pika::fill(policy, c.begin(), c.end(), 1);
+    f.get();
+
+    auto g = pika::reduce(policy, c.begin(), c.end(), 0);
+    PIKA_TEST_EQ(g.get(), int(size));
+}
+
+void test_numa_affinity()
+{
+    using namespace pika::execution;
+
+    // the domain of each element depends only on its position
+    {
+        numa_affinity params(4);
+        PIKA_TEST_EQ(params.domains(), std::size_t(4));
+        PIKA_TEST_EQ(params.domain(0, 10), std::size_t(0));
+        PIKA_TEST_EQ(params.domain(2, 10), std::size_t(0));
+        PIKA_TEST_EQ(params.domain(3, 10), std::size_t(1));
+        PIKA_TEST_EQ(params.domain(9, 10), std::size_t(3));
+        PIKA_TEST_EQ(numa_affinity(0).domains(), std::size_t(1));
+        PIKA_TEST_LTE(std::size_t(1), numa_affinity().domains());
+    }
+
+    // the hints are only scheduling suggestions, any number of domains works
+    // on any system
+    for (std::size_t domains : {1, 2, 3, 64})
+    {
+        for (std::size_t size : {1, 7, 1000, 100007})
+        {
+            test_numa_affinity(par.with(numa_affinity(domains)), size);
+            test_numa_affinity(par_unseq.with(numa_affinity(domains)), size);
+        }
+        test_numa_affinity_async(
+            par(task).with(numa_affinity(domains)), 100007);
+    }
+
+    test_numa_affinity(par.with(numa_affinity()), 100007);
+    test_numa_affinity(
+        par.with(numa_affinity(), static_chunk_size(gen() % 1000 + 1)),
+        100007);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_numa_affinity();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
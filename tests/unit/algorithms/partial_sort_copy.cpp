@@ -15,10 +15,14 @@
 #include <pika/testing.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <iterator>
 #include <list>
+#include <numeric>
 #include <random>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -484,6 +488,38 @@ void partial_sort_test3()
     test_partial_sort_copy3<std::forward_iterator_tag>();
 }
 
+////////////////////////////////////////////////////////////////////////////
+// A stream iterator can be read only once, the input has to be collected
+// in a single pass.
+void partial_sort_test_input_iterator()
+{
+    std::vector<std::uint64_t> c(1000);
+    std::iota(c.begin(), c.end(), std::uint64_t(0));
+    std::shuffle(c.begin(), c.end(), gen);
+
+    std::ostringstream os;
+    for (std::uint64_t x : c)
+        os << x << ' ';
+
+    for (std::size_t n : {std::size_t(10), c.size(), c.size() + 10})
+    {
+        std::vector<std::uint64_t> d1(n, 999), d2(n, 999);
+
+        std::istringstream is1(os.str());
+        auto r1 = pika::partial_sort_copy(
+            std::istream_iterator<std::uint64_t>(is1),
+            std::istream_iterator<std::uint64_t>(), d1.begin(), d1.end());
+
+        std::istringstream is2(os.str());
+        auto r2 = std::partial_sort_copy(
+            std::istream_iterator<std::uint64_t>(is2),
+            std::istream_iterator<std::uint64_t>(), d2.begin(), d2.end());
+
+        PIKA_TEST(r1 - d1.begin() == r2 - d2.begin());
+        PIKA_TEST(d1 == d2);
+    }
+}
+
 int pika_main(pika::program_options::variables_map& vm)
 {
     if (vm.count("seed"))
@@ -495,6 +531,7 @@ int pika_main(pika::program_options::variables_map& vm)
     partial_sort_test1();
     partial_sort_test2();
     partial_sort_test3();
+    partial_sort_test_input_iterator();
 
     return pika::finalize();
 }
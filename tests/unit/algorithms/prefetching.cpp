@@ -0,0 +1,220 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/copy.hpp>
+#include <pika/parallel/algorithms/for_each.hpp>
+#include <pika/parallel/algorithms/for_loop.hpp>
+#include <pika/parallel/algorithms/transform.hpp>
+#include <pika/parallel/algorithms/transform_reduce.hpp>
+#include <pika/parallel/util/prefetching.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+// The base iterators of the prefetcher contexts refer to the indices of the
+// elements of the ranges, in direct mode these are consecutive, in indirect
+// mode (gathers) they are in random order.
+template <typename ExPolicy, typename Context>
+void test_prefetching(ExPolicy&& policy, Context ctx,
+    std::vector<std::size_t> const& idx, std::vector<double> const& c)
+{
+    std::size_t const size = idx.size();
+
+    {
+        std::vector<double> d(size);
+        auto result = pika::transform(policy, ctx.begin(), ctx.end(),
+            d.begin(), [&](std::size_t i) { return 2 * c[i]; });
+        PIKA_TEST(result == d.end());
+
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            PIKA_TEST_EQ(d[i], 2 * c[idx[i]]);
+        }
+    }
+    {
+        // the output needs to be a forward iterator only
+        std::list<double> d(size);
+        auto result = pika::transform(policy, ctx.begin(), ctx.end(),
+            d.begin(), [&](std::size_t i) { return c[i]; });
+        PIKA_TEST(result == d.end());
+
+        auto it = d.begin();
+        for (std::size_t i = 0; i != size; ++i, ++it)
+        {
+            PIKA_TEST_EQ(*it, c[idx[i]]);
+        }
+    }
+    {
+        std::vector<std::size_t> d(size);
+        auto result = pika::copy(policy, ctx.begin(), ctx.end(), d.begin());
+        PIKA_TEST(result == d.end());
+        PIKA_TEST(d == idx);
+    }
+    {
+        double sum = pika::transform_reduce(policy, ctx.begin(), ctx.end(),
+            0.0, std::plus<double>(), [&](std::size_t i) { return c[i]; });
+
+        double expected = 0.0;
+        for (std::size_t i : idx)
+        {
+            expected += c[i];
+        }
+        PIKA_TEST_EQ(sum, expected);
+    }
+    {
+        std::vector<double> d(c.size(), 0.0);
+        pika::for_loop(policy, ctx.begin(), ctx.end(),
+            [&](auto it) { d[*it] = c[*it]; });
+
+        std::vector<double> expected(c.size(), 0.0);
+        for (std::size_t i : idx)
+        {
+            expected[i] = c[i];
+        }
+        PIKA_TEST(d == expected);
+    }
+}
+
+template <typename ExPolicy, typename Context>
+void test_prefetching_for_each(ExPolicy&& policy, Context ctx,
+    std::vector<std::size_t> const& idx, std::vector<double>& c)
+{
+    std::vector<double> expected(c);
+    for (std::size_t i : idx)
+    {
+        expected[i] = -c[i];
+    }
+
+    pika::for_each(policy, ctx.begin(), ctx.end(),
+        [&](std::size_t i) { c[i] = -c[i]; });
+    PIKA_TEST(c == expected);
+}
+
+template <typename ExPolicy, typename Context>
+void test_prefetching_async(ExPolicy&& policy, Context ctx,
+    std::vector<std::size_t> const& idx, std::vector<double> const& c)
+{
+    std::size_t const size = idx.size();
+
+    std::vector<double> d(size);
+    auto f = pika::transform(policy, ctx.begin(), ctx.end(), d.begin(),
+        [&](std::size_t i) { return c[i]; });
+    PIKA_TEST(f.get() == d.end());
+
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(d[i], c[idx[i]]);
+    }
+
+    auto g = pika::transform_reduce(policy, ctx.begin(), ctx.end(), 0.0,
+        std::plus<double>(), [&](std::size_t i) { return c[i]; });
+    PIKA_TEST_EQ(g.get(), std::accumulate(d.begin(), d.end(), 0.0));
+}
+
+void test_prefetching()
+{
+    using namespace pika::execution;
+    using pika::parallel::detail::make_indirect_prefetcher_context;
+    using pika::parallel::detail::make_prefetcher_context;
+
+    for (std::size_t size : {1, 7, 1000, 100007})
+    {
+        std::vector<double> c(size);
+        std::iota(c.begin(), c.end(), double(gen() % 1000));
+
+        // direct mode
+        std::vector<std::size_t> range(size);
+        std::iota(range.begin(), range.end(), 0);
+
+        for (std::size_t factor : {1, 2, 20})
+        {
+            auto ctx = make_prefetcher_context(
+                range.begin(), range.end(), factor, c);
+
+            test_prefetching(seq, ctx, range, c);
+            test_prefetching(par, ctx, range, c);
+            test_prefetching(par_unseq, ctx, range, c);
+            test_prefetching_for_each(par, ctx, range, c);
+            test_prefetching_async(par(task), ctx, range, c);
+        }
+
+        // indirect mode, the indices may repeat
+        std::vector<std::size_t> idx(size);
+        for (std::size_t& i : idx)
+        {
+            i = gen() % size;
+        }
+
+        for (std::size_t distance : {0, 1, 16, 1000})
+        {
+            auto ctx = make_indirect_prefetcher_context(
+                idx.begin(), idx.end(), distance, c);
+
+            test_prefetching(seq, ctx, idx, c);
+            test_prefetching(par, ctx, idx, c);
+            test_prefetching(par_unseq, ctx, idx, c);
+            test_prefetching_async(par(task), ctx, idx, c);
+        }
+
+        // for_each negates each element once, the indices must be unique
+        std::shuffle(range.begin(), range.end(), gen);
+        auto ctx =
+            make_indirect_prefetcher_context(range.begin(), range.end(), 8, c);
+        test_prefetching_for_each(par, ctx, range, c);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_prefetching();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -450,10 +450,14 @@ void test_reduce_by_key1()
     {
         test_reduce_by_key_const(seq, int(), int(), false, std::equal_to<int>(),
             [](int key) { return key; });
+        test_reduce_by_key_const(par, int(), int(), false, std::equal_to<int>(),
+            [](int key) { return key; });
         //
         // default comparison operator (std::equal_to)
         test_reduce_by_key_const(seq, int(), double(), false, almost_equal(),
             [](int key) { return key; });
+        test_reduce_by_key_const(par, int(), double(), false, almost_equal(),
+            [](int key) { return key; });
         //
         test_reduce_by_key_const(
             seq, double(), double(), false,
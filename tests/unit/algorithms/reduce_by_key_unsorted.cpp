@@ -0,0 +1,209 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/reduce_by_key_unsorted.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+// Keys are drawn from [0, cardinality) in random order, the expected result
+// is computed with an ordered map.
+template <typename ExPolicy>
+void test_reduce_by_key_unsorted(
+    ExPolicy&& policy, std::size_t size, int cardinality, bool sorted)
+{
+    std::uniform_int_distribution<int> distk(0, cardinality - 1);
+    std::uniform_int_distribution<int> distv(-256, 256);
+
+    std::vector<int> keys(size);
+    std::vector<long> values(size);
+    std::map<int, long> expected;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys[i] = distk(gen);
+        values[i] = distv(gen);
+        expected[keys[i]] += values[i];
+    }
+
+    std::vector<int> keys_out(size);
+    std::vector<long> values_out(size);
+
+    pika::parallel::detail::in_out_result<std::vector<int>::iterator,
+        std::vector<long>::iterator>
+        result;
+    if (sorted)
+    {
+        result = pika::reduce_by_key_unsorted(policy, keys.begin(), keys.end(),
+            values.begin(), keys_out.begin(), values_out.begin(),
+            std::plus<long>(), std::hash<int>(), std::equal_to<int>(),
+            std::less<int>());
+    }
+    else
+    {
+        result = pika::reduce_by_key_unsorted(policy, keys.begin(), keys.end(),
+            values.begin(), keys_out.begin(), values_out.begin());
+    }
+
+    std::size_t const groups = std::distance(keys_out.begin(), result.in);
+    PIKA_TEST_EQ(groups, expected.size());
+    PIKA_TEST_EQ(std::size_t(std::distance(values_out.begin(), result.out)),
+        expected.size());
+
+    std::map<int, long> actual;
+    for (std::size_t i = 0; i != groups; ++i)
+    {
+        PIKA_TEST(actual.emplace(keys_out[i], values_out[i]).second);
+        if (sorted && i != 0)
+        {
+            PIKA_TEST_LT(keys_out[i - 1], keys_out[i]);
+        }
+    }
+    PIKA_TEST(actual == expected);
+}
+
+template <typename ExPolicy>
+void test_reduce_by_key_unsorted(ExPolicy&& policy)
+{
+    for (std::size_t size : {0, 1, 1007, 100007})
+    {
+        for (int cardinality : {1, 17, 10007})
+        {
+            test_reduce_by_key_unsorted(policy, size, cardinality, false);
+            test_reduce_by_key_unsorted(policy, size, cardinality, true);
+        }
+    }
+}
+
+// The values of every group have to be combined in the order of the input
+// sequence for non-commutative operations.
+template <typename ExPolicy>
+void test_reduce_by_key_unsorted_order(ExPolicy&& policy)
+{
+    std::size_t const size = 10007;
+
+    std::vector<int> keys(size);
+    std::vector<std::string> values(size);
+    std::map<int, std::string> expected;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys[i] = int(gen() % 13);
+        values[i] = std::string(1, char('a' + gen() % 26));
+        expected[keys[i]] += values[i];
+    }
+
+    std::vector<int> keys_out(size);
+    std::vector<std::string> values_out(size);
+
+    auto result = pika::reduce_by_key_unsorted(policy, keys.begin(),
+        keys.end(), values.begin(), keys_out.begin(), values_out.begin(),
+        std::plus<std::string>(), std::hash<int>(), std::equal_to<int>(),
+        std::less<int>());
+
+    PIKA_TEST_EQ(std::size_t(std::distance(keys_out.begin(), result.in)),
+        expected.size());
+
+    std::size_t i = 0;
+    for (auto const& group : expected)
+    {
+        PIKA_TEST_EQ(keys_out[i], group.first);
+        PIKA_TEST(values_out[i] == group.second);
+        ++i;
+    }
+}
+
+template <typename ExPolicy>
+void test_reduce_by_key_unsorted_async(ExPolicy&& policy)
+{
+    std::size_t const size = 10007;
+
+    std::vector<int> keys(size);
+    std::vector<int> values(size, 1);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys[i] = int(i % 7);
+    }
+
+    std::vector<int> keys_out(size);
+    std::vector<int> values_out(size);
+
+    auto f = pika::reduce_by_key_unsorted(policy, keys.begin(), keys.end(),
+        values.begin(), keys_out.begin(), values_out.begin());
+    auto result = f.get();
+
+    PIKA_TEST_EQ(std::distance(keys_out.begin(), result.in), 7);
+    for (std::size_t i = 0; i != 7; ++i)
+    {
+        PIKA_TEST_EQ(std::size_t(values_out[i]),
+            size / 7 + (std::size_t(keys_out[i]) < size % 7 ? 1 : 0));
+    }
+}
+
+void test_reduce_by_key_unsorted()
+{
+    using namespace pika::execution;
+
+    test_reduce_by_key_unsorted(seq);
+    test_reduce_by_key_unsorted(par);
+    test_reduce_by_key_unsorted(par_unseq);
+
+    test_reduce_by_key_unsorted_order(seq);
+    test_reduce_by_key_unsorted_order(par);
+
+    test_reduce_by_key_unsorted_async(seq(task));
+    test_reduce_by_key_unsorted_async(par(task));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_reduce_by_key_unsorted();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
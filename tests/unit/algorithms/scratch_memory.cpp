@@ -0,0 +1,260 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/copy.hpp>
+#include <pika/parallel/algorithms/partial_sort_copy.hpp>
+#include <pika/parallel/algorithms/partition.hpp>
+#include <pika/parallel/algorithms/remove.hpp>
+#include <pika/parallel/algorithms/set_union.hpp>
+#include <pika/parallel/algorithms/stable_sort.hpp>
+#include <pika/parallel/algorithms/unique.hpp>
+#include <pika/parallel/util/scratch_memory.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+// Counts the allocations and the bytes currently allocated through it.
+struct counting_resource : pika::execution::scratch_resource
+{
+    void* allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++allocations;
+        allocated += bytes;
+        return ::operator new(bytes, std::align_val_t(alignment));
+    }
+
+    void deallocate(void* p, std::size_t bytes,
+        std::size_t alignment) noexcept override
+    {
+        allocated -= bytes;
+        ::operator delete(p, bytes, std::align_val_t(alignment));
+    }
+
+    std::atomic<std::size_t> allocations{0};
+    std::atomic<std::size_t> allocated{0};
+};
+
+template <typename ExPolicy>
+void test_scratch_memory(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<int> c(size);
+    for (int& v : c)
+    {
+        v = int(gen() % 100);
+    }
+
+    auto pred = [](int v) { return v % 3 == 0; };
+
+    {
+        std::vector<int> d(size);
+        auto result =
+            pika::copy_if(policy, c.begin(), c.end(), d.begin(), pred);
+
+        std::vector<int> expected(size);
+        auto expected_result =
+            std::copy_if(c.begin(), c.end(), expected.begin(), pred);
+        PIKA_TEST_EQ(std::distance(d.begin(), result),
+            std::distance(expected.begin(), expected_result));
+        PIKA_TEST(std::equal(d.begin(), result, expected.begin()));
+    }
+    {
+        std::vector<int> d(c);
+        auto result = pika::remove_if(policy, d.begin(), d.end(), pred);
+
+        std::vector<int> expected(c);
+        auto expected_result =
+            std::remove_if(expected.begin(), expected.end(), pred);
+        PIKA_TEST_EQ(std::distance(d.begin(), result),
+            std::distance(expected.begin(), expected_result));
+        PIKA_TEST(std::equal(d.begin(), result, expected.begin()));
+    }
+    {
+        std::vector<int> d(c);
+        std::sort(d.begin(), d.end());
+        std::vector<int> expected(d);
+
+        auto result = pika::unique(policy, d.begin(), d.end());
+        auto expected_result = std::unique(expected.begin(), expected.end());
+        PIKA_TEST_EQ(std::distance(d.begin(), result),
+            std::distance(expected.begin(), expected_result));
+        PIKA_TEST(std::equal(d.begin(), result, expected.begin()));
+    }
+    {
+        std::vector<int> d(size), e(size);
+        auto result = pika::partition_copy(
+            policy, c.begin(), c.end(), d.begin(), e.begin(), pred);
+
+        std::vector<int> expected_d(size), expected_e(size);
+        auto expected_result = std::partition_copy(c.begin(), c.end(),
+            expected_d.begin(), expected_e.begin(), pred);
+        PIKA_TEST(std::equal(d.begin(), result.first, expected_d.begin(),
+            expected_result.first));
+        PIKA_TEST(std::equal(e.begin(), result.second, expected_e.begin(),
+            expected_result.second));
+    }
+    {
+        std::vector<int> a(c.begin(), c.begin() + size / 2);
+        std::vector<int> b(c.begin() + size / 2, c.end());
+        std::sort(a.begin(), a.end());
+        std::sort(b.begin(), b.end());
+
+        std::vector<int> d(size);
+        auto result = pika::set_union(
+            policy, a.begin(), a.end(), b.begin(), b.end(), d.begin());
+
+        std::vector<int> expected(size);
+        auto expected_result = std::set_union(
+            a.begin(), a.end(), b.begin(), b.end(), expected.begin());
+        PIKA_TEST(
+            std::equal(d.begin(), result, expected.begin(), expected_result));
+    }
+    {
+        std::vector<int> d(size / 2 + 1);
+        auto result = pika::partial_sort_copy(
+            policy, c.begin(), c.end(), d.begin(), d.end());
+
+        std::vector<int> expected(size / 2 + 1);
+        auto expected_result = std::partial_sort_copy(
+            c.begin(), c.end(), expected.begin(), expected.end());
+        PIKA_TEST(
+            std::equal(d.begin(), result, expected.begin(), expected_result));
+    }
+    {
+        std::vector<int> d(c);
+        pika::stable_sort(policy, d.begin(), d.end());
+
+        std::vector<int> expected(c);
+        std::stable_sort(expected.begin(), expected.end());
+        PIKA_TEST(d == expected);
+    }
+    {
+        std::vector<int> d(c);
+        auto result = pika::stable_partition(policy, d.begin(), d.end(), pred);
+
+        std::vector<int> expected(c);
+        auto expected_result =
+            std::stable_partition(expected.begin(), expected.end(), pred);
+        PIKA_TEST_EQ(std::distance(d.begin(), result),
+            std::distance(expected.begin(), expected_result));
+        PIKA_TEST(d == expected);
+    }
+}
+
+void test_scratch_memory()
+{
+    using namespace pika::execution;
+
+    // all buffers are allocated from the given resource and returned to it
+    {
+        counting_resource resource;
+        for (std::size_t size : {1, 2, 1000, 1000007})
+        {
+            test_scratch_memory(par.with(scratch_memory(resource)), size);
+            test_scratch_memory(par_unseq.with(scratch_memory(resource)), size);
+        }
+        PIKA_TEST_LT(std::size_t(0), resource.allocations.load());
+        PIKA_TEST_EQ(resource.allocated.load(), std::size_t(0));
+    }
+
+    // the buffer of a sequential stable_sort comes from the resource as well
+    {
+        counting_resource resource;
+
+        std::vector<int> c(1000);
+        for (int& v : c)
+        {
+            v = int(gen() % 100);
+        }
+        std::vector<int> expected(c);
+        std::stable_sort(expected.begin(), expected.end());
+
+        pika::stable_sort(
+            seq.with(scratch_memory(resource)), c.begin(), c.end());
+        PIKA_TEST(c == expected);
+        PIKA_TEST_LT(std::size_t(0), resource.allocations.load());
+        PIKA_TEST_EQ(resource.allocated.load(), std::size_t(0));
+    }
+
+    // the default arena
+    for (std::size_t size : {1, 1000, 1000007, 10000007})
+    {
+        test_scratch_memory(par.with(scratch_memory()), size);
+        test_scratch_memory(par, size);
+    }
+
+    // blocks are aligned to cache lines, large ones to huge pages
+    {
+        auto& arena = pika::parallel::detail::default_scratch_resource();
+
+        void* p = arena.allocate(100000, 8);
+        PIKA_TEST_EQ(reinterpret_cast<std::uintptr_t>(p) % 64, 0u);
+        arena.deallocate(p, 100000, 8);
+
+        void* q = arena.allocate(90000, 128);
+        PIKA_TEST_EQ(reinterpret_cast<std::uintptr_t>(q) % 128, 0u);
+        arena.deallocate(q, 90000, 128);
+
+        std::size_t const large = std::size_t(5) << 20;
+        void* r = arena.allocate(large, 8);
+        PIKA_TEST_EQ(reinterpret_cast<std::uintptr_t>(r) %
+                pika::parallel::detail::scratch_huge_page_size,
+            0u);
+        arena.deallocate(r, large, 8);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_scratch_memory();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
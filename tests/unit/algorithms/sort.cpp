@@ -147,6 +147,18 @@ void test_sort2()
     test_sort2_async(par(task), float(), std::greater<float>());
 }
 
+void test_sort_indirect()
+{
+    using namespace pika::execution;
+
+    test_sort_indirect(seq);
+    test_sort_indirect(par);
+    test_sort_indirect(par_unseq);
+
+    test_sort_indirect_exception(seq);
+    test_sort_indirect_exception(par);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int pika_main(pika::program_options::variables_map& vm)
 {
@@ -159,6 +171,7 @@ int pika_main(pika::program_options::variables_map& vm)
 
     test_sort1();
     test_sort2();
+    test_sort_indirect();
     sort_benchmark();
 
     return pika::finalize();
@@ -15,6 +15,9 @@
 #include <fmt/ostream.h>
 #include <fmt/printf.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <iomanip>
@@ -23,6 +26,7 @@
 #include <limits>
 #include <numeric>
 #include <random>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -718,3 +722,142 @@ void test_sort1_async_str(ExPolicy&& policy, Compare comp = Compare())
     bool is_sorted = (verify_(c, comp, elapsed, true) != 0);
     PIKA_TEST(is_sorted);
 }
+
+////////////////////////////////////////////////////////////////////////////////
+// records too large to be moved around cheaply are sorted indirectly
+struct large_record
+{
+    int key;
+    std::size_t pos;
+    std::string name;
+    std::array<char, 500> payload;
+};
+
+inline std::vector<large_record> make_large_records(std::size_t size)
+{
+    std::vector<large_record> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i].key = std::rand() % 1000;
+        c[i].pos = i;
+        c[i].name = std::to_string(i);
+        c[i].payload.fill(char(i));
+    }
+    return c;
+}
+
+inline bool verify_large_record(large_record const& r)
+{
+    return r.name == std::to_string(r.pos) && r.payload[0] == char(r.pos) &&
+        r.payload.back() == char(r.pos);
+}
+
+template <typename ExPolicy>
+void test_sort_indirect(ExPolicy&& policy)
+{
+    static_assert(pika::is_execution_policy<ExPolicy>::value,
+        "pika::is_execution_policy<ExPolicy>::value");
+    static_assert(pika::traits::use_indirect_sort_v<large_record>,
+        "pika::traits::use_indirect_sort_v<large_record>");
+
+    for (std::size_t size : {0, 1, 1000, 100007})
+    {
+        std::vector<large_record> c = make_large_records(size);
+
+        pika::sort(policy, c.begin(), c.end(), std::greater<int>(),
+            &large_record::key);
+
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            PIKA_TEST(verify_large_record(c[i]));
+            if (i != 0)
+            {
+                PIKA_TEST_LTE(c[i].key, c[i - 1].key);
+            }
+        }
+    }
+}
+
+// records whose moves may throw are sorted indirectly as well, a failing
+// move must not lose any of them
+struct throwing_move_record
+{
+    static inline std::atomic<std::int64_t> moves_left{-1};
+
+    int key = 0;
+    std::size_t pos = 0;
+
+    throwing_move_record() = default;
+
+    throwing_move_record(throwing_move_record&& rhs)
+      : key(rhs.key)
+      , pos(rhs.pos)
+    {
+        count_move();
+    }
+
+    throwing_move_record& operator=(throwing_move_record&& rhs)
+    {
+        count_move();
+        key = rhs.key;
+        pos = rhs.pos;
+        return *this;
+    }
+
+    static void count_move()
+    {
+        if (moves_left.fetch_sub(1) == 0)
+        {
+            throw std::runtime_error("test");
+        }
+    }
+};
+
+template <typename ExPolicy>
+void test_sort_indirect_exception(ExPolicy&& policy)
+{
+    static_assert(pika::is_execution_policy<ExPolicy>::value,
+        "pika::is_execution_policy<ExPolicy>::value");
+    static_assert(pika::traits::use_indirect_sort_v<throwing_move_record>,
+        "pika::traits::use_indirect_sort_v<throwing_move_record>");
+
+    std::size_t const size = 10007;
+    std::vector<throwing_move_record> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i].key = std::rand() % 1000;
+        c[i].pos = i;
+    }
+
+    bool caught_exception = false;
+    throwing_move_record::moves_left = size / 2;
+    try
+    {
+        pika::sort(policy, c.begin(), c.end(), std::less<int>(),
+            &throwing_move_record::key);
+
+        PIKA_TEST(false);
+    }
+    catch (pika::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        PIKA_TEST(false);
+    }
+    throwing_move_record::moves_left = -1;
+    PIKA_TEST(caught_exception);
+
+    // every record is still there, in unspecified order
+    std::vector<std::size_t> positions(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        positions[i] = c[i].pos;
+    }
+    std::sort(positions.begin(), positions.end());
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(positions[i], i);
+    }
+}
@@ -23,6 +23,10 @@ void test_stable_partition()
     test_stable_partition(par, IteratorTag());
     test_stable_partition(par_unseq, IteratorTag());
 
+    test_stable_partition_interleaved(seq, IteratorTag());
+    test_stable_partition_interleaved(par, IteratorTag());
+    test_stable_partition_interleaved(par_unseq, IteratorTag());
+
     test_stable_partition_async(seq(task), IteratorTag());
     test_stable_partition_async(par(task), IteratorTag());
 }
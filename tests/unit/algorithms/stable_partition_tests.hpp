@@ -9,6 +9,7 @@
 #include <pika/parallel/algorithms/partition.hpp>
 #include <pika/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <iostream>
 #include <iterator>
@@ -139,6 +140,35 @@ void test_stable_partition(ExPolicy policy, IteratorTag)
     PIKA_TEST_EQ(count, d.size());
 }
 
+// elements satisfying the predicate are interleaved with the others and
+// have to be moved (not copied) to their final positions
+template <typename ExPolicy, typename IteratorTag>
+void test_stable_partition_interleaved(ExPolicy policy, IteratorTag)
+{
+    static_assert(pika::is_execution_policy<ExPolicy>::value,
+        "pika::is_execution_policy<ExPolicy>::value");
+
+    using base_iterator = std::vector<std::string>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<std::string> c(10007);
+    for (std::string& s : c)
+    {
+        s = std::to_string(std::rand());
+    }
+    std::vector<std::string> d = c;
+
+    auto pred = [](std::string const& s) { return s.back() % 3 == 0; };
+
+    auto result = pika::stable_partition(
+        policy, iterator(std::begin(c)), iterator(std::end(c)), pred);
+    auto partition_pt = std::stable_partition(std::begin(d), std::end(d), pred);
+
+    PIKA_TEST(std::distance(std::begin(c), result.base()) ==
+        std::distance(std::begin(d), partition_pt));
+    PIKA_TEST(c == d);
+}
+
 template <typename ExPolicy, typename IteratorTag>
 void test_stable_partition_async(ExPolicy p, IteratorTag)
 {
@@ -147,6 +147,25 @@ void test_stable_sort2()
     test_stable_sort2_async(par(task), float(), std::greater<float>());
 }
 
+void test_stable_sort_workspace()
+{
+    using namespace pika::execution;
+
+    test_stable_sort_workspace(seq, 0);
+    test_stable_sort_workspace(par, 0);
+    test_stable_sort_workspace(par, 2);
+    test_stable_sort_workspace(par_unseq, 16);
+}
+
+void test_stable_sort_indirect()
+{
+    using namespace pika::execution;
+
+    test_stable_sort_indirect(seq);
+    test_stable_sort_indirect(par);
+    test_stable_sort_indirect(par_unseq);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int pika_main(pika::program_options::variables_map& vm)
 {
@@ -159,6 +178,8 @@ int pika_main(pika::program_options::variables_map& vm)
 
     test_stable_sort1();
     test_stable_sort2();
+    test_stable_sort_workspace();
+    test_stable_sort_indirect();
     sort_benchmark();
 
     return pika::finalize();
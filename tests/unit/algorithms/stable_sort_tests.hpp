@@ -14,8 +14,11 @@
 #include <fmt/ostream.h>
 #include <fmt/printf.h>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <iterator>
@@ -722,3 +725,101 @@ void test_stable_sort1_async_str(ExPolicy&& policy, Compare comp = Compare())
     bool is_sorted = (verify_(c, comp, elapsed, true) != 0);
     PIKA_TEST(is_sorted);
 }
+
+////////////////////////////////////////////////////////////////////////////////
+// repeated sorts sharing one workspace, the sorts after the first one do not
+// grow it
+template <typename ExPolicy>
+void test_stable_sort_workspace(ExPolicy&& policy, std::uint32_t oversampling)
+{
+    static_assert(pika::is_execution_policy<ExPolicy>::value,
+        "pika::is_execution_policy<ExPolicy>::value");
+
+    using value_type = std::pair<int, std::size_t>;
+
+    pika::sort_workspace<value_type> workspace(oversampling);
+    workspace.reserve(1 << 20);
+    std::size_t const capacity = workspace.capacity();
+    PIKA_TEST_LTE(std::size_t((1 << 20) / 2), capacity);
+
+    for (std::size_t size :
+        {std::size_t(1 << 20), std::size_t(1000), std::size_t(300007),
+            std::size_t(1 << 20), std::size_t(0), std::size_t(1 << 18)})
+    {
+        std::vector<value_type> c(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            c[i] = value_type(std::rand() % 1000, i);
+        }
+
+        pika::stable_sort(policy, c.begin(), c.end(), workspace,
+            std::less<int>(), [](value_type const& v) { return v.first; });
+
+        PIKA_TEST(std::is_sorted(c.begin(), c.end()));
+        PIKA_TEST_EQ(workspace.capacity(), capacity);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// records too large to be moved around cheaply are sorted indirectly
+struct large_record
+{
+    int key;
+    std::size_t pos;
+    std::string name;
+    std::array<char, 500> payload;
+};
+
+inline std::vector<large_record> make_large_records(std::size_t size)
+{
+    std::vector<large_record> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i].key = std::rand() % 1000;
+        c[i].pos = i;
+        c[i].name = std::to_string(i);
+        c[i].payload.fill(char(i));
+    }
+    return c;
+}
+
+inline bool verify_large_record(large_record const& r)
+{
+    return r.name == std::to_string(r.pos) && r.payload[0] == char(r.pos) &&
+        r.payload.back() == char(r.pos);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_indirect(ExPolicy&& policy)
+{
+    static_assert(pika::is_execution_policy<ExPolicy>::value,
+        "pika::is_execution_policy<ExPolicy>::value");
+    static_assert(pika::traits::use_indirect_sort_v<large_record>,
+        "pika::traits::use_indirect_sort_v<large_record>");
+
+    pika::sort_workspace<large_record> workspace;
+    for (std::size_t size : {0, 1, 1000, 100007, 100007})
+    {
+        std::vector<large_record> c = make_large_records(size);
+        std::vector<large_record> d = make_large_records(size);
+
+        pika::stable_sort(policy, c.begin(), c.end(), std::less<int>(),
+            &large_record::key);
+        pika::stable_sort(policy, d.begin(), d.end(), workspace,
+            std::less<int>(), &large_record::key);
+
+        for (std::vector<large_record> const* v : {&c, &d})
+        {
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                PIKA_TEST(verify_large_record((*v)[i]));
+                if (i != 0)
+                {
+                    PIKA_TEST((*v)[i - 1].key < (*v)[i].key ||
+                        ((*v)[i - 1].key == (*v)[i].key &&
+                            (*v)[i - 1].pos < (*v)[i].pos));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,202 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/stencil_transform.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+// One step of the heat equation, the coefficient makes all intermediate
+// values exactly representable for the integral initial values used here.
+struct heat
+{
+    template <typename Neighborhood>
+    auto operator()(Neighborhood const& nb) const
+    {
+        return nb[0] + 0.25 * (nb[-1] - 2.0 * nb[0] + nb[1]);
+    }
+};
+
+// a wider stencil
+struct smooth
+{
+    template <typename Neighborhood>
+    auto operator()(Neighborhood const& nb) const
+    {
+        return 0.125 * (nb[-2] + nb[2]) + 0.25 * (nb[-1] + nb[1]) +
+            0.25 * nb[0];
+    }
+};
+
+std::vector<double> make_values(std::size_t size)
+{
+    std::vector<double> values(size);
+    for (double& v : values)
+    {
+        v = double(gen() % 1000);
+    }
+    return values;
+}
+
+template <typename F>
+std::vector<double> reference(
+    std::vector<double> values, std::size_t radius, std::size_t steps, F f)
+{
+    for (std::size_t step = 0; step != steps; ++step)
+    {
+        std::vector<double> next = values;
+        for (std::size_t i = radius; i + radius < values.size(); ++i)
+        {
+            next[i] = f(values.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        values = next;
+    }
+    return values;
+}
+
+template <typename ExPolicy, typename F>
+void test_stencil_transform(
+    ExPolicy&& policy, std::size_t size, std::size_t radius, F f)
+{
+    std::vector<double> const values = make_values(size);
+    std::vector<double> dest(size);
+
+    auto result = pika::stencil_transform(
+        policy, values.begin(), values.end(), dest.begin(), radius, f);
+
+    PIKA_TEST(result == dest.end());
+    PIKA_TEST(dest == reference(values, radius, 1, f));
+}
+
+template <typename ExPolicy, typename F>
+void test_stencil_transform_steps(ExPolicy&& policy, std::size_t size,
+    std::size_t radius, std::size_t steps, F f)
+{
+    std::vector<double> const values = make_values(size);
+    std::vector<double> dest(size);
+
+    auto result = pika::stencil_transform(
+        policy, values.begin(), values.end(), dest.begin(), radius, steps, f);
+
+    PIKA_TEST(result == dest.end());
+    PIKA_TEST(dest == reference(values, radius, steps, f));
+}
+
+// the destination need only be a forward iterator
+template <typename ExPolicy>
+void test_stencil_transform_list(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<double> const values = make_values(size);
+    std::list<double> dest(size);
+
+    auto result = pika::stencil_transform(
+        policy, values.begin(), values.end(), dest.begin(), 1, 3, heat());
+
+    PIKA_TEST(result == dest.end());
+    PIKA_TEST(std::vector<double>(dest.begin(), dest.end()) ==
+        reference(values, 1, 3, heat()));
+}
+
+template <typename ExPolicy>
+void test_stencil_transform_async(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<double> const values = make_values(size);
+    std::vector<double> dest(size);
+
+    auto f = pika::stencil_transform(
+        policy, values.begin(), values.end(), dest.begin(), 2, 5, smooth());
+
+    PIKA_TEST(f.get() == dest.end());
+    PIKA_TEST(dest == reference(values, 2, 5, smooth()));
+}
+
+void test_stencil_transform()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 3, 7, 1000, 100007})
+    {
+        test_stencil_transform(seq, size, 1, heat());
+        test_stencil_transform(par, size, 1, heat());
+        test_stencil_transform(par_unseq, size, 1, heat());
+        test_stencil_transform(par, size, 2, smooth());
+
+        for (std::size_t steps : {0, 1, 2, 10})
+        {
+            test_stencil_transform_steps(seq, size, 1, steps, heat());
+            test_stencil_transform_steps(par, size, 1, steps, heat());
+            test_stencil_transform_steps(par_unseq, size, 2, steps, smooth());
+        }
+
+        test_stencil_transform_list(seq, size);
+        test_stencil_transform_list(par, size);
+
+        test_stencil_transform_async(seq(task), size);
+        test_stencil_transform_async(par(task), size);
+    }
+
+    // without an execution policy
+    std::vector<double> const values = make_values(100);
+    std::vector<double> dest(100);
+    auto result = pika::stencil_transform(
+        values.begin(), values.end(), dest.begin(), 1, heat());
+    PIKA_TEST(result == dest.end());
+    PIKA_TEST(dest == reference(values, 1, 1, heat()));
+
+    result = pika::stencil_transform(
+        values.begin(), values.end(), dest.begin(), 1, 4, heat());
+    PIKA_TEST(result == dest.end());
+    PIKA_TEST(dest == reference(values, 1, 4, heat()));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_stencil_transform();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,231 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/copy.hpp>
+#include <pika/parallel/algorithms/fill.hpp>
+#include <pika/parallel/algorithms/generate.hpp>
+#include <pika/parallel/algorithms/move.hpp>
+#include <pika/parallel/algorithms/transform.hpp>
+#include <pika/parallel/algorithms/uninitialized_fill.hpp>
+#include <pika/parallel/util/streaming_stores.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+struct pair_type
+{
+    double first;
+    double second;
+};
+
+// The outputs start at a random offset into a cache line, each test checks
+// that the elements preceding and following the output are left unchanged.
+template <typename ExPolicy>
+void test_streaming_stores(ExPolicy&& policy, std::size_t size)
+{
+    std::size_t const offset = gen() % 8;
+
+    std::vector<double> src(size);
+    std::iota(src.begin(), src.end(), double(gen() % 1000));
+
+    std::vector<double> c(size + 9, -1.0);
+    auto const first = c.begin() + offset;
+    auto const last = first + size;
+
+    auto verify = [&](auto const& expected) {
+        PIKA_TEST(std::all_of(
+            c.begin(), first, [](double v) { return v == -1.0; }));
+        PIKA_TEST(std::equal(first, last, expected.begin()));
+        PIKA_TEST(std::all_of(
+            last, c.end(), [](double v) { return v == -1.0; }));
+        std::fill(first, last, -1.0);
+    };
+
+    {
+        auto result = pika::copy(policy, src.begin(), src.end(), first);
+        PIKA_TEST(result == last);
+        verify(src);
+    }
+    {
+        auto result = pika::copy_n(policy, src.begin(), size, first);
+        PIKA_TEST(result == last);
+        verify(src);
+    }
+    {
+        auto result = pika::move(policy, src.begin(), src.end(), first);
+        PIKA_TEST(result == last);
+        verify(src);
+    }
+    {
+        auto result = pika::transform(policy, src.begin(), src.end(), first,
+            [](double v) { return 2 * v; });
+        PIKA_TEST(result == last);
+
+        std::vector<double> expected(size);
+        std::transform(src.begin(), src.end(), expected.begin(),
+            [](double v) { return 2 * v; });
+        verify(expected);
+    }
+    {
+        auto result = pika::transform(policy, src.begin(), src.end(),
+            src.begin(), first, [](double v1, double v2) { return v1 + v2; });
+        PIKA_TEST(result == last);
+
+        std::vector<double> expected(size);
+        std::transform(src.begin(), src.end(), expected.begin(),
+            [](double v) { return 2 * v; });
+        verify(expected);
+    }
+    {
+        pika::fill(policy, first, last, 42.0);
+        verify(std::vector<double>(size, 42.0));
+
+        auto result = pika::fill_n(policy, first, size, 43);
+        PIKA_TEST(result == last);
+        verify(std::vector<double>(size, 43.0));
+    }
+    {
+        // generate calls the generator once per element in any order
+        std::atomic<std::size_t> calls(0);
+        auto result = pika::generate(policy, first, last, [&]() {
+            ++calls;
+            return 5.0;
+        });
+        PIKA_TEST(result == last);
+        PIKA_TEST_EQ(calls.load(), size);
+        verify(std::vector<double>(size, 5.0));
+
+        result = pika::generate_n(policy, first, size, []() { return 6.0; });
+        PIKA_TEST(result == last);
+        verify(std::vector<double>(size, 6.0));
+    }
+    {
+        auto result = pika::uninitialized_fill_n(policy, first, size, 7.0);
+        PIKA_TEST(result == last);
+        verify(std::vector<double>(size, 7.0));
+
+        pika::uninitialized_fill(policy, first, last, 8.0);
+        verify(std::vector<double>(size, 8.0));
+    }
+}
+
+template <typename ExPolicy>
+void test_streaming_stores_pairs(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<pair_type> src(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        src[i] = pair_type{double(i), -double(i)};
+    }
+
+    std::vector<pair_type> dest(size);
+    pika::transform(policy, src.begin(), src.end(), dest.begin(),
+        [](pair_type p) { return pair_type{p.second, p.first}; });
+
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(dest[i].first, -double(i));
+        PIKA_TEST_EQ(dest[i].second, double(i));
+    }
+}
+
+template <typename ExPolicy>
+void test_streaming_stores_async(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<double> src(size);
+    std::iota(src.begin(), src.end(), 0.0);
+
+    std::vector<double> dest(size);
+    auto f = pika::copy(policy, src.begin(), src.end(), dest.begin());
+    PIKA_TEST(f.get() == dest.end());
+    PIKA_TEST(dest == src);
+
+    auto g = pika::fill(policy, dest.begin(), dest.end(), 1.0);
+    g.get();
+    PIKA_TEST(std::all_of(
+        dest.begin(), dest.end(), [](double v) { return v == 1.0; }));
+}
+
+void test_streaming_stores()
+{
+    using namespace pika::execution;
+
+    // streaming stores are used for all outputs
+    for (std::size_t size : {1, 7, 8, 9, 63, 1000, 100007})
+    {
+        test_streaming_stores(par.with(streaming_stores(0)), size);
+        test_streaming_stores(par_unseq.with(streaming_stores(0)), size);
+        test_streaming_stores_pairs(par.with(streaming_stores(0)), size);
+    }
+    test_streaming_stores_async(par(task).with(streaming_stores(0)), 100007);
+
+    // by default streaming stores are used for outputs not fitting into the
+    // last level cache
+    {
+        using pika::parallel::detail::use_streaming_stores;
+
+        std::size_t const size =
+            pika::parallel::detail::last_level_cache_size() / sizeof(double);
+        auto policy = par.with(streaming_stores());
+
+        PIKA_TEST(!use_streaming_stores<double*>(policy, size - 1));
+        PIKA_TEST(use_streaming_stores<double*>(policy, size));
+        PIKA_TEST(!use_streaming_stores<double*>(par, size));
+
+        test_streaming_stores(policy, 1000);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_streaming_stores();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,197 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/transform_n_out.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+struct particle
+{
+    double x;
+    int id;
+    float mass;
+};
+
+std::vector<particle> make_particles(std::size_t size)
+{
+    std::vector<particle> particles(size);
+    for (particle& p : particles)
+    {
+        p.x = double(gen() % 10000) / 100.0;
+        p.id = int(gen() % 1000);
+        p.mass = float(gen() % 100);
+    }
+    return particles;
+}
+
+// splits an array of structures into a structure of arrays
+template <typename ExPolicy>
+void test_transform_n_out(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<particle> const particles = make_particles(size);
+
+    std::vector<double> x(size);
+    std::vector<int> id(size);
+    std::vector<float> mass(size);
+
+    auto result = pika::transform_n_out(policy, particles.begin(),
+        particles.end(), std::make_tuple(x.begin(), id.begin(), mass.begin()),
+        [](particle const& p) { return std::make_tuple(p.x, p.id, p.mass); });
+
+    PIKA_TEST(std::get<0>(result) == x.end());
+    PIKA_TEST(std::get<1>(result) == id.end());
+    PIKA_TEST(std::get<2>(result) == mass.end());
+
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(x[i], particles[i].x);
+        PIKA_TEST_EQ(id[i], particles[i].id);
+        PIKA_TEST_EQ(mass[i], particles[i].mass);
+    }
+}
+
+// the outputs need not be of the same kind and f may return a pair
+template <typename ExPolicy>
+void test_transform_n_out_pair(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<particle> const particles = make_particles(size);
+
+    std::list<double> momentum(size);
+    std::vector<int> id(size);
+
+    auto result = pika::transform_n_out(policy, particles.begin(),
+        particles.end(), std::make_tuple(momentum.begin(), id.begin()),
+        [](particle const& p) { return std::make_pair(p.x * p.mass, p.id); });
+
+    PIKA_TEST(std::get<0>(result) == momentum.end());
+    PIKA_TEST(std::get<1>(result) == id.end());
+
+    auto it = momentum.begin();
+    for (std::size_t i = 0; i != size; ++i, ++it)
+    {
+        PIKA_TEST_EQ(*it, particles[i].x * particles[i].mass);
+        PIKA_TEST_EQ(id[i], particles[i].id);
+    }
+}
+
+template <typename ExPolicy>
+void test_transform_n_out_async(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<particle> const particles = make_particles(size);
+
+    std::vector<double> x(size);
+    std::vector<float> mass(size);
+
+    auto f = pika::transform_n_out(policy, particles.begin(), particles.end(),
+        std::make_tuple(x.begin(), mass.begin()),
+        [](particle const& p) { return std::make_tuple(p.x, p.mass); });
+
+    auto result = f.get();
+    PIKA_TEST(std::get<0>(result) == x.end());
+    PIKA_TEST(std::get<1>(result) == mass.end());
+
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(x[i], particles[i].x);
+        PIKA_TEST_EQ(mass[i], particles[i].mass);
+    }
+}
+
+void test_transform_n_out()
+{
+    using namespace pika::execution;
+
+    for (std::size_t size : {0, 1, 7, 1000, 100007})
+    {
+        test_transform_n_out(seq, size);
+        test_transform_n_out(par, size);
+        test_transform_n_out(par_unseq, size);
+
+        test_transform_n_out_pair(seq, size);
+        test_transform_n_out_pair(par, size);
+
+        test_transform_n_out_async(seq(task), size);
+        test_transform_n_out_async(par(task), size);
+    }
+
+    // without an execution policy
+    std::vector<particle> const particles = make_particles(100);
+    std::vector<double> x(100);
+    std::vector<int> id(100);
+    auto result = pika::transform_n_out(particles.begin(), particles.end(),
+        std::make_tuple(x.begin(), id.begin()),
+        [](particle const& p) { return std::make_tuple(p.x, p.id); });
+    PIKA_TEST(std::get<0>(result) == x.end());
+    PIKA_TEST(std::get<1>(result) == id.end());
+
+    // from a single-pass input
+    std::istringstream is("1 2 3 4 5");
+    std::vector<int> squares(5);
+    std::vector<int> negated(5);
+    auto input_result =
+        pika::transform_n_out(std::istream_iterator<int>(is),
+            std::istream_iterator<int>(),
+            std::make_tuple(squares.begin(), negated.begin()),
+            [](int i) { return std::make_pair(i * i, -i); });
+    PIKA_TEST(std::get<0>(input_result) == squares.end());
+    PIKA_TEST(std::get<1>(input_result) == negated.end());
+    PIKA_TEST(squares == (std::vector<int>{1, 4, 9, 16, 25}));
+    PIKA_TEST(negated == (std::vector<int>{-1, -2, -3, -4, -5}));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_transform_n_out();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/transpose.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+std::vector<int> make_values(std::size_t size)
+{
+    std::vector<int> values(size);
+    for (int& v : values)
+    {
+        v = static_cast<int>(gen() % 10000);
+    }
+    return values;
+}
+
+std::vector<int> reference_transpose(
+    std::vector<int> const& values, std::size_t rows, std::size_t cols)
+{
+    std::vector<int> result(rows * cols);
+    for (std::size_t i = 0; i != rows; ++i)
+    {
+        for (std::size_t j = 0; j != cols; ++j)
+        {
+            result[j * rows + i] = values[i * cols + j];
+        }
+    }
+    return result;
+}
+
+template <typename ExPolicy>
+void test_transpose(ExPolicy&& policy, std::size_t rows, std::size_t cols)
+{
+    std::vector<int> const values = make_values(rows * cols);
+    std::vector<int> dest(rows * cols, -1);
+
+    auto result =
+        pika::transpose(policy, values.begin(), rows, cols, dest.begin());
+
+    PIKA_TEST(result == dest.end());
+    PIKA_TEST(dest == reference_transpose(values, rows, cols));
+}
+
+template <typename ExPolicy>
+void test_transpose_async(ExPolicy&& policy, std::size_t rows, std::size_t cols)
+{
+    std::vector<int> const values = make_values(rows * cols);
+    std::vector<int> dest(rows * cols, -1);
+
+    auto f = pika::transpose(policy, values.begin(), rows, cols, dest.begin());
+
+    PIKA_TEST(f.get() == dest.end());
+    PIKA_TEST(dest == reference_transpose(values, rows, cols));
+}
+
+// copies a tile of a rows x cols matrix into the middle of a larger one,
+// the elements outside of the tile must not be touched
+template <typename ExPolicy>
+void test_tiled_copy(ExPolicy&& policy, std::size_t rows, std::size_t cols)
+{
+    std::size_t const src_stride = cols + 3;
+    std::size_t const dest_stride = cols + 17;
+    std::size_t const offset = 5;
+
+    std::vector<int> const values = make_values(rows * src_stride);
+    std::vector<int> dest((rows + 2) * dest_stride, -1);
+
+    auto result = pika::tiled_copy(policy, values.begin(), rows, cols,
+        src_stride, dest.begin() + offset, dest_stride);
+
+    std::vector<int> expected((rows + 2) * dest_stride, -1);
+    for (std::size_t i = 0; i != rows; ++i)
+    {
+        for (std::size_t j = 0; j != cols; ++j)
+        {
+            expected[offset + i * dest_stride + j] =
+                values[i * src_stride + j];
+        }
+    }
+
+    std::size_t const last =
+        rows == 0 ? offset : offset + (rows - 1) * dest_stride + cols;
+    PIKA_TEST(result == dest.begin() + last);
+    PIKA_TEST(dest == expected);
+}
+
+template <typename ExPolicy>
+void test_tiled_copy_async(
+    ExPolicy&& policy, std::size_t rows, std::size_t cols)
+{
+    std::vector<int> const values = make_values(rows * cols);
+    std::vector<int> dest(rows * cols, -1);
+
+    auto f = pika::tiled_copy(
+        policy, values.begin(), rows, cols, cols, dest.begin(), cols);
+
+    PIKA_TEST(f.get() == dest.end());
+    PIKA_TEST(dest == values);
+}
+
+void test_transpose()
+{
+    using namespace pika::execution;
+
+    std::pair<std::size_t, std::size_t> const shapes[] = {{0, 0}, {0, 7},
+        {7, 0}, {1, 1}, {1, 100}, {100, 1}, {3, 5}, {32, 32}, {33, 31},
+        {64, 48}, {257, 129}, {1000, 1000}, {3, 10007}, {10007, 3}};
+
+    for (auto [rows, cols] : shapes)
+    {
+        test_transpose(seq, rows, cols);
+        test_transpose(par, rows, cols);
+        test_transpose(par_unseq, rows, cols);
+
+        test_transpose_async(seq(task), rows, cols);
+        test_transpose_async(par(task), rows, cols);
+
+        test_tiled_copy(seq, rows, cols);
+        test_tiled_copy(par, rows, cols);
+        test_tiled_copy(par_unseq, rows, cols);
+
+        test_tiled_copy_async(seq(task), rows, cols);
+        test_tiled_copy_async(par(task), rows, cols);
+    }
+
+    // without an execution policy
+    std::vector<int> const values = make_values(12 * 34);
+    std::vector<int> dest(12 * 34);
+    auto result = pika::transpose(values.begin(), 12, 34, dest.begin());
+    PIKA_TEST(result == dest.end());
+    PIKA_TEST(dest == reference_transpose(values, 12, 34));
+
+    result = pika::tiled_copy(values.begin(), 12, 34, 34, dest.begin(), 34);
+    PIKA_TEST(result == dest.end());
+    PIKA_TEST(dest == values);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_transpose();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -29,6 +29,11 @@ void uninitialized_copy_test()
 {
     test_uninitialized_copy<std::random_access_iterator_tag>();
     test_uninitialized_copy<std::forward_iterator_tag>();
+
+    using namespace pika::execution;
+    test_uninitialized_copy_contiguous(seq);
+    test_uninitialized_copy_contiguous(par);
+    test_uninitialized_copy_contiguous(par_unseq);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
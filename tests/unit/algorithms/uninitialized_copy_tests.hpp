@@ -12,6 +12,7 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdlib>
 #include <iostream>
 #include <iterator>
 #include <numeric>
@@ -71,6 +72,24 @@ void test_uninitialized_copy_async(ExPolicy&& p, IteratorTag)
     PIKA_TEST_EQ(count, d.size());
 }
 
+// contiguous sequences of trivially copyable elements are copied with memmove
+template <typename ExPolicy>
+void test_uninitialized_copy_contiguous(ExPolicy&& policy)
+{
+    std::vector<std::size_t> c(10007);
+    std::iota(std::begin(c), std::end(c), std::rand());
+
+    std::size_t* d =
+        static_cast<std::size_t*>(std::malloc(c.size() * sizeof(std::size_t)));
+
+    auto result = pika::uninitialized_copy(
+        std::forward<ExPolicy>(policy), c.data(), c.data() + c.size(), d);
+    PIKA_TEST(result == d + c.size());
+    PIKA_TEST(std::equal(std::begin(c), std::end(c), d));
+
+    std::free(d);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename ExPolicy, typename IteratorTag>
 void test_uninitialized_copy_exception(ExPolicy policy, IteratorTag)
@@ -29,6 +29,11 @@ void uninitialized_value_construct_test()
 {
     test_uninitialized_value_construct<std::random_access_iterator_tag>();
     test_uninitialized_value_construct<std::forward_iterator_tag>();
+
+    using namespace pika::execution;
+    test_uninitialized_value_construct_contiguous(seq);
+    test_uninitialized_value_construct_contiguous(par);
+    test_uninitialized_value_construct_contiguous(par_unseq);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -10,8 +10,10 @@
 #include <pika/parallel/algorithms/uninitialized_value_construct.hpp>
 #include <pika/testing.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <numeric>
@@ -80,6 +82,21 @@ void test_uninitialized_value_construct_async(ExPolicy&& policy, IteratorTag)
     std::free(p);
 }
 
+// contiguous sequences of arithmetic elements are zeroed with memset
+template <typename ExPolicy>
+void test_uninitialized_value_construct_contiguous(ExPolicy&& policy)
+{
+    double* p = static_cast<double*>(std::malloc(data_size * sizeof(double)));
+    std::memset(static_cast<void*>(p), 0xcd, data_size * sizeof(double));
+
+    auto result = pika::uninitialized_value_construct_n(
+        std::forward<ExPolicy>(policy), p, data_size);
+    PIKA_TEST(result == p + data_size);
+    PIKA_TEST(std::all_of(p, p + data_size, [](double v) { return v == 0; }));
+
+    std::free(p);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename ExPolicy, typename IteratorTag>
 void test_uninitialized_value_construct_exception(ExPolicy policy, IteratorTag)
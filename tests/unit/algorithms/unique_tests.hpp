@@ -192,6 +192,39 @@ void test_unique_async(
     PIKA_TEST(equality);
 }
 
+// Sorted sequences with runs of equal elements of very different lengths,
+// which makes the parallel algorithm close both gaps shorter and gaps
+// longer than the elements following them.
+template <typename ExPolicy, typename IteratorTag>
+void test_unique_sorted(ExPolicy policy, IteratorTag)
+{
+    static_assert(pika::is_execution_policy<ExPolicy>::value,
+        "pika::is_execution_policy<ExPolicy>::value");
+
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    for (int range : {1, 7, 1000, 1000000})
+    {
+        std::size_t const size = 1000007;
+        std::vector<int> c(size), d;
+        std::generate(std::begin(c), std::end(c), random_fill(0, range));
+        std::sort(std::begin(c), std::end(c));
+        std::fill(std::begin(c) + size / 4, std::begin(c) + size / 2,
+            c[size / 4]);
+        d = c;
+
+        auto result = pika::unique(
+            policy, iterator(std::begin(c)), iterator(std::end(c)));
+        auto solution = std::unique(std::begin(d), std::end(d));
+
+        bool equality =
+            test::equal(std::begin(c), result.base(), std::begin(d), solution);
+
+        PIKA_TEST(equality);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename ExPolicy, typename IteratorTag>
 void test_unique_exception(ExPolicy policy, IteratorTag)
@@ -485,6 +518,11 @@ void test_unique()
         },
         rand_base);
 
+    ////////// Sorted sequences.
+    test_unique_sorted(seq, IteratorTag());
+    test_unique_sorted(par, IteratorTag());
+    test_unique_sorted(par_unseq, IteratorTag());
+
     ////////// Another test cases for justifying the implementation.
     test_unique_etc(seq, IteratorTag(), user_defined_type(), rand_base);
 }
@@ -0,0 +1,105 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/gather.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Contiguous arithmetic elements indexed by integers select the vectorized
+// gather kernel, check it for sizes which are not a multiple of the
+// vector-pack size.
+template <typename ExPolicy, typename T, typename Index>
+void test_gather(ExPolicy policy, std::size_t size)
+{
+    std::vector<T> src(size + 3);
+    std::iota(std::begin(src), std::end(src), T(1));
+
+    std::vector<Index> map(size);
+    for (Index& i : map)
+    {
+        i = Index(std::rand() % src.size());
+    }
+
+    std::vector<T> d(size);
+    auto result = pika::gather(
+        policy, std::begin(map), std::end(map), std::begin(src), std::begin(d));
+
+    PIKA_TEST(result == std::end(d));
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(d[i], src[map[i]]);
+    }
+}
+
+template <typename ExPolicy>
+void test_gather(ExPolicy policy)
+{
+    for (std::size_t size : {1, 7, 1003, 10007, 1000007})
+    {
+        test_gather<ExPolicy, double, std::size_t>(policy, size);
+        test_gather<ExPolicy, float, std::int32_t>(policy, size);
+        test_gather<ExPolicy, std::int64_t, std::uint32_t>(policy, size);
+    }
+}
+
+void gather_test()
+{
+    using namespace pika::execution;
+
+    test_gather(simd);
+    test_gather(par_simd);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    gather_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/exclusive_scan.hpp>
+#include <pika/parallel/datapar.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "../algorithms/inclusive_scan_tests.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_inclusive_scan1()
+{
+    using namespace pika::execution;
+
+    test_inclusive_scan1(simd, IteratorTag());
+    test_inclusive_scan1(par_simd, IteratorTag());
+
+    test_inclusive_scan1_async(simd(task), IteratorTag());
+    test_inclusive_scan1_async(par_simd(task), IteratorTag());
+}
+
+void inclusive_scan_test1()
+{
+    test_inclusive_scan1<std::random_access_iterator_tag>();
+    test_inclusive_scan1<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_inclusive_scan2()
+{
+    using namespace pika::execution;
+
+    test_inclusive_scan2(simd, IteratorTag());
+    test_inclusive_scan2(par_simd, IteratorTag());
+
+    test_inclusive_scan2_async(simd(task), IteratorTag());
+    test_inclusive_scan2_async(par_simd(task), IteratorTag());
+}
+
+void inclusive_scan_test2()
+{
+    test_inclusive_scan2<std::random_access_iterator_tag>();
+    test_inclusive_scan2<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_inclusive_scan3()
+{
+    using namespace pika::execution;
+
+    test_inclusive_scan3(simd, IteratorTag());
+    test_inclusive_scan3(par_simd, IteratorTag());
+
+    test_inclusive_scan3_async(simd(task), IteratorTag());
+    test_inclusive_scan3_async(par_simd(task), IteratorTag());
+}
+
+void inclusive_scan_test3()
+{
+    test_inclusive_scan3<std::random_access_iterator_tag>();
+    test_inclusive_scan3<std::forward_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// std::plus over arithmetic types selects the vectorized scan kernels, check
+// them against the sequential versions for sizes which are not a multiple of
+// the vector-pack size
+template <typename T>
+void test_scan_plus(std::size_t size)
+{
+    using namespace pika::execution;
+
+    std::vector<T> c(size);
+    std::vector<T> d(size);
+    std::vector<T> e(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = T(std::rand() % 8);
+    }
+
+    pika::inclusive_scan(par_simd, std::begin(c), std::end(c), std::begin(d),
+        std::plus<T>(), T(3));
+    pika::parallel::detail::sequential_inclusive_scan(
+        std::begin(c), std::end(c), std::begin(e), T(3), std::plus<T>());
+    PIKA_TEST(d == e);
+
+    pika::exclusive_scan(
+        par_simd, std::begin(c), std::end(c), std::begin(d), T(3));
+    pika::parallel::detail::sequential_exclusive_scan(
+        std::begin(c), std::end(c), std::begin(e), T(3), std::plus<T>());
+    PIKA_TEST(d == e);
+}
+
+void scan_plus_test()
+{
+    for (std::size_t size : {1, 7, 64, 1003, 10007})
+    {
+        test_scan_plus<int>(size);
+        test_scan_plus<unsigned char>(size);
+        test_scan_plus<double>(size);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void inclusive_scan_validate()
+{
+    std::vector<int> a, b;
+    // test scan algorithms using separate array for output
+    test_inclusive_scan_validate(pika::execution::par_simd, a, b);
+    // test scan algorithms using same array for input and output
+    test_inclusive_scan_validate(pika::execution::par_simd, a, a);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    inclusive_scan_test1();
+    inclusive_scan_test2();
+    inclusive_scan_test3();
+
+    scan_plus_test();
+    inclusive_scan_validate();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/equal.hpp>
+#include <pika/parallel/algorithms/lexicographical_compare.hpp>
+#include <pika/parallel/algorithms/mismatch.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Default predicates over arithmetic types select the vectorized comparison
+// kernels, check them against the standard algorithms for sizes which are not
+// a multiple of the vector-pack size and for differences at both ends of the
+// ranges.
+template <typename ExPolicy, typename T>
+void test_compare(ExPolicy policy, std::size_t size, std::size_t changed_idx)
+{
+    std::vector<T> c1(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c1[i] = T(std::rand() % 64);
+    }
+
+    std::vector<T> c2 = c1;
+    if (changed_idx < size)
+    {
+        c2[changed_idx] = T(c2[changed_idx] + 1);
+    }
+
+    {
+        bool result = pika::equal(
+            policy, std::begin(c1), std::end(c1), std::begin(c2));
+        PIKA_TEST_EQ(result,
+            std::equal(std::begin(c1), std::end(c1), std::begin(c2)));
+
+        result = pika::equal(policy, std::begin(c1), std::end(c1),
+            std::begin(c2), std::end(c2), std::equal_to<T>());
+        PIKA_TEST_EQ(result,
+            std::equal(std::begin(c1), std::end(c1), std::begin(c2)));
+    }
+
+    {
+        auto result = pika::mismatch(
+            policy, std::begin(c1), std::end(c1), std::begin(c2));
+        auto expected =
+            std::mismatch(std::begin(c1), std::end(c1), std::begin(c2));
+        PIKA_TEST(result.first == expected.first);
+        PIKA_TEST(result.second == expected.second);
+
+        auto result_binary = pika::mismatch(policy, std::begin(c1),
+            std::end(c1), std::begin(c2), std::end(c2));
+        PIKA_TEST(result_binary.first == expected.first);
+        PIKA_TEST(result_binary.second == expected.second);
+    }
+
+    {
+        bool result = pika::lexicographical_compare(policy, std::begin(c1),
+            std::end(c1), std::begin(c2), std::end(c2));
+        PIKA_TEST_EQ(result,
+            std::lexicographical_compare(
+                std::begin(c1), std::end(c1), std::begin(c2), std::end(c2)));
+
+        result = pika::lexicographical_compare(policy, std::begin(c2),
+            std::end(c2), std::begin(c1), std::end(c1), std::less<T>());
+        PIKA_TEST_EQ(result,
+            std::lexicographical_compare(
+                std::begin(c2), std::end(c2), std::begin(c1), std::end(c1)));
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_compare(ExPolicy policy)
+{
+    for (std::size_t size : {1, 7, 64, 1003, 10007})
+    {
+        for (std::size_t changed_idx : {std::size_t(0), size / 2, size - 1,
+                 std::size_t(std::rand()) % size, size})
+        {
+            test_compare<ExPolicy, T>(policy, size, changed_idx);
+        }
+    }
+}
+
+void compare_test()
+{
+    using namespace pika::execution;
+
+    test_compare<decltype(simd), int>(simd);
+    test_compare<decltype(simd), unsigned char>(simd);
+    test_compare<decltype(simd), double>(simd);
+
+    test_compare<decltype(par_simd), int>(par_simd);
+    test_compare<decltype(par_simd), unsigned char>(par_simd);
+    test_compare<decltype(par_simd), double>(par_simd);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// NaN compares unequal to everything, but is equivalent to everything under
+// std::less, the vectorized kernels have to preserve that distinction
+void nan_test()
+{
+    using namespace pika::execution;
+
+    std::vector<double> c1(1003, 1.0);
+    std::vector<double> c2(c1.size(), 1.0);
+    c1[500] = c2[500] = std::numeric_limits<double>::quiet_NaN();
+
+    PIKA_TEST(
+        !pika::equal(par_simd, std::begin(c1), std::end(c1), std::begin(c2)));
+
+    auto result =
+        pika::mismatch(par_simd, std::begin(c1), std::end(c1), std::begin(c2));
+    PIKA_TEST_EQ(std::distance(std::begin(c1), result.first), 500);
+
+    c2.back() = 2.0;
+    PIKA_TEST(pika::lexicographical_compare(par_simd, std::begin(c1),
+        std::end(c1), std::begin(c2), std::end(c2)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    compare_test();
+    nan_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/replace.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Arithmetic element types select the vectorized replace kernels, check them
+// against the standard algorithms for sizes which are not a multiple of the
+// vector-pack size.
+template <typename ExPolicy, typename T>
+void test_replace(ExPolicy policy, std::size_t size)
+{
+    std::vector<T> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = T(std::rand() % 8);
+    }
+
+    T const old_value = T(std::rand() % 8);
+    T const new_value = T(42);
+    auto pred = [](auto const& v) { return v > T(3); };
+
+    {
+        std::vector<T> d = c;
+        std::vector<T> e = c;
+        pika::replace(policy, std::begin(d), std::end(d), old_value, new_value);
+        std::replace(std::begin(e), std::end(e), old_value, new_value);
+        PIKA_TEST(d == e);
+    }
+
+    {
+        std::vector<T> d = c;
+        std::vector<T> e = c;
+        pika::replace_if(policy, std::begin(d), std::end(d), pred, new_value);
+        std::replace_if(std::begin(e), std::end(e), pred, new_value);
+        PIKA_TEST(d == e);
+    }
+
+    {
+        std::vector<T> d(size);
+        std::vector<T> e(size);
+        auto result = pika::replace_copy(policy, std::begin(c), std::end(c),
+            std::begin(d), old_value, new_value);
+        std::replace_copy(std::begin(c), std::end(c), std::begin(e),
+            old_value, new_value);
+        PIKA_TEST(result == std::end(d));
+        PIKA_TEST(d == e);
+    }
+
+    {
+        std::vector<T> d(size);
+        std::vector<T> e(size);
+        auto result = pika::replace_copy_if(policy, std::begin(c),
+            std::end(c), std::begin(d), pred, new_value);
+        std::replace_copy_if(
+            std::begin(c), std::end(c), std::begin(e), pred, new_value);
+        PIKA_TEST(result == std::end(d));
+        PIKA_TEST(d == e);
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_replace(ExPolicy policy)
+{
+    for (std::size_t size : {1, 7, 64, 1003, 10007})
+    {
+        test_replace<ExPolicy, T>(policy, size);
+    }
+}
+
+void replace_test()
+{
+    using namespace pika::execution;
+
+    test_replace<decltype(simd), int>(simd);
+    test_replace<decltype(simd), unsigned char>(simd);
+    test_replace<decltype(simd), double>(simd);
+
+    test_replace<decltype(par_simd), int>(par_simd);
+    test_replace<decltype(par_simd), unsigned char>(par_simd);
+    test_replace<decltype(par_simd), double>(par_simd);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void replace_nan_test()
+{
+    using namespace pika::execution;
+
+    std::vector<double> c(10007, 1.0);
+    for (std::size_t i = 0; i < c.size(); i += 101)
+    {
+        c[i] = std::numeric_limits<double>::quiet_NaN();
+    }
+
+    pika::replace_if(
+        par_simd, std::begin(c), std::end(c),
+        [](auto const& v) { return v != v; }, 0.0);
+
+    PIKA_TEST(std::none_of(
+        std::begin(c), std::end(c), [](double v) { return v != v; }));
+    PIKA_TEST_EQ(std::count(std::begin(c), std::end(c), 0.0),
+        std::ptrdiff_t((c.size() + 100) / 101));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    replace_test();
+    replace_nan_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
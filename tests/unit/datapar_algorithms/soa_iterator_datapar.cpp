@@ -0,0 +1,183 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/for_each.hpp>
+#include <pika/parallel/algorithms/transform.hpp>
+#include <pika/parallel/algorithms/transform_reduce.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/parallel/util/soa_iterator.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The columns are deliberately offset against each other, the vectorized
+// loops have to load (and store) every column on its own. The third column
+// is read-only and must not be written back.
+template <typename T>
+struct soa_columns
+{
+    explicit soa_columns(std::size_t size)
+      : a(size + 1)
+      , b(size + 2)
+      , c(size + 3)
+      , size(size)
+    {
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            a[i + 1] = T(std::rand() % 10);
+            b[i + 2] = T(std::rand() % 10);
+            c[i + 3] = T(std::rand() % 10);
+        }
+    }
+
+    pika::util::soa_iterator<T, T, T const> begin()
+    {
+        return pika::util::make_soa_iterator(
+            a.data() + 1, b.data() + 2, static_cast<T const*>(c.data() + 3));
+    }
+
+    pika::util::soa_iterator<T, T, T const> end()
+    {
+        return begin() + static_cast<std::ptrdiff_t>(size);
+    }
+
+    std::vector<T> a, b, c;
+    std::size_t size;
+};
+
+template <typename ExPolicy, typename T>
+void test_soa_for_each(ExPolicy policy, std::size_t size)
+{
+    soa_columns<T> cols(size);
+    std::vector<T> const b = cols.b;
+    std::vector<T> const c = cols.c;
+
+    pika::for_each(policy, cols.begin(), cols.end(), [](auto&& t) {
+        std::get<0>(t) = std::get<1>(t) * std::get<2>(t);
+        std::get<1>(t) = std::get<1>(t) + std::get<2>(t);
+    });
+
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(cols.a[i + 1], T(b[i + 2] * c[i + 3]));
+        PIKA_TEST_EQ(cols.b[i + 2], T(b[i + 2] + c[i + 3]));
+    }
+    PIKA_TEST(cols.c == c);
+}
+
+template <typename ExPolicy, typename T>
+void test_soa_transform(ExPolicy policy, std::size_t size)
+{
+    soa_columns<T> cols(size);
+    std::vector<T> d(size);
+
+    auto result = pika::transform(policy, cols.begin(), cols.end(),
+        std::begin(d), [](auto const& t) {
+            return std::get<0>(t) + std::get<1>(t) * std::get<2>(t);
+        });
+
+    PIKA_TEST(result == std::end(d));
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(
+            d[i], T(cols.a[i + 1] + cols.b[i + 2] * cols.c[i + 3]));
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_soa_transform_reduce(ExPolicy policy, std::size_t size)
+{
+    soa_columns<T> cols(size);
+
+    T result = pika::transform_reduce(policy, cols.begin(), cols.end(), T(1),
+        std::plus<>(), [](auto const& t) {
+            return std::get<0>(t) * std::get<1>(t) - std::get<2>(t);
+        });
+
+    T expected = T(1);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        expected += T(cols.a[i + 1] * cols.b[i + 2] - cols.c[i + 3]);
+    }
+    PIKA_TEST_EQ(result, expected);
+}
+
+template <typename ExPolicy>
+void test_soa_iterator(ExPolicy policy)
+{
+    for (std::size_t size : {1, 7, 1003, 10007})
+    {
+        test_soa_for_each<ExPolicy, double>(policy, size);
+        test_soa_for_each<ExPolicy, float>(policy, size);
+        test_soa_for_each<ExPolicy, int>(policy, size);
+
+        test_soa_transform<ExPolicy, double>(policy, size);
+        test_soa_transform<ExPolicy, float>(policy, size);
+        test_soa_transform<ExPolicy, int>(policy, size);
+
+        test_soa_transform_reduce<ExPolicy, double>(policy, size);
+        test_soa_transform_reduce<ExPolicy, float>(policy, size);
+        test_soa_transform_reduce<ExPolicy, int>(policy, size);
+    }
+}
+
+void soa_iterator_test()
+{
+    using namespace pika::execution;
+
+    test_soa_iterator(seq);
+    test_soa_iterator(par);
+    test_soa_iterator(simd);
+    test_soa_iterator(par_simd);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    soa_iterator_test();
+
+    return pika::finalize();
+}
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/stencil_transform.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Contiguous arithmetic elements select the vectorized kernel, the stencil
+// is then invoked with neighborhoods of vector packs. Check it for sizes
+// which are not a multiple of the vector-pack size, the values stay exactly
+// representable for all element types.
+template <typename T>
+struct stencil
+{
+    template <typename Neighborhood>
+    auto operator()(Neighborhood const& nb) const
+    {
+        return nb[-2] + nb[-1] - nb[0] * T(2) + nb[1] + T(3) * nb[2];
+    }
+};
+
+template <typename T>
+std::vector<T> reference(std::vector<T> values, std::size_t steps)
+{
+    for (std::size_t step = 0; step != steps; ++step)
+    {
+        std::vector<T> next = values;
+        for (std::size_t i = 2; i + 2 < values.size(); ++i)
+        {
+            next[i] = stencil<T>()(values.begin() + std::ptrdiff_t(i));
+        }
+        values = next;
+    }
+    return values;
+}
+
+template <typename ExPolicy, typename T>
+void test_stencil_transform(
+    ExPolicy policy, std::size_t size, std::size_t steps)
+{
+    std::vector<T> c(size);
+    for (T& v : c)
+    {
+        v = T(std::rand() % 100);
+    }
+
+    std::vector<T> d(size);
+
+    auto result = pika::stencil_transform(policy, std::begin(c), std::end(c),
+        std::begin(d), 2, steps, stencil<T>());
+
+    PIKA_TEST(result == std::end(d));
+    PIKA_TEST(d == reference(c, steps));
+}
+
+template <typename ExPolicy>
+void test_stencil_transform(ExPolicy policy)
+{
+    for (std::size_t size : {1, 7, 1003, 10007, 1000007})
+    {
+        for (std::size_t steps : {1, 3})
+        {
+            test_stencil_transform<ExPolicy, double>(policy, size, steps);
+            test_stencil_transform<ExPolicy, float>(policy, size, steps);
+            test_stencil_transform<ExPolicy, int>(policy, size, steps);
+        }
+    }
+}
+
+void stencil_transform_test()
+{
+    using namespace pika::execution;
+
+    test_stencil_transform(simd);
+    test_stencil_transform(par_simd);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    stencil_transform_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/transform_n_out.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Contiguous arithmetic elements of the same size select the vectorized
+// kernel, f is then invoked with vector packs and returns one pack per
+// output. Check it for sizes which are not a multiple of the vector-pack
+// size.
+template <typename ExPolicy, typename T>
+void test_transform_n_out(ExPolicy policy, std::size_t size)
+{
+    std::vector<T> c(size);
+    for (T& v : c)
+    {
+        v = T(std::rand() % 1000);
+    }
+
+    std::vector<T> d1(size);
+    std::vector<T> d2(size);
+    std::vector<T> d3(size);
+
+    auto result = pika::transform_n_out(policy, std::begin(c), std::end(c),
+        std::make_tuple(std::begin(d1), std::begin(d2), std::begin(d3)),
+        [](auto v) { return std::make_tuple(v + 1, v * 2, v * v); });
+
+    PIKA_TEST(std::get<0>(result) == std::end(d1));
+    PIKA_TEST(std::get<1>(result) == std::end(d2));
+    PIKA_TEST(std::get<2>(result) == std::end(d3));
+
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        PIKA_TEST_EQ(d1[i], T(c[i] + 1));
+        PIKA_TEST_EQ(d2[i], T(c[i] * 2));
+        PIKA_TEST_EQ(d3[i], T(c[i] * c[i]));
+    }
+}
+
+template <typename ExPolicy>
+void test_transform_n_out(ExPolicy policy)
+{
+    for (std::size_t size : {1, 7, 1003, 10007, 1000007})
+    {
+        test_transform_n_out<ExPolicy, double>(policy, size);
+        test_transform_n_out<ExPolicy, float>(policy, size);
+        test_transform_n_out<ExPolicy, int>(policy, size);
+    }
+}
+
+void transform_n_out_test()
+{
+    using namespace pika::execution;
+
+    test_transform_n_out(simd);
+    test_transform_n_out(par_simd);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    transform_n_out_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <pika/init.hpp>
+#include <pika/parallel/algorithms/transpose.hpp>
+#include <pika/parallel/datapar.hpp>
+#include <pika/testing.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Contiguous arithmetic elements select the vectorized leaves of the
+// built-in vector-pack backend, which transpose square tiles of vector packs
+// by shuffles. Check them for shapes which are not a multiple of the
+// vector-pack size in either dimension.
+template <typename ExPolicy, typename T>
+void test_transpose(ExPolicy policy, std::size_t rows, std::size_t cols)
+{
+    std::vector<T> c(rows * cols);
+    for (T& v : c)
+    {
+        v = T(std::rand() % 1000);
+    }
+
+    std::vector<T> d(rows * cols);
+
+    auto result = pika::transpose(policy, std::begin(c), rows, cols,
+        std::begin(d));
+
+    PIKA_TEST(result == std::end(d));
+
+    std::size_t count = 0;
+    for (std::size_t i = 0; i != rows; ++i)
+    {
+        for (std::size_t j = 0; j != cols; ++j)
+        {
+            if (d[j * rows + i] == c[i * cols + j])
+            {
+                ++count;
+            }
+        }
+    }
+    PIKA_TEST_EQ(count, rows * cols);
+}
+
+template <typename ExPolicy, typename T>
+void test_tiled_copy(ExPolicy policy, std::size_t rows, std::size_t cols)
+{
+    std::size_t const stride = cols + 5;
+
+    std::vector<T> c(rows * stride);
+    for (T& v : c)
+    {
+        v = T(std::rand() % 1000);
+    }
+
+    std::vector<T> d(rows * cols);
+
+    auto result = pika::tiled_copy(
+        policy, std::begin(c), rows, cols, stride, std::begin(d), cols);
+
+    PIKA_TEST(result == std::end(d));
+
+    std::size_t count = 0;
+    for (std::size_t i = 0; i != rows; ++i)
+    {
+        for (std::size_t j = 0; j != cols; ++j)
+        {
+            if (d[i * cols + j] == c[i * stride + j])
+            {
+                ++count;
+            }
+        }
+    }
+    PIKA_TEST_EQ(count, rows * cols);
+}
+
+template <typename ExPolicy>
+void test_transpose(ExPolicy policy)
+{
+    std::pair<std::size_t, std::size_t> const shapes[] = {{1, 7}, {7, 1},
+        {8, 8}, {17, 33}, {64, 64}, {1003, 7}, {7, 1003}, {1000, 1007}};
+
+    for (auto [rows, cols] : shapes)
+    {
+        test_transpose<ExPolicy, double>(policy, rows, cols);
+        test_transpose<ExPolicy, float>(policy, rows, cols);
+        test_transpose<ExPolicy, int>(policy, rows, cols);
+
+        test_tiled_copy<ExPolicy, double>(policy, rows, cols);
+        test_tiled_copy<ExPolicy, int>(policy, rows, cols);
+    }
+}
+
+void transpose_test()
+{
+    using namespace pika::execution;
+
+    test_transpose(simd);
+    test_transpose(par_simd);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int pika_main(pika::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    transpose_test();
+
+    return pika::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace pika::program_options;
+    options_description desc_commandline(
+        "Usage: " PIKA_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"pika.os_threads=all"};
+
+    // Initialize and run pika
+    pika::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    PIKA_TEST_EQ_MSG(pika::init(pika_main, argc, argv, init_args), 0,
+        "pika main exited with non-zero status");
+
+    return 0;
+}